@@ -11,18 +11,14 @@
 *
 *******************************************************************************/
 
-#include <thread>                           // C++11 standard library threads
 #include <atomic>                           // C++ atomic data types
 #include <chrono>                           // For: chrono::steady_clock::now()
-#include <system_error>                     // May be thrown by thread c'tor
+#include <future>                           // For: std::future
 
 #include "raylib-cpp.hpp"
 
-// Using C++ std::atomic_bool (aka. std::atomic<bool>) for synchronization.
-// n.b. A plain built-in type can't be used for inter-thread synchronization
-std::atomic_bool dataLoaded{false};
-static void LoadDataThread();     // Loading data thread function declaration
-static int dataProgress = 0;      // Data progress accumulator
+static void LoadData();                     // Loading data function declaration
+static std::atomic_int dataProgress{0};     // Data progress accumulator
 
 int main(void)
 {
@@ -34,7 +30,8 @@ int main(void)
     raylib::Window window(screenWidth, screenHeight,
                           "raylib [core] example - loading thread");
 
-    std::thread threadId;         // Loading data thread id
+    raylib::AssetLoader loader;   // Runs loading requests on the worker thread pool
+    std::future<void> dataLoaded; // Ready once the data is loaded
 
     enum { STATE_WAITING, STATE_LOADING, STATE_FINISHED } state = STATE_WAITING;
     int framesCounter = 0;
@@ -46,27 +43,23 @@ int main(void)
     while (!window.ShouldClose()) {    // Detect window close button or ESC key
         // Update
         //----------------------------------------------------------------------
+        loader.Update();
+
         switch (state)
         {
             case STATE_WAITING:
                 if (IsKeyPressed(KEY_ENTER))
                 {
-                    try {
-                        threadId = std::thread(LoadDataThread);
-                        TraceLog(LOG_INFO,
-                            "Loading thread initialized successfully");
-                    } catch (std::system_error& e) {
-                        TraceLog(LOG_ERROR, "Error: %s", e.what());
-                    }
-
+                    dataLoaded = loader.Load(LoadData);
                     state = STATE_LOADING;
                 }
                 break;
 
             case STATE_LOADING:
                 framesCounter++;
-                if (dataLoaded.load())
+                if (dataLoaded.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                 {
+                    dataLoaded.get();
                     framesCounter = 0;
                     state = STATE_FINISHED;
                 }
@@ -76,7 +69,6 @@ int main(void)
                 if (IsKeyPressed(KEY_ENTER))
                 {
                     // Reset everything to launch again
-                    dataLoaded = false;
                     dataProgress = 0;
                     state = STATE_WAITING;
                 }
@@ -120,14 +112,12 @@ int main(void)
         //----------------------------------------------------------------------
     }
 
-    if (threadId.joinable()) // The user might quit without creating a thread.
-      threadId.join();       // Good etiquette, but may take a second.
-
+    // The loader waits for the running request when it goes out of scope.
     return 0;
 }
 
-// Loading data thread function definition
-static void LoadDataThread()
+// Loading data function definition, run on a worker thread
+static void LoadData()
 {
     using namespace std::chrono;
     int timeCounter = 0;            // Time counted in ms
@@ -144,7 +134,4 @@ static void LoadDataThread()
         // main thread as a progress bar
         dataProgress = timeCounter/10;
     }
-
-    // When data has finished loading, we set global variable
-    dataLoaded = true;
 }
@@ -9,41 +9,10 @@
 *
 ********************************************************************************************/
 
-#include <list>
+#include <chrono>
 
 #include "raylib-cpp.hpp"
 
-// This is the maximum amount of elements (quads) per batch
-// NOTE: This value is defined in [rlgl] module and can be changed there
-#define MAX_BATCH_ELEMENTS  8192
-
-class Bunny {
- public:
-    Bunny() {
-        position = GetMousePosition();
-        speed.x = static_cast<float>(GetRandomValue(-250, 250)) / 60.0f;
-        speed.y = static_cast<float>(GetRandomValue(-250, 250)) / 60.0f;
-        color = raylib::Color(
-                GetRandomValue(50, 240),
-                GetRandomValue(80, 240),
-                GetRandomValue(100, 240));
-    }
-
-    void Update(const raylib::Texture2D& texBunny) {
-        position.x += speed.x;
-        position.y += speed.y;
-
-        if (((position.x + texBunny.width/2) > GetScreenWidth()) ||
-            ((position.x + texBunny.width/2) < 0)) speed.x *= -1;
-        if (((position.y + texBunny.height/2) > GetScreenHeight()) ||
-            ((position.y + texBunny.height/2 - 40) < 0)) speed.y *= -1;
-    }
-
-    Vector2 position;
-    Vector2 speed;
-    Color color;
-};
-
 int main(void)
 {
     // Initialization
@@ -56,7 +25,17 @@ int main(void)
     // Load bunny texture
     raylib::Texture2D texBunny("resources/wabbit_alpha.png");
 
-    std::list<Bunny> bunnies;
+    // Bunny positions, speeds and colors, each in its own contiguous array
+    raylib::Particles bunnies(100000);
+
+    // Bunny positions that keep their centers on screen, below the header
+    const raylib::Rectangle bounds(
+        -static_cast<float>(texBunny.width)/2, 40 - static_cast<float>(texBunny.height)/2,
+        static_cast<float>(screenWidth), static_cast<float>(screenHeight - 40));
+
+    // Collects the bunnies into one vertex buffer, and sends it to rlgl in a few long runs
+    raylib::SpriteBatch batch(raylib::SpriteBatch::Mode::Render, 100000);
+    float spritesPerMs = 0.0f;
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -68,15 +47,17 @@ int main(void)
         if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) {
             // Create more bunnies
             for (int i = 0; i < 100; i++) {
-                bunnies.emplace_back();
+                bunnies.Add(
+                    GetMousePosition(),
+                    raylib::Vector2(
+                        static_cast<float>(GetRandomValue(-250, 250)) / 60.0f,
+                        static_cast<float>(GetRandomValue(-250, 250)) / 60.0f),
+                    raylib::Color(GetRandomValue(50, 240), GetRandomValue(80, 240), GetRandomValue(100, 240)));
             }
         }
 
-        // Update bunnies
-
-        for (Bunny& bunny: bunnies) {
-            bunny.Update(texBunny);
-        }
+        // Update bunnies, several lanes at a time, without asking for the screen size per bunny
+        bunnies.Update(1.0f, bounds);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -85,19 +66,20 @@ int main(void)
         {
             window.ClearBackground(RAYWHITE);
 
-            for (Bunny& bunny : bunnies) {
-                // NOTE: When internal batch buffer limit is reached (MAX_BATCH_ELEMENTS),
-                // a draw call is launched and buffer starts being filled again;
-                // before issuing a draw call, updated vertex data from internal CPU buffer is send to GPU...
-                // Process of sending data is costly and it could happen that GPU data has not been completely
-                // processed for drawing while new data is tried to be sent (updating current in-use buffers)
-                // it could generates a stall and consequently a frame drop, limiting the number of drawn bunnies
-                texBunny.Draw(bunny.position, bunny.color);
+            // NOTE: Instead of one texBunny.Draw() per bunny, which checks rlgl's batch limit for every quad,
+            // the sprite batch checks it once per run of quads that fits into rlgl's vertex buffer
+            const auto start = std::chrono::steady_clock::now();
+            batch.Begin();
+            bunnies.Draw(batch, texBunny);
+            batch.End();
+            const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            if (!bunnies.IsEmpty() && elapsed.count() > 0.0f) {
+                spritesPerMs = static_cast<float>(bunnies.GetCount()) / elapsed.count();
             }
 
             DrawRectangle(0, 0, screenWidth, 40, BLACK);
-            raylib::DrawText(TextFormat("bunnies: %i", bunnies.size()), 120, 10, 20, GREEN);
-            raylib::DrawText(TextFormat("batched draw calls: %i", 1 + bunnies.size()/MAX_BATCH_ELEMENTS), 320, 10, 20, MAROON);
+            raylib::DrawText(TextFormat("bunnies: %i", static_cast<int>(bunnies.GetCount())), 120, 10, 20, GREEN);
+            raylib::DrawText(TextFormat("sprites per ms: %.0f", spritesPerMs), 320, 10, 20, MAROON);
 
             DrawFPS(10, 10);
         }
@@ -0,0 +1,828 @@
+#ifndef RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
+#define RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./BoundingBox.hpp"
+#include "./Frustum.hpp"
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Dynamic bounding volume tree over moving BoundingBoxes, as the broadphase for 3D objects.
+ *
+ * Each proxy is a leaf holding its box and a fat copy grown by a margin. Moving a proxy within its fat box only stores
+ * the new box; otherwise the leaf is taken out and inserted again next to the sibling that grows the tree's surface
+ * area the least, refitting and rotating its ancestors to keep the tree balanced. Queries test the fat boxes on the
+ * way down, and the exact boxes at the leaves, with the same tests as raylib: CheckCollisionBoxes(),
+ * CheckCollisionBoxSphere() and GetRayCollisionBox().
+ *
+ * @code
+ * raylib::AABBTree tree;
+ * raylib::AABBTree::Handle handle = tree.Add(model.GetBoundingBox());
+ * // After moving or animating the model
+ * tree.Move(handle, model.GetBoundingBox());
+ * for (auto [a, b] : tree.GetPairs()) {
+ *     // ...
+ * }
+ * @endcode
+ */
+class AABBTree {
+public:
+    /** The index of a proxy's leaf node, which goes back on the free list when the proxy is removed */
+    using Handle = std::uint32_t;
+    /** The leaves of two proxies whose boxes overlap, ordered like SpatialHash::Pair */
+    using Pair = std::pair<Handle, Handle>;
+
+    /**
+     * The closest proxy a ray hits.
+     */
+    struct RayHit {
+        /** Invalid when the ray hits nothing */
+        Handle handle;
+        ::RayCollision collision;
+    };
+
+    static constexpr Handle Invalid = std::numeric_limits<Handle>::max();
+    /** Candidate split planes per axis in Rebuild() */
+    static constexpr int Bins = 16;
+
+    /**
+     * @param margin How far fat boxes reach past the boxes of their proxies, in world units.
+     */
+    explicit AABBTree(float margin = 0.1f) : margin(margin) {
+        if (!(margin >= 0.0f) || !std::isfinite(margin)) {
+            throw RaylibException("AABB tree margin must not be negative");
+        }
+    }
+
+    GETTER(float, Margin, margin)
+
+    /**
+     * Retrieve the number of proxies.
+     */
+    [[nodiscard]] std::size_t GetCount() const { return count; }
+
+    [[nodiscard]] bool IsEmpty() const { return count == 0; }
+
+    /**
+     * Retrieve the height of the tree, 0 for a single leaf.
+     */
+    [[nodiscard]] int GetHeight() const { return root == Invalid ? 0 : nodes[root].height; }
+
+    /**
+     * Check whether a handle is the leaf of a proxy, rather than an inner or a free node.
+     */
+    [[nodiscard]] bool IsValid(Handle handle) const {
+        return handle < nodes.size() && nodes[handle].height == 0 && nodes[handle].left == Leaf;
+    }
+
+    /**
+     * Add a proxy.
+     *
+     * @return The handle of the new proxy.
+     */
+    Handle Add(const ::BoundingBox& box) {
+        const Handle leaf = Allocate();
+        Node& node = nodes[leaf];
+        node.box = box;
+        node.fat = Grow(box, margin);
+        node.left = Leaf;
+        node.height = 0;
+        Insert(leaf);
+        count++;
+        return leaf;
+    }
+
+    /**
+     * Take a proxy's leaf out of the tree. The next Add() may reuse the node.
+     */
+    void Remove(Handle handle) {
+        Check(handle);
+        Extract(handle);
+        Free(handle);
+        count--;
+    }
+
+    /**
+     * Drop every node, leaving an empty tree with the node array's capacity.
+     */
+    void Clear() {
+        nodes.clear();
+        freeNode = Invalid;
+        root = Invalid;
+        count = 0;
+    }
+
+    /**
+     * Move a proxy to a new box. The fat box is extended along `displacement`, the expected movement until the next
+     * update, so proxies moving steadily are reinserted less often.
+     *
+     * @return Whether the proxy was reinserted, rather than still fitting its fat box.
+     */
+    bool Move(Handle handle, const ::BoundingBox& box, ::Vector3 displacement = {0.0f, 0.0f, 0.0f}) {
+        Check(handle);
+        Node& node = nodes[handle];
+        // Keep the fat box while it holds the new box and is not much larger than a fresh one would be.
+        if (Contains(node.fat, box) && Contains(Grow(box, margin * 4.0f + Length(displacement)), node.fat)) {
+            node.box = box;
+            return false;
+        }
+        Extract(handle);
+        ::BoundingBox fat = Grow(box, margin);
+        (displacement.x < 0.0f ? fat.min.x : fat.max.x) += displacement.x;
+        (displacement.y < 0.0f ? fat.min.y : fat.max.y) += displacement.y;
+        (displacement.z < 0.0f ? fat.min.z : fat.max.z) += displacement.z;
+        nodes[handle].box = box;
+        nodes[handle].fat = fat;
+        Insert(handle);
+        return true;
+    }
+
+    /**
+     * Build the tree again from the fat boxes of the proxies, top down, splitting where the surface area heuristic
+     * says queries are cheapest. Handles and fat boxes stay the same. Inserting proxies one at a time gives a looser
+     * tree than building it at once, so this is worth calling after adding many proxies, or every so often.
+     */
+    void Rebuild() {
+        std::vector<Handle> leaves;
+        leaves.reserve(count);
+        for (Handle handle = 0; handle < nodes.size(); handle++) {
+            if (nodes[handle].height > 0) {
+                Free(handle);
+            } else if (nodes[handle].height == 0) {
+                leaves.push_back(handle);
+            }
+        }
+        root = leaves.empty() ? Invalid : Build(leaves.data(), leaves.size());
+        if (root != Invalid) {
+            nodes[root].parent = Invalid;
+        }
+    }
+
+    /**
+     * Retrieve the box of a proxy.
+     */
+    [[nodiscard]] BoundingBox Get(Handle handle) const {
+        Check(handle);
+        return nodes[handle].box;
+    }
+
+    /**
+     * Retrieve the fat box of a proxy, which the tree is built from.
+     */
+    [[nodiscard]] BoundingBox GetFatBox(Handle handle) const {
+        Check(handle);
+        return nodes[handle].fat;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy overlapping a box.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(const ::BoundingBox& box, F&& fn) const {
+        Search([&box](const ::BoundingBox& node) { return Overlaps(node, box); }, fn);
+    }
+
+    /**
+     * Find the proxies overlapping a box.
+     */
+    [[nodiscard]] std::vector<Handle> Query(const ::BoundingBox& box) const {
+        std::vector<Handle> found;
+        Query(box, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy overlapping a sphere.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(::Vector3 center, float radius, F&& fn) const {
+        // Slightly larger for the inner nodes, so rounding never prunes a leaf that CheckCollisionBoxSphere() hits.
+        const float reach = radius * (1.0f + 1e-5f) + 1e-5f;
+        Search(
+            [center, reach](const ::BoundingBox& node) { return DistanceSquared(node, center) <= reach * reach; },
+            [center, radius](const ::BoundingBox& box) { return ::CheckCollisionBoxSphere(box, center, radius); },
+            fn);
+    }
+
+    /**
+     * Find the proxies overlapping a sphere.
+     */
+    [[nodiscard]] std::vector<Handle> Query(::Vector3 center, float radius) const {
+        std::vector<Handle> found;
+        Query(center, radius, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy that may be visible in a frustum. Subtrees entirely inside it are reported
+     * without testing their leaves.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(const Frustum& frustum, F&& fn) const {
+        if (root == Invalid) {
+            return;
+        }
+        Stack<Handle> stack;
+        stack.Push(root);
+        while (!stack.IsEmpty()) {
+            const Handle handle = stack.Pop();
+            const Node& node = nodes[handle];
+            if (node.left == Leaf) {
+                if (frustum.CheckCollision(node.box)) {
+                    fn(handle);
+                }
+            } else if (frustum.Contains(node.fat)) {
+                ForEachLeaf(handle, fn);
+            } else if (frustum.CheckCollision(node.fat)) {
+                stack.Push(node.right);
+                stack.Push(node.left);
+            }
+        }
+    }
+
+    /**
+     * Find the proxies that may be visible in a frustum.
+     */
+    [[nodiscard]] std::vector<Handle> Query(const Frustum& frustum) const {
+        std::vector<Handle> found;
+        Query(frustum, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(handle, collision)` for every proxy a ray hits within a distance, in no particular order.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle, const ::RayCollision&>
+    void Query(const ::Ray& ray, float maxDistance, F&& fn) const {
+        Trace(ray, maxDistance, [&fn](Handle handle, const ::RayCollision& collision, float&) {
+            fn(handle, collision);
+        });
+    }
+
+    /**
+     * Find the closest proxy a ray hits within a distance. Hits are the ones GetRayCollisionBox() finds on the boxes
+     * of the proxies, in front of the ray.
+     */
+    [[nodiscard]] RayHit GetCollision(
+        const ::Ray& ray,
+        float maxDistance = std::numeric_limits<float>::infinity()) const {
+        RayHit closest{Invalid, {}};
+        Trace(ray, maxDistance, [&closest](Handle handle, const ::RayCollision& collision, float& limit) {
+            if (closest.handle == Invalid || collision.distance < closest.collision.distance) {
+                closest = {handle, collision};
+                limit = collision.distance;
+            }
+        });
+        return closest;
+    }
+
+    /**
+     * Call `fn(a, b)` for every two leaves whose boxes overlap, once each, with `a < b`.
+     */
+    template<typename F>
+    void ForEachPair(F&& fn) const {
+        PairsOf(0, nodes.size(), fn);
+    }
+
+    /**
+     * Collect what ForEachPair() finds.
+     */
+    [[nodiscard]] std::vector<Pair> GetPairs() const {
+        std::vector<Pair> pairs;
+        ForEachPair([&pairs](Handle a, Handle b) { pairs.emplace_back(a, b); });
+        return pairs;
+    }
+
+    /**
+     * Find every pair of overlapping proxies, with chunks of the nodes each querying the tree for their leaves on a
+     * thread pool, and joined as ThreadPool::ParallelCollect() does.
+     */
+    [[nodiscard]] std::vector<Pair> GetPairs(ThreadPool& pool, std::size_t grain = 1024) const {
+        std::vector<Pair> pairs;
+        pool.ParallelCollect(0, nodes.size(), grain, pairs, [this](std::size_t begin, std::size_t end, auto& out) {
+            PairsOf(begin, end, [&out](Handle a, Handle b) { out.emplace_back(a, b); });
+        });
+        return pairs;
+    }
+protected:
+    /** The left child of a leaf, and of a free node */
+    static constexpr Handle Leaf = Invalid;
+
+    struct Node {
+        /** The box of a leaf's proxy */
+        ::BoundingBox box;
+        /** The fat box of a leaf, or the union of the children of an inner node */
+        ::BoundingBox fat;
+        /** The parent, or the next free node */
+        Handle parent;
+        Handle left;
+        Handle right;
+        /** 0 for leaves, -1 for free nodes */
+        int height;
+    };
+
+    /**
+     * Traversal stack, on the stack unless the tree is far deeper than balancing lets it get.
+     */
+    template<typename T>
+    struct Stack {
+        std::array<T, 64> items;
+        std::vector<T> spill;
+        std::size_t size{0};
+
+        [[nodiscard]] bool IsEmpty() const { return size == 0; }
+
+        void Push(T item) {
+            if (size < items.size()) {
+                items[size] = item;
+            } else {
+                spill.push_back(item);
+            }
+            size++;
+        }
+
+        T Pop() {
+            size--;
+            if (size < items.size()) {
+                return items[size];
+            }
+            const T item = spill.back();
+            spill.pop_back();
+            return item;
+        }
+    };
+
+    float margin;
+    std::size_t count{0};
+    std::vector<Node> nodes;
+    Handle freeNode{Invalid};
+    Handle root{Invalid};
+
+    void Check(Handle handle) const {
+        if (!IsValid(handle)) {
+            throw RaylibException("Invalid AABB tree handle");
+        }
+    }
+
+    static ::BoundingBox Grow(const ::BoundingBox& box, float amount) {
+        return {
+            {box.min.x - amount, box.min.y - amount, box.min.z - amount},
+            {box.max.x + amount, box.max.y + amount, box.max.z + amount}};
+    }
+
+    static ::BoundingBox Union(const ::BoundingBox& a, const ::BoundingBox& b) {
+        return {
+            {std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)},
+            {std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z)}};
+    }
+
+    static bool Contains(const ::BoundingBox& outer, const ::BoundingBox& inner) {
+        return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+               outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+    }
+
+    /**
+     * CheckCollisionBoxes(), inline: boxes that touch overlap.
+     */
+    static bool Overlaps(const ::BoundingBox& a, const ::BoundingBox& b) {
+        return a.max.x >= b.min.x && a.min.x <= b.max.x && a.max.y >= b.min.y && a.min.y <= b.max.y &&
+               a.max.z >= b.min.z && a.min.z <= b.max.z;
+    }
+
+    static float Area(const ::BoundingBox& box) {
+        const float x = box.max.x - box.min.x;
+        const float y = box.max.y - box.min.y;
+        const float z = box.max.z - box.min.z;
+        return 2.0f * (x * y + y * z + z * x);
+    }
+
+    static float Length(::Vector3 v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+
+    static float DistanceSquared(const ::BoundingBox& box, ::Vector3 point) {
+        const float x = std::max({box.min.x - point.x, 0.0f, point.x - box.max.x});
+        const float y = std::max({box.min.y - point.y, 0.0f, point.y - box.max.y});
+        const float z = std::max({box.min.z - point.z, 0.0f, point.z - box.max.z});
+        return x * x + y * y + z * z;
+    }
+
+    Handle Allocate() {
+        if (freeNode == Invalid) {
+            if (nodes.size() >= Invalid - 1) {
+                throw RaylibException("AABB tree is full");
+            }
+            nodes.emplace_back();
+            return static_cast<Handle>(nodes.size() - 1);
+        }
+        const Handle handle = freeNode;
+        freeNode = nodes[handle].parent;
+        return handle;
+    }
+
+    void Free(Handle handle) {
+        Node& node = nodes[handle];
+        node.parent = freeNode;
+        node.left = Leaf;
+        node.height = -1;
+        freeNode = handle;
+    }
+
+    /**
+     * Insert a leaf next to the node that grows the total surface area of the tree the least.
+     */
+    void Insert(Handle leaf) {
+        if (root == Invalid) {
+            root = leaf;
+            nodes[leaf].parent = Invalid;
+            return;
+        }
+
+        // Branch and bound over the tree for the sibling that adds the least surface area: the new parent's, plus
+        // what every ancestor grows by. Going down only adds to the growth of the ancestors, which bounds a subtree.
+        const ::BoundingBox box = nodes[leaf].fat;
+        const float leafArea = Area(box);
+        Handle sibling = root;
+        float bestCost = Area(Union(nodes[root].fat, box));
+        Stack<std::pair<Handle, float>> stack;
+        stack.Push({root, 0.0f});
+        while (!stack.IsEmpty()) {
+            const auto [handle, inherited] = stack.Pop();
+            const Node& node = nodes[handle];
+            const float combined = Area(Union(node.fat, box));
+            if (combined + inherited < bestCost) {
+                bestCost = combined + inherited;
+                sibling = handle;
+            }
+            const float growth = inherited + combined - Area(node.fat);
+            if (node.left == Leaf || leafArea + growth >= bestCost) {
+                continue;
+            }
+            // The child that grows less comes off first, so the bound tightens early.
+            const float left = Area(Union(nodes[node.left].fat, box)) - Area(nodes[node.left].fat);
+            const float right = Area(Union(nodes[node.right].fat, box)) - Area(nodes[node.right].fat);
+            stack.Push({left < right ? node.right : node.left, growth});
+            stack.Push({left < right ? node.left : node.right, growth});
+        }
+
+        const Handle oldParent = nodes[sibling].parent;
+        const Handle newParent = Allocate();
+        Node& parent = nodes[newParent];
+        parent.parent = oldParent;
+        parent.fat = Union(box, nodes[sibling].fat);
+        parent.height = nodes[sibling].height + 1;
+        parent.left = sibling;
+        parent.right = leaf;
+        if (oldParent == Invalid) {
+            root = newParent;
+        } else if (nodes[oldParent].left == sibling) {
+            nodes[oldParent].left = newParent;
+        } else {
+            nodes[oldParent].right = newParent;
+        }
+        nodes[sibling].parent = newParent;
+        nodes[leaf].parent = newParent;
+        Refit(newParent);
+    }
+
+    /**
+     * Take a leaf out of the tree, replacing its parent with its sibling.
+     */
+    void Extract(Handle leaf) {
+        if (leaf == root) {
+            root = Invalid;
+            return;
+        }
+        const Handle parent = nodes[leaf].parent;
+        const Handle grandParent = nodes[parent].parent;
+        const Handle sibling = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+        Free(parent);
+        nodes[sibling].parent = grandParent;
+        if (grandParent == Invalid) {
+            root = sibling;
+            return;
+        }
+        if (nodes[grandParent].left == parent) {
+            nodes[grandParent].left = sibling;
+        } else {
+            nodes[grandParent].right = sibling;
+        }
+        Refit(grandParent);
+    }
+
+    /**
+     * Rebalance and recompute the boxes and heights from a node up to the root.
+     */
+    void Refit(Handle index) {
+        while (index != Invalid) {
+            index = Balance(index);
+            Node& node = nodes[index];
+            node.height = 1 + std::max(nodes[node.left].height, nodes[node.right].height);
+            node.fat = Union(nodes[node.left].fat, nodes[node.right].fat);
+            index = node.parent;
+        }
+    }
+
+    /**
+     * Rotate the taller grandchild up when the children of a node differ in height by more than one.
+     *
+     * @return The node now in its place.
+     */
+    Handle Balance(Handle a) {
+        if (nodes[a].left == Leaf || nodes[a].height < 2) {
+            return a;
+        }
+        const Handle b = nodes[a].left;
+        const Handle c = nodes[a].right;
+        const int balance = nodes[c].height - nodes[b].height;
+        if (balance > 1) {
+            return Rotate(a, c, b, true);
+        }
+        if (balance < -1) {
+            return Rotate(a, b, c, false);
+        }
+        return a;
+    }
+
+    /**
+     * Move `up`, a child of `a`, into the place of `a`, and give `a` the shorter child of `up`.
+     */
+    Handle Rotate(Handle a, Handle up, Handle other, bool upIsRight) {
+        const Handle f = nodes[up].left;
+        const Handle g = nodes[up].right;
+        const Handle parent = nodes[a].parent;
+
+        nodes[up].left = a;
+        nodes[up].parent = parent;
+        nodes[a].parent = up;
+        if (parent == Invalid) {
+            root = up;
+        } else if (nodes[parent].left == a) {
+            nodes[parent].left = up;
+        } else {
+            nodes[parent].right = up;
+        }
+
+        const bool keepF = nodes[f].height > nodes[g].height;
+        const Handle kept = keepF ? f : g;
+        const Handle given = keepF ? g : f;
+        nodes[up].right = kept;
+        (upIsRight ? nodes[a].right : nodes[a].left) = given;
+        nodes[given].parent = a;
+
+        nodes[a].fat = Union(nodes[other].fat, nodes[given].fat);
+        nodes[a].height = 1 + std::max(nodes[other].height, nodes[given].height);
+        nodes[up].fat = Union(nodes[a].fat, nodes[kept].fat);
+        nodes[up].height = 1 + std::max(nodes[a].height, nodes[kept].height);
+        return up;
+    }
+
+    static ::Vector3 Center(const ::BoundingBox& box) {
+        return {(box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f};
+    }
+
+    static float Axis(::Vector3 v, int axis) { return axis == 0 ? v.x : (axis == 1 ? v.y : v.z); }
+
+    /**
+     * Build the subtree of some leaves, with binned surface area heuristic splits, and return its root.
+     */
+    Handle Build(Handle* leaves, std::size_t size) {
+        if (size == 1) {
+            return leaves[0];
+        }
+
+        ::BoundingBox centers{Center(nodes[leaves[0]].fat), Center(nodes[leaves[0]].fat)};
+        for (std::size_t i = 1; i < size; i++) {
+            const ::Vector3 center = Center(nodes[leaves[i]].fat);
+            centers = Union(centers, {center, center});
+        }
+
+        struct Bin {
+            ::BoundingBox box;
+            std::size_t count;
+        };
+        float bestCost = std::numeric_limits<float>::infinity();
+        int bestAxis = -1;
+        int bestBin = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            const float low = Axis(centers.min, axis);
+            const float extent = Axis(centers.max, axis) - low;
+            if (!(extent > 0.0f)) {
+                continue;
+            }
+            std::array<Bin, Bins> bins{};
+            const float scale = static_cast<float>(Bins) / extent;
+            for (std::size_t i = 0; i < size; i++) {
+                const ::BoundingBox& fat = nodes[leaves[i]].fat;
+                const int index = std::min(Bins - 1, static_cast<int>((Axis(Center(fat), axis) - low) * scale));
+                Bin& bin = bins[static_cast<std::size_t>(index)];
+                bin.box = bin.count == 0 ? fat : Union(bin.box, fat);
+                bin.count++;
+            }
+
+            // Sweep from the right, then from the left, pricing each plane between two bins.
+            std::array<float, Bins - 1> rightCost{};
+            ::BoundingBox right{};
+            std::size_t rightCount = 0;
+            for (int i = Bins - 1; i > 0; i--) {
+                const Bin& bin = bins[static_cast<std::size_t>(i)];
+                if (bin.count > 0) {
+                    right = rightCount == 0 ? bin.box : Union(right, bin.box);
+                    rightCount += bin.count;
+                }
+                rightCost[static_cast<std::size_t>(i - 1)] = Area(right) * static_cast<float>(rightCount);
+            }
+            ::BoundingBox left{};
+            std::size_t leftCount = 0;
+            for (int i = 0; i < Bins - 1; i++) {
+                const Bin& bin = bins[static_cast<std::size_t>(i)];
+                if (bin.count > 0) {
+                    left = leftCount == 0 ? bin.box : Union(left, bin.box);
+                    leftCount += bin.count;
+                }
+                if (leftCount == 0 || leftCount == size) {
+                    continue;
+                }
+                const float cost = Area(left) * static_cast<float>(leftCount) + rightCost[static_cast<std::size_t>(i)];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        Handle* middle = leaves + size / 2;
+        if (bestAxis < 0) {
+            // Boxes whose centers all coincide can't be told apart, so they are halved in handle order.
+        } else {
+            const float low = Axis(centers.min, bestAxis);
+            const float scale = static_cast<float>(Bins) / (Axis(centers.max, bestAxis) - low);
+            middle = std::partition(leaves, leaves + size, [&](Handle leaf) {
+                const float center = Axis(Center(nodes[leaf].fat), bestAxis);
+                return std::min(Bins - 1, static_cast<int>((center - low) * scale)) <= bestBin;
+            });
+        }
+
+        const auto split = static_cast<std::size_t>(middle - leaves);
+        const Handle left = Build(leaves, split);
+        const Handle right = Build(middle, size - split);
+        const Handle parent = Allocate();
+        Node& node = nodes[parent];
+        node.left = left;
+        node.right = right;
+        node.fat = Union(nodes[left].fat, nodes[right].fat);
+        node.height = 1 + std::max(nodes[left].height, nodes[right].height);
+        nodes[left].parent = parent;
+        nodes[right].parent = parent;
+        return parent;
+    }
+
+    template<typename F>
+    void ForEachLeaf(Handle index, F& fn) const {
+        Stack<Handle> stack;
+        stack.Push(index);
+        while (!stack.IsEmpty()) {
+            const Handle handle = stack.Pop();
+            const Node& node = nodes[handle];
+            if (node.left == Leaf) {
+                fn(handle);
+            } else {
+                stack.Push(node.right);
+                stack.Push(node.left);
+            }
+        }
+    }
+
+    /**
+     * Call `fn(handle)` for the leaves whose fat boxes lead there and whose boxes pass a test.
+     */
+    template<typename Test, typename F>
+    void Search(Test&& test, F& fn) const {
+        Search(test, test, fn);
+    }
+
+    template<typename Inner, typename Test, typename F>
+    void Search(Inner&& inner, Test&& test, F& fn) const {
+        if (root == Invalid) {
+            return;
+        }
+        Stack<Handle> stack;
+        stack.Push(root);
+        while (!stack.IsEmpty()) {
+            const Handle handle = stack.Pop();
+            const Node& node = nodes[handle];
+            if (!inner(node.fat)) {
+                continue;
+            }
+            if (node.left == Leaf) {
+                if (test(node.box)) {
+                    fn(handle);
+                }
+            } else {
+                stack.Push(node.right);
+                stack.Push(node.left);
+            }
+        }
+    }
+
+    /**
+     * Call `fn(handle, collision, limit)` for the leaves a ray hits within `limit`, nearer children first. `fn` may
+     * lower `limit` to prune further nodes.
+     */
+    template<typename F>
+    void Trace(const ::Ray& ray, float limit, F&& fn) const {
+        if (root == Invalid) {
+            return;
+        }
+        auto inverse = [](float d) { return d != 0.0f ? 1.0f / d : (std::signbit(d) ? -FLT_MAX : FLT_MAX); };
+        const ::Vector3 invDir{inverse(ray.direction.x), inverse(ray.direction.y), inverse(ray.direction.z)};
+        // Where the ray enters a fat box, or infinity when it misses. The exit is widened a little so rounding
+        // never prunes a box that GetRayCollisionBox() hits.
+        auto enter = [&ray, invDir](const ::BoundingBox& box) {
+            const float x1 = (box.min.x - ray.position.x) * invDir.x;
+            const float x2 = (box.max.x - ray.position.x) * invDir.x;
+            const float y1 = (box.min.y - ray.position.y) * invDir.y;
+            const float y2 = (box.max.y - ray.position.y) * invDir.y;
+            const float z1 = (box.min.z - ray.position.z) * invDir.z;
+            const float z2 = (box.max.z - ray.position.z) * invDir.z;
+            const float entry = std::max({std::min(x1, x2), std::min(y1, y2), std::min(z1, z2), 0.0f});
+            const float exit = std::min({std::max(x1, x2), std::max(y1, y2), std::max(z1, z2)});
+            return entry <= exit * (1.0f + 4.0f * FLT_EPSILON) + FLT_EPSILON ? entry
+                                                                              : std::numeric_limits<float>::infinity();
+        };
+
+        Stack<Handle> stack;
+        stack.Push(root);
+        while (!stack.IsEmpty()) {
+            const Handle handle = stack.Pop();
+            const Node& node = nodes[handle];
+            // Checked when popped, as the limit may have dropped since the node was pushed.
+            if (enter(node.fat) > limit) {
+                continue;
+            }
+            if (node.left == Leaf) {
+                const ::RayCollision collision = ::GetRayCollisionBox(ray, node.box);
+                if (collision.hit && collision.distance >= 0.0f && collision.distance <= limit) {
+                    fn(handle, collision, limit);
+                }
+                continue;
+            }
+            float leftEntry = enter(nodes[node.left].fat);
+            float rightEntry = enter(nodes[node.right].fat);
+            Handle closer = node.left;
+            Handle further = node.right;
+            if (rightEntry < leftEntry) {
+                std::swap(leftEntry, rightEntry);
+                std::swap(closer, further);
+            }
+            // The closer child is pushed last, so it comes off first.
+            if (rightEntry <= limit) {
+                stack.Push(further);
+            }
+            if (leftEntry <= limit) {
+                stack.Push(closer);
+            }
+        }
+    }
+
+    /**
+     * Report the overlapping pairs of the proxies in [begin, end), each from its lower handle.
+     */
+    template<typename F>
+    void PairsOf(std::size_t begin, std::size_t end, F&& fn) const {
+        for (std::size_t i = begin; i < end; i++) {
+            const Handle self = static_cast<Handle>(i);
+            const Node& node = nodes[i];
+            if (node.height != 0 || node.left != Leaf) {
+                continue;
+            }
+            auto report = [&fn, self](Handle other) {
+                if (other > self) {
+                    fn(self, other);
+                }
+            };
+            Search([&node](const ::BoundingBox& box) { return Overlaps(box, node.box); }, report);
+        }
+    }
+};
+} // namespace raylib
+
+using RAABBTree = raylib::AABBTree;
+
+#endif // RAYLIB_CPP_INCLUDE_AABBTREE_HPP_
@@ -0,0 +1,276 @@
+#ifndef RAYLIB_CPP_INCLUDE_ALLOCATOR_HPP_
+#define RAYLIB_CPP_INCLUDE_ALLOCATOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Statistics of an Allocator, in bytes of whole blocks.
+ */
+struct AllocatorStats {
+    /** Bytes handed out, and not released yet */
+    std::size_t bytesInUse{0};
+
+    /** Highest bytesInUse seen */
+    std::size_t highWaterMark{0};
+
+    /** Bytes of released blocks, kept for reuse */
+    std::size_t bytesCached{0};
+
+    /** Blocks handed out, and not released yet */
+    std::size_t allocationCount{0};
+
+    /** Blocks handed out since the allocator was created */
+    std::size_t totalAllocations{0};
+
+    /** Allocations served from a cached block */
+    std::size_t reusedAllocations{0};
+};
+
+/**
+ * Allocates the pixel, sample and vertex buffers of raylib::Image, raylib::Wave and raylib::MeshUnmanaged.
+ *
+ * Blocks must come from raylib's MemAlloc(), so that raylib functions which replace a buffer can still free it.
+ * Only buffers a wrapper owns come from the allocator. Buffers handed to the caller as raw raylib structs, which get
+ * freed by raylib without the allocator knowing, use AllocateRaylibBuffer() instead.
+ *
+ * @see raylib::SetBufferAllocator()
+ */
+class Allocator {
+public:
+    virtual ~Allocator() = default;
+
+    /**
+     * Allocate an uninitialized block of at least `size` bytes, or return nullptr.
+     */
+    virtual void* Allocate(std::size_t size) = 0;
+
+    /**
+     * Take back a block from Allocate(). Returns false if the block did not come from this allocator.
+     */
+    virtual bool Release(void* data) = 0;
+
+    /**
+     * Stop tracking a block from Allocate() that was freed by raylib.
+     */
+    virtual void Forget(void* data) = 0;
+
+    /**
+     * Retrieve the allocator statistics.
+     */
+    [[nodiscard]] virtual AllocatorStats GetStats() const = 0;
+};
+
+namespace detail {
+inline std::atomic<Allocator*>& CurrentAllocator() {
+    static std::atomic<Allocator*> allocator{nullptr};
+    return allocator;
+}
+} // namespace detail
+
+/**
+ * Set the allocator used for new Image, Wave and Mesh buffers, or nullptr to use raylib's MemAlloc().
+ *
+ * The allocator must outlive the buffers it allocates, or be destroyed first, which resets it to nullptr.
+ */
+inline void SetBufferAllocator(Allocator* allocator) { detail::CurrentAllocator() = allocator; }
+
+/**
+ * Get the allocator used for new Image, Wave and Mesh buffers, or nullptr if raylib's MemAlloc() is used.
+ */
+inline Allocator* GetBufferAllocator() { return detail::CurrentAllocator(); }
+
+/**
+ * Allocate an uninitialized buffer with raylib's MemAlloc(), for a buffer that raylib's Unload functions will free.
+ */
+inline void* AllocateRaylibBuffer(std::size_t size) {
+    return size <= UINT_MAX ? ::MemAlloc(static_cast<unsigned int>(size)) : nullptr;
+}
+
+/**
+ * Allocate an uninitialized buffer from the current allocator, or with raylib's MemAlloc(). The buffer must stay with
+ * a wrapper that gives it back with ReleaseBuffer().
+ */
+inline void* AllocateBuffer(std::size_t size) {
+    if (Allocator* allocator = GetBufferAllocator()) {
+        return allocator->Allocate(size);
+    }
+    return AllocateRaylibBuffer(size);
+}
+
+/**
+ * Return a buffer to the current allocator. Returns false if it's not one of the allocator's buffers, and should be
+ * unloaded by raylib instead.
+ */
+inline bool ReleaseBuffer(void* data) {
+    Allocator* allocator = GetBufferAllocator();
+    return data != nullptr && allocator != nullptr && allocator->Release(data);
+}
+
+/**
+ * Tell the current allocator that a raylib function has freed one of its buffers, like ImageResize() does when it
+ * replaces the image data.
+ */
+inline void ForgetBuffer(void* data) {
+    Allocator* allocator = GetBufferAllocator();
+    if (data != nullptr && allocator != nullptr) {
+        allocator->Forget(data);
+    }
+}
+
+/**
+ * Call `fn`, a raylib function that may free `data` and replace it, like ImageFormat() does, and forget the previous
+ * buffer if it was replaced.
+ */
+template<typename T, typename F>
+void ReplaceBuffer(T* const& data, F fn) {
+    T* const previous = data;
+    fn();
+    if (data != previous) {
+        ForgetBuffer(previous);
+    }
+}
+
+/**
+ * Size-class pool allocator.
+ *
+ * Requests are rounded up to a size class, four per power of two, and released blocks are kept in a free list per
+ * class for the next allocation of that class. This avoids heap churn when buffers of similar sizes are created and
+ * unloaded over and over. Thread-safe.
+ */
+class PoolAllocator : public Allocator {
+public:
+    /**
+     * @param maxCachedBytes Most bytes of released blocks to keep for reuse. Blocks beyond it are freed.
+     */
+    explicit PoolAllocator(std::size_t maxCachedBytes = 256u * 1024u * 1024u) : maxCachedBytes(maxCachedBytes) { }
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    ~PoolAllocator() override {
+        Allocator* self = this;
+        detail::CurrentAllocator().compare_exchange_strong(self, nullptr);
+        Trim();
+    }
+
+    void* Allocate(std::size_t size) override {
+        const std::size_t blockSize = GetBlockSize(size);
+        if (blockSize > UINT_MAX) {
+            return nullptr;
+        }
+
+        void* data = nullptr;
+        {
+            std::lock_guard lock(mutex);
+            auto it = freeBlocks.find(blockSize);
+            if (it != freeBlocks.end() && !it->second.empty()) {
+                data = it->second.back();
+                it->second.pop_back();
+                stats.bytesCached -= blockSize;
+                stats.reusedAllocations++;
+            }
+        }
+        if (data == nullptr) {
+            data = ::MemAlloc(static_cast<unsigned int>(blockSize));
+            if (data == nullptr) {
+                return nullptr;
+            }
+        }
+
+        std::lock_guard lock(mutex);
+        // A stale entry for this address, left by a raylib function that freed the block without ReplaceBuffer(), is
+        // overwritten.
+        blocks.insert_or_assign(data, blockSize);
+        stats.bytesInUse += blockSize;
+        stats.highWaterMark = std::max(stats.highWaterMark, stats.bytesInUse);
+        stats.allocationCount++;
+        stats.totalAllocations++;
+        return data;
+    }
+
+    bool Release(void* data) override {
+        {
+            std::lock_guard lock(mutex);
+            auto it = blocks.find(data);
+            if (it == blocks.end()) {
+                return false;
+            }
+            const std::size_t blockSize = it->second;
+            blocks.erase(it);
+            stats.bytesInUse -= blockSize;
+            stats.allocationCount--;
+            if (stats.bytesCached + blockSize <= maxCachedBytes) {
+                freeBlocks[blockSize].push_back(data);
+                stats.bytesCached += blockSize;
+                return true;
+            }
+        }
+        ::MemFree(data);
+        return true;
+    }
+
+    void Forget(void* data) override {
+        std::lock_guard lock(mutex);
+        auto it = blocks.find(data);
+        if (it != blocks.end()) {
+            stats.bytesInUse -= it->second;
+            stats.allocationCount--;
+            blocks.erase(it);
+        }
+    }
+
+    [[nodiscard]] AllocatorStats GetStats() const override {
+        std::lock_guard lock(mutex);
+        return stats;
+    }
+
+    /**
+     * Free all cached blocks.
+     */
+    void Trim() {
+        std::unordered_map<std::size_t, std::vector<void*>> cached;
+        {
+            std::lock_guard lock(mutex);
+            cached.swap(freeBlocks);
+            stats.bytesCached = 0;
+        }
+        for (auto& [blockSize, list] : cached) {
+            for (void* data : list) {
+                ::MemFree(data);
+            }
+        }
+    }
+
+    /**
+     * Retrieve the size class of a request: at least 256 bytes, then four classes per power of two.
+     */
+    static std::size_t GetBlockSize(std::size_t size) {
+        if (size <= 256) {
+            return 256;
+        }
+        const std::size_t step = std::bit_floor(size - 1) / 4;
+        return (size + step - 1) / step * step;
+    }
+protected:
+    std::size_t maxCachedBytes;
+    mutable std::mutex mutex;
+    std::unordered_map<void*, std::size_t> blocks;
+    std::unordered_map<std::size_t, std::vector<void*>> freeBlocks;
+    AllocatorStats stats;
+};
+} // namespace raylib
+
+using RAllocator = raylib::Allocator;
+using RPoolAllocator = raylib::PoolAllocator;
+
+#endif // RAYLIB_CPP_INCLUDE_ALLOCATOR_HPP_
@@ -0,0 +1,363 @@
+#ifndef RAYLIB_CPP_INCLUDE_ASSETARCHIVE_HPP_
+#define RAYLIB_CPP_INCLUDE_ASSETARCHIVE_HPP_
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "./FileData.hpp"
+#include "./Font.hpp"
+#include "./Image.hpp"
+#include "./Music.hpp"
+#include "./RaylibException.hpp"
+#include "./Sound.hpp"
+#include "./Wave.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Packed asset archive, read from a single memory-mapped file.
+ *
+ * Entries are served as spans straight into the mapped file, and load through the *FromMemory() functions, so
+ * loading an asset costs no file system calls and no copies. The archive must outlive the spans, and any
+ * raylib::Music loaded from it, which streams from the mapped data.
+ *
+ * The format is little-endian: a 32 byte header, the entry data aligned to 16 bytes, then the table of contents,
+ * sorted by name for binary search.
+ *
+ * | Offset | Header field                 |
+ * |--------|------------------------------|
+ * | 0      | Magic "RPAK"                 |
+ * | 4      | uint32 version, 1            |
+ * | 8      | uint32 entry count           |
+ * | 12     | uint32 reserved, 0           |
+ * | 16     | uint64 table of contents offset |
+ * | 24     | uint64 table of contents size |
+ *
+ * Each table of contents entry is a uint64 data offset, a uint64 data size, a uint32 name length, and the name.
+ *
+ * @see raylib::AssetArchive::Pack()
+ */
+class AssetArchive {
+public:
+    static constexpr std::uint32_t version = 1;
+
+    AssetArchive() = default;
+
+    /**
+     * Open an archive file, mapping it into memory.
+     *
+     * @throws raylib::RaylibException Thrown if the file is not a valid archive.
+     */
+    explicit AssetArchive(const std::string& fileName) { Load(fileName); }
+
+    /**
+     * Open an archive from file data.
+     *
+     * @throws raylib::RaylibException Thrown if the data is not a valid archive.
+     */
+    explicit AssetArchive(FileData&& fileData) { Load(std::move(fileData)); }
+
+    /**
+     * Open an archive file, mapping it into memory.
+     *
+     * @throws raylib::RaylibException Thrown if the file is not a valid archive.
+     */
+    void Load(const std::string& fileName) {
+        Load(FileData(fileName, FileData::Access::Random));
+        if (!IsValid()) {
+            throw RaylibException("Failed to load AssetArchive from " + fileName);
+        }
+    }
+
+    /**
+     * Open an archive from file data.
+     *
+     * @throws raylib::RaylibException Thrown if the data is not a valid archive, leaving the archive as it was.
+     */
+    void Load(FileData&& fileData) {
+        if (fileData.GetData() == nullptr) {
+            Unload();
+            file = std::move(fileData);
+            return;
+        }
+
+        // Parse into locals first, the entries point into the file data and move along with it.
+        std::vector<Entry> parsed;
+        const std::span<const unsigned char> bytes = fileData.GetSpan();
+        if (bytes.size() < headerSize || std::string_view(reinterpret_cast<const char*>(bytes.data()), 4) != "RPAK" ||
+            ReadU32(bytes, 4) != version) {
+            throw RaylibException("Invalid AssetArchive header");
+        }
+        const std::uint32_t count = ReadU32(bytes, 8);
+        const std::uint64_t tocOffset = ReadU64(bytes, 16);
+        const std::uint64_t tocSize = ReadU64(bytes, 24);
+        if (tocOffset > bytes.size() || tocSize > bytes.size() - tocOffset) {
+            throw RaylibException("Invalid AssetArchive table of contents");
+        }
+
+        parsed.reserve(count);
+        std::size_t position = static_cast<std::size_t>(tocOffset);
+        const auto end = static_cast<std::size_t>(tocOffset + tocSize);
+        for (std::uint32_t i = 0; i < count; i++) {
+            if (end - position < 20) {
+                throw RaylibException("Invalid AssetArchive table of contents");
+            }
+            const std::uint64_t offset = ReadU64(bytes, position);
+            const std::uint64_t size = ReadU64(bytes, position + 8);
+            const std::uint32_t nameLength = ReadU32(bytes, position + 16);
+            position += 20;
+            if (nameLength > end - position || offset > bytes.size() || size > bytes.size() - offset) {
+                throw RaylibException("Invalid AssetArchive entry");
+            }
+            parsed.push_back({
+                std::string_view(reinterpret_cast<const char*>(bytes.data() + position), nameLength),
+                bytes.subspan(static_cast<std::size_t>(offset), static_cast<std::size_t>(size))});
+            position += nameLength;
+        }
+        if (!std::is_sorted(parsed.begin(), parsed.end(), NameLess)) {
+            std::sort(parsed.begin(), parsed.end(), NameLess);
+        }
+        file = std::move(fileData);
+        entries = std::move(parsed);
+    }
+
+    /**
+     * Close the archive.
+     */
+    void Unload() {
+        entries.clear();
+        file.Unload();
+    }
+
+    /**
+     * Retrieve whether or not the archive is open.
+     */
+    [[nodiscard]] bool IsValid() const { return file.GetData() != nullptr; }
+
+    /**
+     * Retrieve the number of entries.
+     */
+    [[nodiscard]] std::size_t GetEntryCount() const { return entries.size(); }
+
+    /**
+     * Retrieve the name of an entry, in sorted order.
+     */
+    [[nodiscard]] std::string_view GetEntryName(std::size_t index) const { return entries.at(index).name; }
+
+    /**
+     * Retrieve whether or not the archive has an entry with the given name.
+     */
+    [[nodiscard]] bool Contains(std::string_view name) const { return Find(name) != nullptr; }
+
+    /**
+     * Retrieve the data of an entry, without copying it.
+     *
+     * @throws raylib::RaylibException Thrown if there is no entry with the given name.
+     */
+    [[nodiscard]] std::span<const unsigned char> GetEntry(std::string_view name) const {
+        const Entry* entry = Find(name);
+        if (entry == nullptr) {
+            throw RaylibException("AssetArchive has no entry " + std::string(name));
+        }
+        return entry->data;
+    }
+
+    /**
+     * Load an image entry, using its name's extension as file type.
+     *
+     * @throws raylib::RaylibException Thrown if the entry is missing or failed to load.
+     */
+    [[nodiscard]] raylib::Image LoadImage(std::string_view name) const {
+        const std::span<const unsigned char> data = GetEntry(name);
+        return {GetFileType(name), data.data(), ToInt(data.size())};
+    }
+
+    /**
+     * Load a wave entry, using its name's extension as file type.
+     *
+     * @throws raylib::RaylibException Thrown if the entry is missing or failed to load.
+     */
+    [[nodiscard]] raylib::Wave LoadWave(std::string_view name) const {
+        const std::span<const unsigned char> data = GetEntry(name);
+        return {GetFileType(name), data.data(), ToInt(data.size())};
+    }
+
+    /**
+     * Load a sound entry, using its name's extension as file type.
+     *
+     * @throws raylib::RaylibException Thrown if the entry is missing or failed to load.
+     */
+    [[nodiscard]] raylib::Sound LoadSound(std::string_view name) const { return raylib::Sound(LoadWave(name)); }
+
+    /**
+     * Load a music entry, which streams from the archive data while it plays.
+     *
+     * @throws raylib::RaylibException Thrown if the entry is missing or failed to load.
+     */
+    [[nodiscard]] raylib::Music LoadMusic(std::string_view name) const {
+        const std::span<const unsigned char> data = GetEntry(name);
+        // raylib only reads the data, but takes it as non-const.
+        return {GetFileType(name), const_cast<unsigned char*>(data.data()), ToInt(data.size())};
+    }
+
+    /**
+     * Load a font entry, using its name's extension as file type.
+     *
+     * @throws raylib::RaylibException Thrown if the entry is missing or failed to load.
+     */
+    [[nodiscard]] raylib::Font
+    LoadFont(std::string_view name, int fontSize, int* fontChars = nullptr, int charsCount = 0) const {
+        const std::span<const unsigned char> data = GetEntry(name);
+        return {GetFileType(name), data.data(), ToInt(data.size()), fontSize, fontChars, charsCount};
+    }
+
+    /**
+     * Write an archive of the given files. Entry names are the file paths relative to `basePath`, with '/'
+     * separators.
+     *
+     * @throws raylib::RaylibException Thrown if a file can't be read, the archive can't be written, or two files
+     *                                 have the same entry name.
+     */
+    static void Pack(
+        const std::string& archiveFileName,
+        const std::vector<std::string>& fileNames,
+        const std::string& basePath = "") {
+        std::vector<std::pair<std::string, std::string>> sources;
+        sources.reserve(fileNames.size());
+        for (const std::string& fileName : fileNames) {
+            std::string name = fileName;
+            if (!basePath.empty() && name.compare(0, basePath.size(), basePath) == 0) {
+                name.erase(0, basePath.size());
+            }
+            std::replace(name.begin(), name.end(), '\\', '/');
+            name.erase(0, name.find_first_not_of('/'));
+            sources.emplace_back(std::move(name), fileName);
+        }
+        std::sort(sources.begin(), sources.end());
+        for (std::size_t i = 1; i < sources.size(); i++) {
+            if (sources[i].first == sources[i - 1].first) {
+                throw RaylibException("AssetArchive entry name used twice: " + sources[i].first);
+            }
+        }
+
+        std::ofstream output(archiveFileName, std::ios::binary | std::ios::trunc);
+        if (!output) {
+            throw RaylibException("Failed to write AssetArchive " + archiveFileName);
+        }
+        std::vector<unsigned char> header(headerSize, 0);
+        output.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+        std::vector<unsigned char> toc;
+        std::vector<char> buffer(1 << 16);
+        std::uint64_t position = headerSize;
+        for (const auto& [name, fileName] : sources) {
+            std::ifstream input(fileName, std::ios::binary);
+            if (!input) {
+                throw RaylibException("Failed to read " + fileName + " for AssetArchive");
+            }
+            const std::uint64_t offset = position;
+            while (input) {
+                input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                const std::streamsize count = input.gcount();
+                output.write(buffer.data(), count);
+                position += static_cast<std::uint64_t>(count);
+            }
+            const std::uint64_t size = position - offset;
+
+            // Align the next entry to 16 bytes.
+            const std::uint64_t padding = (alignment - position % alignment) % alignment;
+            output.write(std::string(padding, '\0').data(), static_cast<std::streamsize>(padding));
+            position += padding;
+
+            WriteU64(toc, offset);
+            WriteU64(toc, size);
+            WriteU32(toc, static_cast<std::uint32_t>(name.size()));
+            toc.insert(toc.end(), name.begin(), name.end());
+        }
+        output.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size()));
+
+        header.clear();
+        header.insert(header.end(), {'R', 'P', 'A', 'K'});
+        WriteU32(header, version);
+        WriteU32(header, static_cast<std::uint32_t>(sources.size()));
+        WriteU32(header, 0);
+        WriteU64(header, position);
+        WriteU64(header, toc.size());
+        output.seekp(0);
+        output.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+        if (!output) {
+            throw RaylibException("Failed to write AssetArchive " + archiveFileName);
+        }
+    }
+protected:
+    static constexpr std::size_t headerSize = 32;
+    static constexpr std::uint64_t alignment = 16;
+
+    struct Entry {
+        std::string_view name;
+        std::span<const unsigned char> data;
+    };
+
+    static bool NameLess(const Entry& a, const Entry& b) { return a.name < b.name; }
+
+    [[nodiscard]] const Entry* Find(std::string_view name) const {
+        auto it = std::lower_bound(entries.begin(), entries.end(), name, [](const Entry& entry, std::string_view key) {
+            return entry.name < key;
+        });
+        return it != entries.end() && it->name == name ? &*it : nullptr;
+    }
+
+    /**
+     * The entry's extension, with its dot, like ".png".
+     */
+    static std::string GetFileType(std::string_view name) {
+        const std::size_t dot = name.rfind('.');
+        return dot == std::string_view::npos ? std::string() : std::string(name.substr(dot));
+    }
+
+    static int ToInt(std::size_t size) {
+        if (size > static_cast<std::size_t>(INT_MAX)) {
+            throw RaylibException("AssetArchive entry is too large to load");
+        }
+        return static_cast<int>(size);
+    }
+
+    static std::uint32_t ReadU32(std::span<const unsigned char> bytes, std::size_t offset) {
+        std::uint32_t value = 0;
+        for (std::size_t i = 0; i < 4; i++) {
+            value |= static_cast<std::uint32_t>(bytes[offset + i]) << (8 * i);
+        }
+        return value;
+    }
+
+    static std::uint64_t ReadU64(std::span<const unsigned char> bytes, std::size_t offset) {
+        return ReadU32(bytes, offset) | (static_cast<std::uint64_t>(ReadU32(bytes, offset + 4)) << 32);
+    }
+
+    static void WriteU32(std::vector<unsigned char>& bytes, std::uint32_t value) {
+        for (std::size_t i = 0; i < 4; i++) {
+            bytes.push_back(static_cast<unsigned char>(value >> (8 * i)));
+        }
+    }
+
+    static void WriteU64(std::vector<unsigned char>& bytes, std::uint64_t value) {
+        WriteU32(bytes, static_cast<std::uint32_t>(value));
+        WriteU32(bytes, static_cast<std::uint32_t>(value >> 32));
+    }
+
+    FileData file;
+    std::vector<Entry> entries;
+};
+} // namespace raylib
+
+using RAssetArchive = raylib::AssetArchive;
+
+#endif // RAYLIB_CPP_INCLUDE_ASSETARCHIVE_HPP_
@@ -0,0 +1,264 @@
+#ifndef RAYLIB_CPP_INCLUDE_ASSETLOADER_HPP_
+#define RAYLIB_CPP_INCLUDE_ASSETLOADER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./Image.hpp"
+#include "./Mesh.hpp"
+#include "./Texture.hpp"
+#include "./ThreadPool.hpp"
+#include "./Wave.hpp"
+
+namespace raylib {
+/**
+ * Asynchronous asset loading.
+ *
+ * Decodes assets into CPU-side objects, like raylib::Image or raylib::Wave, on a ThreadPool, and hands the results
+ * back as futures. Requests with a higher priority are decoded first. Steps that need the graphics context, like
+ * creating a texture from an image, are queued for the main thread, which runs them in Update() within a time budget.
+ *
+ * @code
+ * raylib::AssetLoader loader;
+ * std::future<raylib::Texture> texture = loader.LoadTexture("resources/texture.png");
+ * while (!window.ShouldClose()) {
+ *     loader.Update();
+ *     ...
+ * }
+ * @endcode
+ */
+class AssetLoader {
+public:
+    /**
+     * Create a loader that decodes assets on the given pool.
+     *
+     * With a pool without workers, Update() runs the decode steps on the main thread too.
+     */
+    explicit AssetLoader(ThreadPool& pool = ThreadPool::GetDefault()) : pool(pool) { }
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    /**
+     * Waits for the queued decode steps. Uploads that never ran leave their futures with a broken promise.
+     */
+    ~AssetLoader() { Wait(); }
+
+    /**
+     * Run `decode()` on the pool, and retrieve a future for its result.
+     */
+    template<typename F>
+    auto Load(F decode, int priority = 0) -> std::future<std::invoke_result_t<F&>> {
+        using T = std::invoke_result_t<F&>;
+        auto promise = std::make_shared<std::promise<T>>();
+        std::future<T> future = promise->get_future();
+        Decode(priority, [promise, decode = std::move(decode)]() mutable {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    decode();
+                    promise->set_value();
+                } else {
+                    promise->set_value(decode());
+                }
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+            }
+        });
+        return future;
+    }
+
+    /**
+     * Run `decode()` on the pool, then `upload(decoded)` on the main thread during Update(), and retrieve a future
+     * for the upload's result.
+     */
+    template<typename F, typename U>
+    auto Load(F decode, U upload, int priority = 0)
+        -> std::future<std::invoke_result_t<U&, std::invoke_result_t<F&>&&>> {
+        using T = std::invoke_result_t<F&>;
+        using R = std::invoke_result_t<U&, T&&>;
+        auto promise = std::make_shared<std::promise<R>>();
+        std::future<R> future = promise->get_future();
+        Decode(priority, [this, priority, promise, decode = std::move(decode), upload = std::move(upload)]() mutable {
+            std::shared_ptr<T> decoded;
+            try {
+                decoded = std::make_shared<T>(decode());
+            } catch (...) {
+                promise->set_exception(std::current_exception());
+                return;
+            }
+            Push(uploads, priority, [promise, decoded, upload = std::move(upload)]() mutable {
+                try {
+                    if constexpr (std::is_void_v<R>) {
+                        upload(std::move(*decoded));
+                        promise->set_value();
+                    } else {
+                        promise->set_value(upload(std::move(*decoded)));
+                    }
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+            });
+        });
+        return future;
+    }
+
+    /**
+     * Load an image from a file on the pool.
+     */
+    std::future<raylib::Image> LoadImage(const std::string& fileName, int priority = 0) {
+        return Load([fileName] { return raylib::Image(fileName); }, priority);
+    }
+
+    /**
+     * Load a wave from a file on the pool.
+     */
+    std::future<raylib::Wave> LoadWave(const std::string& fileName, int priority = 0) {
+        return Load([fileName] { return raylib::Wave(fileName); }, priority);
+    }
+
+    /**
+     * Load an image from a file on the pool, and create the texture from it on the main thread.
+     */
+    std::future<raylib::Texture> LoadTexture(const std::string& fileName, int priority = 0) {
+        return Load(
+            [fileName] { return raylib::Image(fileName); },
+            [](raylib::Image image) { return raylib::Texture(image); },
+            priority);
+    }
+
+    /**
+     * Build a mesh with `decode()` on the pool, and upload it to the GPU on the main thread.
+     */
+    template<typename F>
+    std::future<raylib::Mesh> LoadMesh(F decode, bool dynamic = false, int priority = 0) {
+        return Load(
+            [decode = std::move(decode)]() mutable { return raylib::Mesh(decode()); },
+            [dynamic](raylib::Mesh mesh) {
+                mesh.Upload(dynamic);
+                return mesh;
+            },
+            priority);
+    }
+
+    /**
+     * Run queued uploads on the calling thread, which must own the graphics context. Call it once per frame.
+     *
+     * @param budget Seconds to spend. At least one upload runs per call, so that progress is made.
+     *
+     * @return The number of uploads run.
+     */
+    std::size_t Update(float budget = 0.002f) {
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed = [start] {
+            return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        if (pool.GetWorkerCount() == 0) {
+            while (decoding.load(std::memory_order_acquire) > 0 && elapsed() < budget && pool.RunPending()) {
+            }
+        }
+
+        std::size_t count = 0;
+        std::function<void()> upload;
+        while ((count == 0 || elapsed() < budget) && Pop(uploads, upload)) {
+            upload();
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * Block until every queued decode step has finished. The calling thread helps run pool tasks meanwhile.
+     */
+    void Wait() {
+        while (decoding.load(std::memory_order_acquire) > 0) {
+            if (!pool.RunPending()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * Retrieve the number of requests that have not been decoded yet.
+     */
+    [[nodiscard]] std::size_t GetDecodeCount() const { return decoding.load(std::memory_order_acquire); }
+
+    /**
+     * Retrieve the number of uploads waiting for Update().
+     */
+    [[nodiscard]] std::size_t GetUploadCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return uploads.size();
+    }
+private:
+    struct Job {
+        int priority;
+        std::uint64_t order;
+        std::function<void()> run;
+    };
+
+    /**
+     * Heap order: higher priorities first, then first come, first served.
+     */
+    static bool RunsAfter(const Job& a, const Job& b) {
+        return a.priority < b.priority || (a.priority == b.priority && a.order > b.order);
+    }
+
+    void Push(std::vector<Job>& jobs, int priority, std::function<void()> run) {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back({priority, nextOrder++, std::move(run)});
+        std::push_heap(jobs.begin(), jobs.end(), RunsAfter);
+    }
+
+    bool Pop(std::vector<Job>& jobs, std::function<void()>& run) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (jobs.empty()) {
+            return false;
+        }
+        std::pop_heap(jobs.begin(), jobs.end(), RunsAfter);
+        run = std::move(jobs.back().run);
+        jobs.pop_back();
+        return true;
+    }
+
+    /**
+     * Queue a decode step. Every pool task runs whichever queued step has the highest priority at that time.
+     */
+    void Decode(int priority, std::function<void()> run) {
+        decoding.fetch_add(1, std::memory_order_acq_rel);
+        Push(decodes, priority, std::move(run));
+        pool.Submit([this] {
+            std::function<void()> next;
+            if (Pop(decodes, next)) {
+                next();
+            }
+            // Last access to the loader, which may be destroyed once the count reaches zero.
+            decoding.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    ThreadPool& pool;
+    mutable std::mutex mutex;
+    std::vector<Job> decodes;
+    std::vector<Job> uploads;
+    std::uint64_t nextOrder{0};
+    std::atomic<std::size_t> decoding{0};
+};
+} // namespace raylib
+
+using RAssetLoader = raylib::AssetLoader;
+
+#endif // RAYLIB_CPP_INCLUDE_ASSETLOADER_HPP_
@@ -0,0 +1,251 @@
+#ifndef RAYLIB_CPP_INCLUDE_AUDIORINGBUFFER_HPP_
+#define RAYLIB_CPP_INCLUDE_AUDIORINGBUFFER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Lock-free single producer, single consumer ring buffer of PCM frames.
+ *
+ * One thread, like a synthesizer, writes frames, and one other thread, usually raylib's audio thread through
+ * AudioStream::SetCallback(), reads them. Neither side waits for the other: writing more than fits drops the rest
+ * and counts an overrun, and reading more than is buffered plays silence for the rest and counts an underrun.
+ *
+ * The read and write positions live on their own cache lines, and each side keeps a copy of the other side's
+ * position, so it only touches the shared one when its copy says the buffer is full or empty.
+ *
+ * @code
+ * raylib::AudioRingBuffer ring(4096, 16, 2, 48000);
+ * raylib::AudioStream stream(48000, 16, 2);
+ * stream.SetCallback(ring);
+ * stream.Play();
+ *
+ * // On the synthesizer thread.
+ * ring.Write(samples, frameCount);
+ * @endcode
+ */
+class AudioRingBuffer {
+public:
+    /**
+     * Counters of both sides of the buffer.
+     */
+    struct Stats {
+        /** Frames written */
+        std::uint64_t written;
+        /** Frames read, not counting silence */
+        std::uint64_t read;
+        /** Reads that ran out of frames */
+        std::uint64_t underruns;
+        /** Frames of silence played because of underruns */
+        std::uint64_t underrunFrames;
+        /** Writes that didn't fit */
+        std::uint64_t overruns;
+        /** Frames dropped because of overruns */
+        std::uint64_t overrunFrames;
+        /** The fewest frames buffered at the start of a read */
+        unsigned int minBuffered;
+        /** The most frames buffered at the start of a read */
+        unsigned int maxBuffered;
+    };
+
+    /**
+     * @param frameCount Frames to make room for, rounded up to a power of two.
+     * @param sampleSize Bits per sample: 8, 16 or 32, like raylib::AudioStream.
+     * @param channels Samples per frame.
+     * @param sampleRate Frames per second, for the latency.
+     */
+    AudioRingBuffer(
+        unsigned int frameCount,
+        unsigned int sampleSize = 16,
+        unsigned int channels = 2,
+        unsigned int sampleRate = 44100)
+        : frameSize(sampleSize / 8 * channels)
+        , sampleSize(sampleSize)
+        , channels(channels)
+        , sampleRate(sampleRate) {
+        capacity = 1;
+        while (capacity < frameCount) {
+            capacity <<= 1;
+        }
+        data = std::make_unique<unsigned char[]>(static_cast<std::size_t>(capacity) * frameSize);
+        ResetStats();
+    }
+
+    AudioRingBuffer(const AudioRingBuffer&) = delete;
+    AudioRingBuffer& operator=(const AudioRingBuffer&) = delete;
+
+    GETTER(unsigned int, Capacity, capacity)
+    GETTER(unsigned int, FrameSize, frameSize)
+    GETTER(unsigned int, SampleSize, sampleSize)
+    GETTER(unsigned int, Channels, channels)
+    GETTER(unsigned int, SampleRate, sampleRate)
+
+    /**
+     * Write frames, from the producer thread.
+     *
+     * @return The number of frames written. The rest didn't fit, and count as an overrun.
+     */
+    unsigned int Write(const void* frames, unsigned int frameCount) {
+        const std::size_t write = writeIndex.load(std::memory_order_relaxed);
+        if (write - cachedRead + frameCount > capacity) {
+            cachedRead = readIndex.load(std::memory_order_acquire);
+        }
+        const unsigned int space = capacity - static_cast<unsigned int>(write - cachedRead);
+        const unsigned int count = std::min(frameCount, space);
+        Copy(static_cast<const unsigned char*>(frames), write, count);
+        writeIndex.store(write + count, std::memory_order_release);
+
+        framesWritten.fetch_add(count, std::memory_order_relaxed);
+        if (count < frameCount) {
+            overruns.fetch_add(1, std::memory_order_relaxed);
+            overrunFrames.fetch_add(frameCount - count, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /**
+     * Read frames, from the consumer thread. When fewer frames are buffered, the rest is filled with silence.
+     *
+     * @return The number of frames read, not counting silence.
+     */
+    unsigned int Read(void* frames, unsigned int frameCount) {
+        const std::size_t read = readIndex.load(std::memory_order_relaxed);
+        if (cachedWrite - read < frameCount) {
+            cachedWrite = writeIndex.load(std::memory_order_acquire);
+        }
+        const auto buffered = static_cast<unsigned int>(cachedWrite - read);
+        const unsigned int count = std::min(frameCount, buffered);
+        auto* out = static_cast<unsigned char*>(frames);
+        Copy(out, read, count);
+        readIndex.store(read + count, std::memory_order_release);
+
+        // Unsigned 8 bit samples are silent in the middle of their range.
+        std::memset(
+            out + static_cast<std::size_t>(count) * frameSize,
+            sampleSize == 8 ? 0x80 : 0,
+            static_cast<std::size_t>(frameCount - count) * frameSize);
+
+        framesRead.fetch_add(count, std::memory_order_relaxed);
+        if (count < frameCount) {
+            underruns.fetch_add(1, std::memory_order_relaxed);
+            underrunFrames.fetch_add(frameCount - count, std::memory_order_relaxed);
+        }
+        if (buffered < minBuffered.load(std::memory_order_relaxed)) {
+            minBuffered.store(buffered, std::memory_order_relaxed);
+        }
+        if (buffered > maxBuffered.load(std::memory_order_relaxed)) {
+            maxBuffered.store(buffered, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    /**
+     * Retrieve how many frames are buffered. Exact on the consumer thread, approximate on others.
+     */
+    [[nodiscard]] unsigned int GetReadable() const {
+        return static_cast<unsigned int>(
+            writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire));
+    }
+
+    /**
+     * Retrieve how many frames fit. Exact on the producer thread, approximate on others.
+     */
+    [[nodiscard]] unsigned int GetWritable() const { return capacity - GetReadable(); }
+
+    /**
+     * Retrieve how long the buffered frames take to play, in seconds.
+     */
+    [[nodiscard]] float GetLatency() const {
+        return sampleRate > 0 ? static_cast<float>(GetReadable()) / static_cast<float>(sampleRate) : 0.0f;
+    }
+
+    /**
+     * Retrieve the counters. Each one is read atomically, but not all of them at the same time.
+     */
+    [[nodiscard]] Stats GetStats() const {
+        const unsigned int min = minBuffered.load(std::memory_order_relaxed);
+        return {
+            framesWritten.load(std::memory_order_relaxed),
+            framesRead.load(std::memory_order_relaxed),
+            underruns.load(std::memory_order_relaxed),
+            underrunFrames.load(std::memory_order_relaxed),
+            overruns.load(std::memory_order_relaxed),
+            overrunFrames.load(std::memory_order_relaxed),
+            min == NoReads ? 0 : min,
+            maxBuffered.load(std::memory_order_relaxed)};
+    }
+
+    /**
+     * Set the counters back to zero.
+     */
+    void ResetStats() {
+        framesWritten.store(0, std::memory_order_relaxed);
+        framesRead.store(0, std::memory_order_relaxed);
+        underruns.store(0, std::memory_order_relaxed);
+        underrunFrames.store(0, std::memory_order_relaxed);
+        overruns.store(0, std::memory_order_relaxed);
+        overrunFrames.store(0, std::memory_order_relaxed);
+        minBuffered.store(NoReads, std::memory_order_relaxed);
+        maxBuffered.store(0, std::memory_order_relaxed);
+    }
+protected:
+    static constexpr unsigned int NoReads = ~0u;
+
+    /**
+     * Copy frames between a buffer and the ring, starting at a position, in at most two pieces.
+     */
+    template<typename T>
+    void Copy(T* frames, std::size_t position, unsigned int count) {
+        const auto offset = static_cast<unsigned int>(position & (capacity - 1));
+        const unsigned int first = std::min(count, capacity - offset);
+        const std::size_t firstBytes = static_cast<std::size_t>(first) * frameSize;
+        const std::size_t restBytes = static_cast<std::size_t>(count - first) * frameSize;
+        unsigned char* ring = data.get() + static_cast<std::size_t>(offset) * frameSize;
+        if constexpr (std::is_const_v<T>) {
+            std::memcpy(ring, frames, firstBytes);
+            std::memcpy(data.get(), frames + firstBytes, restBytes);
+        } else {
+            std::memcpy(frames, ring, firstBytes);
+            std::memcpy(frames + firstBytes, data.get(), restBytes);
+        }
+    }
+
+    unsigned int capacity;
+    unsigned int frameSize;
+    unsigned int sampleSize;
+    unsigned int channels;
+    unsigned int sampleRate;
+    std::unique_ptr<unsigned char[]> data;
+
+    /** Written by the producer */
+    alignas(64) std::atomic<std::size_t> writeIndex{0};
+    /** The producer's copy of readIndex */
+    std::size_t cachedRead{0};
+    std::atomic<std::uint64_t> framesWritten;
+    std::atomic<std::uint64_t> overruns;
+    std::atomic<std::uint64_t> overrunFrames;
+
+    /** Written by the consumer */
+    alignas(64) std::atomic<std::size_t> readIndex{0};
+    /** The consumer's copy of writeIndex */
+    std::size_t cachedWrite{0};
+    std::atomic<std::uint64_t> framesRead;
+    std::atomic<std::uint64_t> underruns;
+    std::atomic<std::uint64_t> underrunFrames;
+    std::atomic<unsigned int> minBuffered;
+    std::atomic<unsigned int> maxBuffered;
+};
+} // namespace raylib
+
+using RAudioRingBuffer = raylib::AudioRingBuffer;
+
+#endif // RAYLIB_CPP_INCLUDE_AUDIORINGBUFFER_HPP_
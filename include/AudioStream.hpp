@@ -1,11 +1,58 @@
 #ifndef RAYLIB_CPP_INCLUDE_AUDIOSTREAM_HPP_
 #define RAYLIB_CPP_INCLUDE_AUDIOSTREAM_HPP_
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "./AudioRingBuffer.hpp"
 #include "./RaylibException.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
+#ifndef RAYLIB_CPP_AUDIO_CALLBACK_SLOTS
+/**
+ * The number of audio streams that can have a C++ callback at the same time.
+ */
+#define RAYLIB_CPP_AUDIO_CALLBACK_SLOTS 16
+#endif
+
 namespace raylib {
+namespace detail {
+/**
+ * raylib's audio callbacks don't get a user pointer, so every stream with a C++ callback gets a slot, with a plain
+ * function that calls the slot's callable.
+ */
+struct AudioCallbackSlot {
+    std::atomic<std::function<void(void*, unsigned int)>*> callback{nullptr};
+    std::atomic<bool> used{false};
+};
+
+inline AudioCallbackSlot audioCallbackSlots[RAYLIB_CPP_AUDIO_CALLBACK_SLOTS];
+
+template<std::size_t Slot>
+void AudioCallbackTrampoline(void* bufferData, unsigned int frames) {
+    auto* callback = audioCallbackSlots[Slot].callback.load(std::memory_order_acquire);
+    if (callback != nullptr) {
+        (*callback)(bufferData, frames);
+    }
+}
+
+template<std::size_t... Slots>
+constexpr std::array<::AudioCallback, sizeof...(Slots)> MakeAudioCallbackTrampolines(std::index_sequence<Slots...>) {
+    return {&AudioCallbackTrampoline<Slots>...};
+}
+
+inline constexpr std::array<::AudioCallback, RAYLIB_CPP_AUDIO_CALLBACK_SLOTS> audioCallbackTrampolines =
+    MakeAudioCallbackTrampolines(std::make_index_sequence<RAYLIB_CPP_AUDIO_CALLBACK_SLOTS>());
+
+/** The last size given to AudioStream::SetBufferSizeDefault(), as raylib has no getter for it */
+inline std::atomic<int> audioStreamBufferSizeDefault{0};
+} // namespace detail
+
 /**
  * AudioStream management functions
  */
@@ -37,9 +84,10 @@ public:
 
     AudioStream(const AudioStream&) = delete;
 
-    AudioStream(AudioStream&& other) noexcept {
+    AudioStream(AudioStream&& other) noexcept : callbackSlot(other.callbackSlot) {
         set(other);
 
+        other.callbackSlot = -1;
         other.buffer = nullptr;
         other.processor = nullptr;
         other.sampleRate = 0;
@@ -56,6 +104,7 @@ public:
     GETTER(unsigned int, Channels, channels)
 
     AudioStream& operator=(const ::AudioStream& stream) {
+        ClearCallback();
         set(stream);
         return *this;
     }
@@ -69,7 +118,9 @@ public:
 
         Unload();
         set(other);
+        callbackSlot = other.callbackSlot;
 
+        other.callbackSlot = -1;
         other.buffer = nullptr;
         other.processor = nullptr;
         other.sampleRate = 0;
@@ -94,6 +145,8 @@ public:
         if (IsValid()) {
             ::UnloadAudioStream(*this);
         }
+        // The stream is gone, so raylib won't call its callback anymore.
+        ReleaseCallbackSlot();
     }
 
     /**
@@ -165,12 +218,67 @@ public:
     /**
      * Default size for new audio streams
      */
-    static void SetBufferSizeDefault(int size) { ::SetAudioStreamBufferSizeDefault(size); }
+    static void SetBufferSizeDefault(int size) {
+        detail::audioStreamBufferSizeDefault.store(size, std::memory_order_relaxed);
+        ::SetAudioStreamBufferSizeDefault(size);
+    }
+
+    /**
+     * Retrieve the default size last set through SetBufferSizeDefault(), where 0 is raylib's own size.
+     */
+    static int GetBufferSizeDefault() { return detail::audioStreamBufferSizeDefault.load(std::memory_order_relaxed); }
+
+    /**
+     * A callable that fills `frames` frames of the stream's format in `bufferData`, on the audio thread.
+     */
+    using Callback = std::function<void(void* bufferData, unsigned int frames)>;
 
     /**
      * Audio thread callback to request new data
      */
-    void SetCallback(::AudioCallback callback) { ::SetAudioStreamCallback(*this, callback); }
+    void SetCallback(::AudioCallback callback) {
+        ::SetAudioStreamCallback(*this, callback);
+        ReleaseCallbackSlot();
+    }
+
+    /**
+     * Audio thread callback to request new data, which may keep state.
+     *
+     * Callables without state are passed to raylib as they are. Up to RAYLIB_CPP_AUDIO_CALLBACK_SLOTS streams can
+     * have a callable with state at the same time.
+     *
+     * @throws raylib::RaylibException Throws if every callback slot is in use.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, void*, unsigned int>
+    void SetCallback(F&& callback) {
+        if constexpr (std::is_convertible_v<F, ::AudioCallback>) {
+            SetCallback(static_cast<::AudioCallback>(callback));
+        } else {
+            SetCallable(Callback(std::forward<F>(callback)));
+        }
+    }
+
+    /**
+     * Feed the stream from a ring buffer, which another thread writes to.
+     *
+     * @throws raylib::RaylibException Throws if the ring buffer's frames don't match the stream's format, or if
+     * every callback slot is in use.
+     */
+    void SetCallback(AudioRingBuffer& ring) {
+        if (ring.GetFrameSize() != sampleSize / 8 * channels) {
+            throw RaylibException("The ring buffer's frames don't match the audio stream's format");
+        }
+        SetCallable([&ring](void* bufferData, unsigned int frames) { ring.Read(bufferData, frames); });
+    }
+
+    /**
+     * Remove the stream's callback.
+     */
+    void ClearCallback() {
+        ::SetAudioStreamCallback(*this, nullptr);
+        ReleaseCallbackSlot();
+    }
 
     /**
      * Attach audio stream processor to stream
@@ -200,6 +308,47 @@ public:
         }
     }
 protected:
+    /**
+     * Give the callable a slot, and point raylib at the slot's trampoline.
+     */
+    void SetCallable(Callback callback) {
+        if (!callback) {
+            ClearCallback();
+            return;
+        }
+        if (callbackSlot < 0) {
+            callbackSlot = AcquireCallbackSlot();
+        }
+        auto& slot = detail::audioCallbackSlots[static_cast<std::size_t>(callbackSlot)];
+        Callback* previous = slot.callback.exchange(new Callback(std::move(callback)), std::memory_order_acq_rel);
+        // raylib calls the stream callbacks with its audio lock held, and takes the lock to set a callback, so once
+        // this returns the previous callable isn't running anymore.
+        ::SetAudioStreamCallback(*this, detail::audioCallbackTrampolines[static_cast<std::size_t>(callbackSlot)]);
+        delete previous;
+    }
+
+    static int AcquireCallbackSlot() {
+        for (std::size_t i = 0; i < RAYLIB_CPP_AUDIO_CALLBACK_SLOTS; i++) {
+            bool expected = false;
+            if (detail::audioCallbackSlots[i].used.compare_exchange_strong(expected, true)) {
+                return static_cast<int>(i);
+            }
+        }
+        throw RaylibException("Too many audio streams with callbacks, define RAYLIB_CPP_AUDIO_CALLBACK_SLOTS");
+    }
+
+    /**
+     * Free the callable, once raylib won't call it anymore.
+     */
+    void ReleaseCallbackSlot() {
+        if (callbackSlot >= 0) {
+            auto& slot = detail::audioCallbackSlots[static_cast<std::size_t>(callbackSlot)];
+            delete slot.callback.exchange(nullptr, std::memory_order_acq_rel);
+            slot.used.store(false, std::memory_order_release);
+            callbackSlot = -1;
+        }
+    }
+
     void set(const ::AudioStream& stream) {
         buffer = stream.buffer;
         processor = stream.processor;
@@ -207,6 +356,9 @@ protected:
         sampleSize = stream.sampleSize;
         channels = stream.channels;
     }
+
+    /** The slot of the C++ callback, or -1 */
+    int callbackSlot{-1};
 };
 } // namespace raylib
 
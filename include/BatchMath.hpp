@@ -0,0 +1,625 @@
+#ifndef RAYLIB_CPP_INCLUDE_BATCHMATH_HPP_
+#define RAYLIB_CPP_INCLUDE_BATCHMATH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include "./MatrixKernels.hpp"
+#include "./RaylibException.hpp"
+#include "./Vector2.hpp"
+#include "./Vector3.hpp"
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Structure-of-arrays view over separate x and y float buffers.
+ *
+ * The view does not own the buffers. Use Vector2SoA<const float> for read-only input.
+ */
+template<typename T = float>
+struct Vector2SoA {
+    std::span<T> x;
+    std::span<T> y;
+
+    /**
+     * Number of vectors in the view.
+     */
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+
+    /**
+     * Whether or not all the component buffers have the same length.
+     */
+    [[nodiscard]] bool IsValid() const { return x.size() == y.size(); }
+
+    operator Vector2SoA<const T>() const
+        requires(!std::is_const_v<T>)
+    {
+        return {x, y};
+    }
+};
+
+/**
+ * Structure-of-arrays view over separate x, y and z float buffers.
+ *
+ * The view does not own the buffers. Use Vector3SoA<const float> for read-only input.
+ */
+template<typename T = float>
+struct Vector3SoA {
+    std::span<T> x;
+    std::span<T> y;
+    std::span<T> z;
+
+    /**
+     * Number of vectors in the view.
+     */
+    [[nodiscard]] std::size_t size() const { return x.size(); }
+
+    /**
+     * Whether or not all the component buffers have the same length.
+     */
+    [[nodiscard]] bool IsValid() const { return x.size() == y.size() && x.size() == z.size(); }
+
+    operator Vector3SoA<const T>() const
+        requires(!std::is_const_v<T>)
+    {
+        return {x, y, z};
+    }
+};
+
+/**
+ * Batch math over arrays of vectors and matrices.
+ *
+ * Every vector function takes either spans of raylib::Vector2/raylib::Vector3 or Vector2SoA/Vector3SoA views, and
+ * writes to an output of the same length. Matrix functions take spans of ::Matrix. The output may be the same buffer
+ * as an input. Results match the per-element raylib::Vector2/raylib::Vector3/raylib::Matrix methods.
+ *
+ * @see raylib-cpp-simd.hpp for the instruction set in use, and MatrixKernels.hpp for matrices.
+ */
+namespace batch {
+namespace detail {
+static_assert(sizeof(raylib::Vector2) == sizeof(float) * 2, "raylib::Vector2 must be two packed floats");
+static_assert(sizeof(raylib::Vector3) == sizeof(float) * 3, "raylib::Vector3 must be three packed floats");
+
+/**
+ * Number of vectors gathered on the stack when running SoA kernels over AoS arrays.
+ */
+constexpr std::size_t blockSize = 64;
+
+inline void CheckSize(std::size_t expected, std::size_t actual) {
+    if (expected != actual) {
+        throw RaylibException("Batch math input and output sizes do not match");
+    }
+}
+
+inline void AddFloats(const float* a, const float* b, float* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        simd::Store(out + i, simd::Add(simd::Load(a + i), simd::Load(b + i)));
+    }
+    for (; i < count; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+inline void ScaleFloats(const float* a, float scale, float* out, std::size_t count) {
+    const simd::floatv s = simd::Set(scale);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        simd::Store(out + i, simd::Mul(simd::Load(a + i), s));
+    }
+    for (; i < count; i++) {
+        out[i] = a[i] * scale;
+    }
+}
+
+inline void LerpFloats(const float* a, const float* b, float amount, float* out, std::size_t count) {
+    const simd::floatv t = simd::Set(amount);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        const simd::floatv va = simd::Load(a + i);
+        simd::Store(out + i, simd::Add(va, simd::Mul(t, simd::Sub(simd::Load(b + i), va))));
+    }
+    for (; i < count; i++) {
+        out[i] = a[i] + amount * (b[i] - a[i]);
+    }
+}
+
+/**
+ * Vector2Normalize(): vectors with a length of zero become zero.
+ */
+inline void Normalize2(const float* x, const float* y, float* outX, float* outY, std::size_t count) {
+    const simd::floatv zero = simd::Set(0.0f);
+    const simd::floatv one = simd::Set(1.0f);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        const simd::floatv vx = simd::Load(x + i);
+        const simd::floatv vy = simd::Load(y + i);
+        const simd::floatv length = simd::Sqrt(simd::Add(simd::Mul(vx, vx), simd::Mul(vy, vy)));
+        const simd::floatv mask = simd::Greater(length, zero);
+        const simd::floatv ilength = simd::Div(one, length);
+        simd::Store(outX + i, simd::Select(mask, simd::Mul(vx, ilength), zero));
+        simd::Store(outY + i, simd::Select(mask, simd::Mul(vy, ilength), zero));
+    }
+    for (; i < count; i++) {
+        const float length = std::sqrt((x[i] * x[i]) + (y[i] * y[i]));
+        if (length > 0) {
+            const float ilength = 1.0f / length;
+            outX[i] = x[i] * ilength;
+            outY[i] = y[i] * ilength;
+        } else {
+            outX[i] = 0.0f;
+            outY[i] = 0.0f;
+        }
+    }
+}
+
+/**
+ * Vector3Normalize(): vectors with a length of zero are left untouched.
+ */
+inline void Normalize3(
+    const float* x,
+    const float* y,
+    const float* z,
+    float* outX,
+    float* outY,
+    float* outZ,
+    std::size_t count) {
+    const simd::floatv zero = simd::Set(0.0f);
+    const simd::floatv one = simd::Set(1.0f);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        const simd::floatv vx = simd::Load(x + i);
+        const simd::floatv vy = simd::Load(y + i);
+        const simd::floatv vz = simd::Load(z + i);
+        const simd::floatv length =
+            simd::Sqrt(simd::Add(simd::Add(simd::Mul(vx, vx), simd::Mul(vy, vy)), simd::Mul(vz, vz)));
+        const simd::floatv mask = simd::NotEqual(length, zero);
+        const simd::floatv ilength = simd::Div(one, length);
+        simd::Store(outX + i, simd::Select(mask, simd::Mul(vx, ilength), vx));
+        simd::Store(outY + i, simd::Select(mask, simd::Mul(vy, ilength), vy));
+        simd::Store(outZ + i, simd::Select(mask, simd::Mul(vz, ilength), vz));
+    }
+    for (; i < count; i++) {
+        const float length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        if (length != 0.0f) {
+            const float ilength = 1.0f / length;
+            outX[i] = x[i] * ilength;
+            outY[i] = y[i] * ilength;
+            outZ[i] = z[i] * ilength;
+        } else {
+            outX[i] = x[i];
+            outY[i] = y[i];
+            outZ[i] = z[i];
+        }
+    }
+}
+
+inline void
+Transform2(const float* x, const float* y, const ::Matrix& mat, float* outX, float* outY, std::size_t count) {
+    const simd::floatv m0 = simd::Set(mat.m0);
+    const simd::floatv m1 = simd::Set(mat.m1);
+    const simd::floatv m4 = simd::Set(mat.m4);
+    const simd::floatv m5 = simd::Set(mat.m5);
+    const simd::floatv m12 = simd::Set(mat.m12);
+    const simd::floatv m13 = simd::Set(mat.m13);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        const simd::floatv vx = simd::Load(x + i);
+        const simd::floatv vy = simd::Load(y + i);
+        simd::Store(outX + i, simd::Add(simd::Add(simd::Mul(m0, vx), simd::Mul(m4, vy)), m12));
+        simd::Store(outY + i, simd::Add(simd::Add(simd::Mul(m1, vx), simd::Mul(m5, vy)), m13));
+    }
+    for (; i < count; i++) {
+        const float vx = x[i];
+        const float vy = y[i];
+        outX[i] = mat.m0 * vx + mat.m4 * vy + mat.m12;
+        outY[i] = mat.m1 * vx + mat.m5 * vy + mat.m13;
+    }
+}
+
+inline void Transform3(
+    const float* x,
+    const float* y,
+    const float* z,
+    const ::Matrix& mat,
+    float* outX,
+    float* outY,
+    float* outZ,
+    std::size_t count) {
+    const simd::floatv m0 = simd::Set(mat.m0);
+    const simd::floatv m1 = simd::Set(mat.m1);
+    const simd::floatv m2 = simd::Set(mat.m2);
+    const simd::floatv m4 = simd::Set(mat.m4);
+    const simd::floatv m5 = simd::Set(mat.m5);
+    const simd::floatv m6 = simd::Set(mat.m6);
+    const simd::floatv m8 = simd::Set(mat.m8);
+    const simd::floatv m9 = simd::Set(mat.m9);
+    const simd::floatv m10 = simd::Set(mat.m10);
+    const simd::floatv m12 = simd::Set(mat.m12);
+    const simd::floatv m13 = simd::Set(mat.m13);
+    const simd::floatv m14 = simd::Set(mat.m14);
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        const simd::floatv vx = simd::Load(x + i);
+        const simd::floatv vy = simd::Load(y + i);
+        const simd::floatv vz = simd::Load(z + i);
+        simd::Store(
+            outX + i,
+            simd::Add(simd::Add(simd::Add(simd::Mul(m0, vx), simd::Mul(m4, vy)), simd::Mul(m8, vz)), m12));
+        simd::Store(
+            outY + i,
+            simd::Add(simd::Add(simd::Add(simd::Mul(m1, vx), simd::Mul(m5, vy)), simd::Mul(m9, vz)), m13));
+        simd::Store(
+            outZ + i,
+            simd::Add(simd::Add(simd::Add(simd::Mul(m2, vx), simd::Mul(m6, vy)), simd::Mul(m10, vz)), m14));
+    }
+    for (; i < count; i++) {
+        const float vx = x[i];
+        const float vy = y[i];
+        const float vz = z[i];
+        outX[i] = mat.m0 * vx + mat.m4 * vy + mat.m8 * vz + mat.m12;
+        outY[i] = mat.m1 * vx + mat.m5 * vy + mat.m9 * vz + mat.m13;
+        outZ[i] = mat.m2 * vx + mat.m6 * vy + mat.m10 * vz + mat.m14;
+    }
+}
+
+/**
+ * Runs a SoA kernel over an array of raylib::Vector2, gathering blockSize vectors at a time onto the stack.
+ */
+template<typename Kernel>
+void ForEachBlock2(std::span<const raylib::Vector2> in, std::span<raylib::Vector2> out, Kernel kernel) {
+    float x[blockSize];
+    float y[blockSize];
+    for (std::size_t start = 0; start < in.size(); start += blockSize) {
+        const std::size_t count = std::min(blockSize, in.size() - start);
+        for (std::size_t i = 0; i < count; i++) {
+            x[i] = in[start + i].x;
+            y[i] = in[start + i].y;
+        }
+        kernel(x, y, count);
+        for (std::size_t i = 0; i < count; i++) {
+            out[start + i].x = x[i];
+            out[start + i].y = y[i];
+        }
+    }
+}
+
+/**
+ * Runs a SoA kernel over an array of raylib::Vector3, gathering blockSize vectors at a time onto the stack.
+ */
+template<typename Kernel>
+void ForEachBlock3(std::span<const raylib::Vector3> in, std::span<raylib::Vector3> out, Kernel kernel) {
+    float x[blockSize];
+    float y[blockSize];
+    float z[blockSize];
+    for (std::size_t start = 0; start < in.size(); start += blockSize) {
+        const std::size_t count = std::min(blockSize, in.size() - start);
+        for (std::size_t i = 0; i < count; i++) {
+            x[i] = in[start + i].x;
+            y[i] = in[start + i].y;
+            z[i] = in[start + i].z;
+        }
+        kernel(x, y, z, count);
+        for (std::size_t i = 0; i < count; i++) {
+            out[start + i].x = x[i];
+            out[start + i].y = y[i];
+            out[start + i].z = z[i];
+        }
+    }
+}
+
+inline const float* Floats(std::span<const raylib::Vector2> vectors) {
+    return reinterpret_cast<const float*>(vectors.data());
+}
+inline float* Floats(std::span<raylib::Vector2> vectors) { return reinterpret_cast<float*>(vectors.data()); }
+inline const float* Floats(std::span<const raylib::Vector3> vectors) {
+    return reinterpret_cast<const float*>(vectors.data());
+}
+inline float* Floats(std::span<raylib::Vector3> vectors) { return reinterpret_cast<float*>(vectors.data()); }
+} // namespace detail
+
+/**
+ * Add two arrays of vectors (out[i] = a[i] + b[i])
+ */
+inline void
+Add(std::span<const raylib::Vector2> a, std::span<const raylib::Vector2> b, std::span<raylib::Vector2> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    detail::AddFloats(detail::Floats(a), detail::Floats(b), detail::Floats(out), a.size() * 2);
+}
+
+/**
+ * Add two arrays of vectors (out[i] = a[i] + b[i])
+ */
+inline void
+Add(std::span<const raylib::Vector3> a, std::span<const raylib::Vector3> b, std::span<raylib::Vector3> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    detail::AddFloats(detail::Floats(a), detail::Floats(b), detail::Floats(out), a.size() * 3);
+}
+
+/**
+ * Add two arrays of vectors (out[i] = a[i] + b[i])
+ */
+inline void Add(Vector2SoA<const float> a, Vector2SoA<const float> b, Vector2SoA<float> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    if (!a.IsValid() || !b.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector2SoA component buffers must have the same length");
+    }
+    detail::AddFloats(a.x.data(), b.x.data(), out.x.data(), a.size());
+    detail::AddFloats(a.y.data(), b.y.data(), out.y.data(), a.size());
+}
+
+/**
+ * Add two arrays of vectors (out[i] = a[i] + b[i])
+ */
+inline void Add(Vector3SoA<const float> a, Vector3SoA<const float> b, Vector3SoA<float> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    if (!a.IsValid() || !b.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector3SoA component buffers must have the same length");
+    }
+    detail::AddFloats(a.x.data(), b.x.data(), out.x.data(), a.size());
+    detail::AddFloats(a.y.data(), b.y.data(), out.y.data(), a.size());
+    detail::AddFloats(a.z.data(), b.z.data(), out.z.data(), a.size());
+}
+
+/**
+ * Scale an array of vectors (out[i] = in[i] * scale)
+ */
+inline void Scale(std::span<const raylib::Vector2> in, float scale, std::span<raylib::Vector2> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ScaleFloats(detail::Floats(in), scale, detail::Floats(out), in.size() * 2);
+}
+
+/**
+ * Scale an array of vectors (out[i] = in[i] * scale)
+ */
+inline void Scale(std::span<const raylib::Vector3> in, float scale, std::span<raylib::Vector3> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ScaleFloats(detail::Floats(in), scale, detail::Floats(out), in.size() * 3);
+}
+
+/**
+ * Scale an array of vectors (out[i] = in[i] * scale)
+ */
+inline void Scale(Vector2SoA<const float> in, float scale, Vector2SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector2SoA component buffers must have the same length");
+    }
+    detail::ScaleFloats(in.x.data(), scale, out.x.data(), in.size());
+    detail::ScaleFloats(in.y.data(), scale, out.y.data(), in.size());
+}
+
+/**
+ * Scale an array of vectors (out[i] = in[i] * scale)
+ */
+inline void Scale(Vector3SoA<const float> in, float scale, Vector3SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector3SoA component buffers must have the same length");
+    }
+    detail::ScaleFloats(in.x.data(), scale, out.x.data(), in.size());
+    detail::ScaleFloats(in.y.data(), scale, out.y.data(), in.size());
+    detail::ScaleFloats(in.z.data(), scale, out.z.data(), in.size());
+}
+
+/**
+ * Normalize an array of vectors
+ */
+inline void Normalize(std::span<const raylib::Vector2> in, std::span<raylib::Vector2> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ForEachBlock2(in, out, [](float* x, float* y, std::size_t count) {
+        detail::Normalize2(x, y, x, y, count);
+    });
+}
+
+/**
+ * Normalize an array of vectors
+ */
+inline void Normalize(std::span<const raylib::Vector3> in, std::span<raylib::Vector3> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ForEachBlock3(in, out, [](float* x, float* y, float* z, std::size_t count) {
+        detail::Normalize3(x, y, z, x, y, z, count);
+    });
+}
+
+/**
+ * Normalize an array of vectors
+ */
+inline void Normalize(Vector2SoA<const float> in, Vector2SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector2SoA component buffers must have the same length");
+    }
+    detail::Normalize2(in.x.data(), in.y.data(), out.x.data(), out.y.data(), in.size());
+}
+
+/**
+ * Normalize an array of vectors
+ */
+inline void Normalize(Vector3SoA<const float> in, Vector3SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector3SoA component buffers must have the same length");
+    }
+    detail::Normalize3(
+        in.x.data(),
+        in.y.data(),
+        in.z.data(),
+        out.x.data(),
+        out.y.data(),
+        out.z.data(),
+        in.size());
+}
+
+/**
+ * Transforms an array of vectors by a given Matrix
+ */
+inline void Transform(std::span<const raylib::Vector2> in, const ::Matrix& mat, std::span<raylib::Vector2> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ForEachBlock2(in, out, [&mat](float* x, float* y, std::size_t count) {
+        detail::Transform2(x, y, mat, x, y, count);
+    });
+}
+
+/**
+ * Transforms an array of vectors by a given Matrix
+ */
+inline void Transform(std::span<const raylib::Vector3> in, const ::Matrix& mat, std::span<raylib::Vector3> out) {
+    detail::CheckSize(in.size(), out.size());
+    detail::ForEachBlock3(in, out, [&mat](float* x, float* y, float* z, std::size_t count) {
+        detail::Transform3(x, y, z, mat, x, y, z, count);
+    });
+}
+
+/**
+ * Transforms an array of vectors by a given Matrix
+ */
+inline void Transform(Vector2SoA<const float> in, const ::Matrix& mat, Vector2SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector2SoA component buffers must have the same length");
+    }
+    detail::Transform2(in.x.data(), in.y.data(), mat, out.x.data(), out.y.data(), in.size());
+}
+
+/**
+ * Transforms an array of vectors by a given Matrix
+ */
+inline void Transform(Vector3SoA<const float> in, const ::Matrix& mat, Vector3SoA<float> out) {
+    detail::CheckSize(in.size(), out.size());
+    if (!in.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector3SoA component buffers must have the same length");
+    }
+    detail::Transform3(
+        in.x.data(),
+        in.y.data(),
+        in.z.data(),
+        mat,
+        out.x.data(),
+        out.y.data(),
+        out.z.data(),
+        in.size());
+}
+
+/**
+ * Calculate linear interpolation between two arrays of vectors
+ */
+inline void Lerp(
+    std::span<const raylib::Vector2> a,
+    std::span<const raylib::Vector2> b,
+    float amount,
+    std::span<raylib::Vector2> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    detail::LerpFloats(detail::Floats(a), detail::Floats(b), amount, detail::Floats(out), a.size() * 2);
+}
+
+/**
+ * Calculate linear interpolation between two arrays of vectors
+ */
+inline void Lerp(
+    std::span<const raylib::Vector3> a,
+    std::span<const raylib::Vector3> b,
+    float amount,
+    std::span<raylib::Vector3> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    detail::LerpFloats(detail::Floats(a), detail::Floats(b), amount, detail::Floats(out), a.size() * 3);
+}
+
+/**
+ * Calculate linear interpolation between two arrays of vectors
+ */
+inline void Lerp(Vector2SoA<const float> a, Vector2SoA<const float> b, float amount, Vector2SoA<float> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    if (!a.IsValid() || !b.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector2SoA component buffers must have the same length");
+    }
+    detail::LerpFloats(a.x.data(), b.x.data(), amount, out.x.data(), a.size());
+    detail::LerpFloats(a.y.data(), b.y.data(), amount, out.y.data(), a.size());
+}
+
+/**
+ * Calculate linear interpolation between two arrays of vectors
+ */
+inline void Lerp(Vector3SoA<const float> a, Vector3SoA<const float> b, float amount, Vector3SoA<float> out) {
+    detail::CheckSize(a.size(), b.size());
+    detail::CheckSize(a.size(), out.size());
+    if (!a.IsValid() || !b.IsValid() || !out.IsValid()) {
+        throw RaylibException("Vector3SoA component buffers must have the same length");
+    }
+    detail::LerpFloats(a.x.data(), b.x.data(), amount, out.x.data(), a.size());
+    detail::LerpFloats(a.y.data(), b.y.data(), amount, out.y.data(), a.size());
+    detail::LerpFloats(a.z.data(), b.z.data(), amount, out.z.data(), a.size());
+}
+
+/**
+ * Multiply two arrays of matrices (out[i] = left[i] * right[i])
+ */
+inline void Multiply(std::span<const ::Matrix> left, std::span<const ::Matrix> right, std::span<::Matrix> out) {
+    detail::CheckSize(left.size(), right.size());
+    detail::CheckSize(left.size(), out.size());
+    for (std::size_t i = 0; i < left.size(); i++) {
+        out[i] = matrices::Multiply(left[i], right[i]);
+    }
+}
+
+/**
+ * Multiply an array of matrices by a matrix (out[i] = left[i] * right)
+ */
+inline void Multiply(std::span<const ::Matrix> left, const ::Matrix& right, std::span<::Matrix> out) {
+    detail::CheckSize(left.size(), out.size());
+    for (std::size_t i = 0; i < left.size(); i++) {
+        out[i] = matrices::Multiply(left[i], right);
+    }
+}
+
+/**
+ * Multiply a matrix by an array of matrices (out[i] = left * right[i])
+ */
+inline void Multiply(const ::Matrix& left, std::span<const ::Matrix> right, std::span<::Matrix> out) {
+    detail::CheckSize(right.size(), out.size());
+    for (std::size_t i = 0; i < right.size(); i++) {
+        out[i] = matrices::Multiply(left, right[i]);
+    }
+}
+
+/**
+ * Build instance transforms that apply `local`, then move to each position
+ * (out[i] = local * MatrixTranslate(positions[i])), for MeshUnmanaged::Draw(material, transforms, instances).
+ */
+inline void Translate(std::span<const raylib::Vector3> positions, const ::Matrix& local, std::span<::Matrix> out) {
+    detail::CheckSize(positions.size(), out.size());
+    for (std::size_t i = 0; i < positions.size(); i++) {
+        // Only the translation row of MatrixTranslate() is not identity, so the product adds a scaled copy of
+        // local's last row to each of the first three.
+        const raylib::Vector3 p = positions[i];
+        ::Matrix& m = out[i];
+        m = local;
+        m.m0 += local.m3 * p.x;
+        m.m4 += local.m7 * p.x;
+        m.m8 += local.m11 * p.x;
+        m.m12 += local.m15 * p.x;
+        m.m1 += local.m3 * p.y;
+        m.m5 += local.m7 * p.y;
+        m.m9 += local.m11 * p.y;
+        m.m13 += local.m15 * p.y;
+        m.m2 += local.m3 * p.z;
+        m.m6 += local.m7 * p.z;
+        m.m10 += local.m11 * p.z;
+        m.m14 += local.m15 * p.z;
+    }
+}
+} // namespace batch
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_BATCHMATH_HPP_
@@ -1,9 +1,13 @@
 #ifndef RAYLIB_CPP_INCLUDE_CAMERA3D_HPP_
 #define RAYLIB_CPP_INCLUDE_CAMERA3D_HPP_
 
+#include <rlgl.h>
+
+#include "./Frustum.hpp"
 #include "./Vector3.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
+#include "./raymath.hpp"
 
 namespace raylib {
 /**
@@ -65,6 +69,33 @@ public:
      */
     Matrix GetMatrix() const { return ::GetCameraMatrix(*this); }
 
+    /**
+     * Get the projection matrix BeginMode() sets up, for a render target with the given width to height ratio.
+     */
+    Matrix GetProjectionMatrix(
+        double aspect,
+        double nearPlane = RL_CULL_DISTANCE_NEAR,
+        double farPlane = RL_CULL_DISTANCE_FAR) const {
+        if (projection == CAMERA_ORTHOGRAPHIC) {
+            const double top = fovy / 2.0;
+            const double right = top * aspect;
+            return ::MatrixOrtho(-right, right, -top, top, nearPlane, farPlane);
+        }
+        return ::MatrixPerspective(fovy * DEG2RAD, aspect, nearPlane, farPlane);
+    }
+
+    /**
+     * Get the planes bounding what the camera sees, to cull bounds on the CPU without a window.
+     *
+     * @param aspect Width to height ratio of the render target, like `GetRenderWidth() / GetRenderHeight()`.
+     */
+    Frustum GetFrustum(
+        double aspect,
+        double nearPlane = RL_CULL_DISTANCE_NEAR,
+        double farPlane = RL_CULL_DISTANCE_FAR) const {
+        return Frustum(::MatrixMultiply(GetMatrix(), GetProjectionMatrix(aspect, nearPlane, farPlane)));
+    }
+
     /**
      * Update camera position for selected mode
      */
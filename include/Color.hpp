@@ -13,15 +13,15 @@ namespace raylib {
  */
 class Color : public ::Color {
 public:
-    Color(const ::Color& color) : ::Color{color.r, color.g, color.b, color.a} {}
+    constexpr Color(const ::Color& color) : ::Color{color.r, color.g, color.b, color.a} {}
 
-    Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
+    constexpr Color(unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha = 255)
         : ::Color{red, green, blue, alpha} {};
 
     /**
      * Black.
      */
-    Color() : ::Color{0, 0, 0, 255} {};
+    constexpr Color() : ::Color{0, 0, 0, 255} {};
 
     /**
      * Returns a Color from HSV values
@@ -43,12 +43,15 @@ public:
     /**
      * Returns hexadecimal value for a Color
      */
-    [[nodiscard]] int ToInt() const { return ::ColorToInt(*this); }
+    [[nodiscard]] constexpr int ToInt() const {
+        return (static_cast<int>(r) << 24) | (static_cast<int>(g) << 16) | (static_cast<int>(b) << 8) |
+               static_cast<int>(a);
+    }
 
     /**
      * Returns hexadecimal value for a Color
      */
-    explicit operator int() const { return ::ColorToInt(*this); }
+    constexpr explicit operator int() const { return ToInt(); }
 
     [[nodiscard]] std::string ToString() const { return TextFormat("Color(%d, %d, %d, %d)", r, g, b, a); }
 
@@ -57,12 +60,18 @@ public:
     /**
      * Returns color with alpha applied, alpha goes from 0.0f to 1.0f
      */
-    [[nodiscard]] Color Fade(float alpha) const { return ::Fade(*this, alpha); }
+    [[nodiscard]] constexpr Color Fade(float alpha) const { return Alpha(alpha); }
 
     /**
      * Returns Color normalized as float [0..1]
      */
-    [[nodiscard]] Vector4 Normalize() const { return ::ColorNormalize(*this); }
+    [[nodiscard]] constexpr Vector4 Normalize() const {
+        return {
+            static_cast<float>(r) / 255.0f,
+            static_cast<float>(g) / 255.0f,
+            static_cast<float>(b) / 255.0f,
+            static_cast<float>(a) / 255.0f};
+    }
 
     /**
      * Returns Color from normalized values [0..1]
@@ -79,7 +88,7 @@ public:
     GETTERSETTER(unsigned char, B, b)
     GETTERSETTER(unsigned char, A, a)
 
-    Color& operator=(const ::Color& color) {
+    constexpr Color& operator=(const ::Color& color) {
         set(color);
         return *this;
     }
@@ -185,13 +194,26 @@ public:
         return ::ColorIsEqual(*this, color);
     }
 
-    bool operator==(const ::Color& other) const { return ::ColorIsEqual(*this, other); }
-    bool operator!=(const ::Color& other) const { return !::ColorIsEqual(*this, other); }
+    constexpr bool operator==(const ::Color& other) const {
+        return r == other.r && g == other.g && b == other.b && a == other.a;
+    }
+    constexpr bool operator!=(const ::Color& other) const { return !(*this == other); }
 
     /**
      * Get color multiplied with another color
      */
-    Color Tint(::Color tint) { return ::ColorTint(*this, tint); }
+    constexpr Color Tint(::Color tint) const {
+        const float cR = static_cast<float>(tint.r) / 255;
+        const float cG = static_cast<float>(tint.g) / 255;
+        const float cB = static_cast<float>(tint.b) / 255;
+        const float cA = static_cast<float>(tint.a) / 255;
+
+        return {
+            static_cast<unsigned char>(((static_cast<float>(r) / 255 * cR) * 255.0f)),
+            static_cast<unsigned char>(((static_cast<float>(g) / 255 * cG) * 255.0f)),
+            static_cast<unsigned char>(((static_cast<float>(b) / 255 * cB) * 255.0f)),
+            static_cast<unsigned char>(((static_cast<float>(a) / 255 * cA) * 255.0f))};
+    }
 
     /**
      * Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
@@ -206,10 +228,31 @@ public:
     /**
      * Returns color with alpha applied, alpha goes from 0.0f to 1.0f
      */
-    [[nodiscard]] Color Alpha(float alpha) const { return ::ColorAlpha(*this, alpha); }
+    [[nodiscard]] constexpr Color Alpha(float alpha) const {
+        if (alpha < 0.0f) {
+            alpha = 0.0f;
+        } else if (alpha > 1.0f) {
+            alpha = 1.0f;
+        }
+
+        return {r, g, b, static_cast<unsigned char>(255.0f * alpha)};
+    }
 
-    Color Lerp(::Color color2, float factor) {
-        return ::ColorLerp(*this, color2, factor);
+    /**
+     * Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+     */
+    [[nodiscard]] constexpr Color Lerp(::Color color2, float factor) const {
+        if (factor < 0.0f) {
+            factor = 0.0f;
+        } else if (factor > 1.0f) {
+            factor = 1.0f;
+        }
+
+        return {
+            static_cast<unsigned char>((1.0f - factor) * r + factor * color2.r),
+            static_cast<unsigned char>((1.0f - factor) * g + factor * color2.g),
+            static_cast<unsigned char>((1.0f - factor) * b + factor * color2.b),
+            static_cast<unsigned char>((1.0f - factor) * a + factor * color2.a)};
     }
 
     /**
@@ -217,34 +260,34 @@ public:
      */
     [[nodiscard]] Color AlphaBlend(::Color dst, ::Color tint) const { return ::ColorAlphaBlend(dst, *this, tint); }
 
-    static Color LightGray() { return LIGHTGRAY; }
-    static Color Gray() { return GRAY; }
-    static Color DarkGray() { return DARKGRAY; }
-    static Color Yellow() { return YELLOW; }
-    static Color Gold() { return GOLD; }
-    static Color Orange() { return ORANGE; }
-    static Color Pink() { return PINK; }
-    static Color Red() { return RED; }
-    static Color Maroon() { return MAROON; }
-    static Color Green() { return GREEN; }
-    static Color Lime() { return LIME; }
-    static Color DarkGreen() { return DARKGREEN; }
-    static Color SkyBlue() { return SKYBLUE; }
-    static Color Blue() { return BLUE; }
-    static Color DarkBlue() { return DARKBLUE; }
-    static Color Purple() { return PURPLE; }
-    static Color Violet() { return VIOLET; }
-    static Color DarkPurple() { return DARKPURPLE; }
-    static Color Beige() { return BEIGE; }
-    static Color Brown() { return BROWN; }
-    static Color DarkBrown() { return DARKBROWN; }
-    static Color White() { return WHITE; }
-    static Color Black() { return BLACK; }
-    static Color Blank() { return BLANK; }
-    static Color Magenta() { return MAGENTA; }
-    static Color RayWhite() { return RAYWHITE; }
+    static constexpr Color LightGray() { return LIGHTGRAY; }
+    static constexpr Color Gray() { return GRAY; }
+    static constexpr Color DarkGray() { return DARKGRAY; }
+    static constexpr Color Yellow() { return YELLOW; }
+    static constexpr Color Gold() { return GOLD; }
+    static constexpr Color Orange() { return ORANGE; }
+    static constexpr Color Pink() { return PINK; }
+    static constexpr Color Red() { return RED; }
+    static constexpr Color Maroon() { return MAROON; }
+    static constexpr Color Green() { return GREEN; }
+    static constexpr Color Lime() { return LIME; }
+    static constexpr Color DarkGreen() { return DARKGREEN; }
+    static constexpr Color SkyBlue() { return SKYBLUE; }
+    static constexpr Color Blue() { return BLUE; }
+    static constexpr Color DarkBlue() { return DARKBLUE; }
+    static constexpr Color Purple() { return PURPLE; }
+    static constexpr Color Violet() { return VIOLET; }
+    static constexpr Color DarkPurple() { return DARKPURPLE; }
+    static constexpr Color Beige() { return BEIGE; }
+    static constexpr Color Brown() { return BROWN; }
+    static constexpr Color DarkBrown() { return DARKBROWN; }
+    static constexpr Color White() { return WHITE; }
+    static constexpr Color Black() { return BLACK; }
+    static constexpr Color Blank() { return BLANK; }
+    static constexpr Color Magenta() { return MAGENTA; }
+    static constexpr Color RayWhite() { return RAYWHITE; }
 protected:
-    void set(const ::Color& color) {
+    constexpr void set(const ::Color& color) {
         r = color.r;
         g = color.g;
         b = color.b;
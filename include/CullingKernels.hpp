@@ -0,0 +1,177 @@
+#ifndef RAYLIB_CPP_INCLUDE_CULLINGKERNELS_HPP_
+#define RAYLIB_CPP_INCLUDE_CULLINGKERNELS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "./Frustum.hpp"
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Frustum culling over arrays of bounds, several bounds per SIMD instruction.
+ *
+ * Each function writes the indices of the bounds that may be visible, in increasing order, with the same answers as
+ * Frustum::CheckCollision() gives one at a time. Bounds can come from Model::GetBoundingBox() or
+ * MeshUnmanaged::BoundingBox(), once per frame or whenever they move, so only the visible models get drawn.
+ * Every function also has an overload that splits the bounds into chunks on a ThreadPool.
+ *
+ * @code
+ * raylib::Frustum frustum = camera.GetFrustum(GetRenderWidth() / static_cast<double>(GetRenderHeight()));
+ * raylib::culling::GetVisible(frustum, bounds, visible);
+ * for (int i : visible) {
+ *     models[i].Draw(positions[i]);
+ * }
+ * @endcode
+ *
+ * @see raylib-cpp-simd.hpp for the instruction set in use.
+ */
+namespace culling {
+/**
+ * A bounding sphere.
+ */
+struct Sphere {
+    ::Vector3 center;
+    float radius;
+};
+
+namespace detail {
+using simd::floatv;
+
+constexpr std::size_t lanes = simd::width;
+
+inline void CheckCount(std::size_t count) {
+    if (count > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        throw RaylibException("Frustum culling takes at most INT_MAX bounds");
+    }
+}
+
+/** The signed distances of points from a plane, summed in the same order as Frustum's */
+inline floatv Distance(const ::Vector4& plane, floatv x, floatv y, floatv z) {
+    return simd::Add(
+        simd::Add(
+            simd::Add(simd::Mul(simd::Set(plane.x), x), simd::Mul(simd::Set(plane.y), y)),
+            simd::Mul(simd::Set(plane.z), z)),
+        simd::Set(plane.w));
+}
+
+/** A bit per lane for the bounds that are outside one of the planes */
+inline unsigned int Outside(const Frustum& frustum, const ::BoundingBox* boxes, std::size_t count) {
+    const auto v = simd::Gather<6>(boxes, count, [](const ::BoundingBox& box) {
+        return std::array<float, 6>{box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z};
+    });
+    const floatv zero = simd::Set(0.0f);
+    floatv outside = simd::Greater(zero, zero);
+    for (const ::Vector4& plane : frustum.GetPlanes()) {
+        // The corner furthest along the normal, picked per plane since the normal is the same for every lane.
+        const floatv x = plane.x >= 0.0f ? v[3] : v[0];
+        const floatv y = plane.y >= 0.0f ? v[4] : v[1];
+        const floatv z = plane.z >= 0.0f ? v[5] : v[2];
+        outside = simd::Or(outside, simd::Greater(zero, Distance(plane, x, y, z)));
+    }
+    return simd::MoveMask(outside);
+}
+
+inline unsigned int Outside(const Frustum& frustum, const Sphere* spheres, std::size_t count) {
+    const auto v = simd::Gather<4>(spheres, count, [](const Sphere& sphere) {
+        return std::array<float, 4>{sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius};
+    });
+    const floatv zero = simd::Set(0.0f);
+    const floatv reach = simd::Sub(zero, v[3]);
+    floatv outside = simd::Greater(zero, zero);
+    for (const ::Vector4& plane : frustum.GetPlanes()) {
+        outside = simd::Or(outside, simd::Greater(reach, Distance(plane, v[0], v[1], v[2])));
+    }
+    return simd::MoveMask(outside);
+}
+
+template<typename T>
+void Collect(
+    const Frustum& frustum,
+    std::span<const T> bounds,
+    std::size_t begin,
+    std::size_t end,
+    std::vector<int>& visible) {
+    for (std::size_t first = begin; first < end; first += lanes) {
+        const std::size_t count = std::min(lanes, end - first);
+        // Most bounds are culled, so walk the set bits of the visible lanes rather than every lane.
+        unsigned int inside = ~Outside(frustum, bounds.data() + first, count) & ((1u << count) - 1u);
+        while (inside != 0) {
+            visible.push_back(static_cast<int>(first) + std::countr_zero(inside));
+            inside &= inside - 1u;
+        }
+    }
+}
+
+template<typename T>
+void GetVisible(
+    const Frustum& frustum,
+    std::span<const T> bounds,
+    std::vector<int>& visible,
+    ThreadPool* pool,
+    std::size_t grain) {
+    CheckCount(bounds.size());
+    visible.clear();
+    if (pool == nullptr) {
+        Collect(frustum, bounds, 0, bounds.size(), visible);
+        return;
+    }
+
+    // Chunks of whole registers.
+    grain = std::max(lanes, grain / lanes * lanes);
+    pool->ParallelCollect(0, bounds.size(), grain, visible, [&](std::size_t begin, std::size_t end, auto& out) {
+        Collect(frustum, bounds, begin, end, out);
+    });
+}
+} // namespace detail
+
+/** Bounds per chunk for the ThreadPool overloads */
+constexpr std::size_t defaultGrain = 4096;
+
+/**
+ * Find the boxes that may be visible in a frustum, replacing the contents of `visible` with their indices.
+ *
+ * @throws raylib::RaylibException Thrown if there are more boxes than an int can index.
+ */
+inline void GetVisible(const Frustum& frustum, std::span<const ::BoundingBox> boxes, std::vector<int>& visible) {
+    detail::GetVisible(frustum, boxes, visible, nullptr, 0);
+}
+
+inline void GetVisible(
+    const Frustum& frustum,
+    std::span<const ::BoundingBox> boxes,
+    std::vector<int>& visible,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::GetVisible(frustum, boxes, visible, &pool, grain);
+}
+
+/**
+ * Find the spheres that may be visible in a frustum, replacing the contents of `visible` with their indices.
+ *
+ * @throws raylib::RaylibException Thrown if there are more spheres than an int can index.
+ */
+inline void GetVisible(const Frustum& frustum, std::span<const Sphere> spheres, std::vector<int>& visible) {
+    detail::GetVisible(frustum, spheres, visible, nullptr, 0);
+}
+
+inline void GetVisible(
+    const Frustum& frustum,
+    std::span<const Sphere> spheres,
+    std::vector<int>& visible,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::GetVisible(frustum, spheres, visible, &pool, grain);
+}
+} // namespace culling
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_CULLINGKERNELS_HPP_
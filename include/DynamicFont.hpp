@@ -0,0 +1,533 @@
+#ifndef RAYLIB_CPP_INCLUDE_DYNAMICFONT_HPP_
+#define RAYLIB_CPP_INCLUDE_DYNAMICFONT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <rlgl.h>
+
+#include "./FileData.hpp"
+#include "./RaylibException.hpp"
+#include "./SkylinePacker.hpp"
+#include "./TextureUnmanaged.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * A font that rasterizes its glyphs the first time they are drawn, and packs them into texture pages.
+ *
+ * Font::Load() with a list of codepoints bakes all of them into one texture up front, which is slow and large for
+ * CJK text. A DynamicFont starts empty: drawing or measuring text rasterizes the glyphs it hasn't seen yet, packs
+ * them into the pages with a SkylinePacker, and uploads only the new pixels. When every page is full, the page
+ * that was drawn from least recently is cleared and reused, and EvictCold() frees the pages that haven't been
+ * drawn from for a while.
+ *
+ * Rasterizing and packing only use the CPU, so they work without a window; the page textures are created and
+ * updated when text is drawn.
+ *
+ * @code
+ * raylib::DynamicFont font("resources/NotoSansCJK.otf", 32);
+ *
+ * font.DrawText("你好, world", {10, 10}, 32, 1, BLACK);
+ * font.NextFrame();
+ * font.EvictCold(600);
+ * @endcode
+ */
+class DynamicFont {
+public:
+    /**
+     * A rasterized glyph, as an 8 bit coverage bitmap.
+     */
+    struct Bitmap {
+        int width{0};
+        int height{0};
+        int offsetX{0};
+        int offsetY{0};
+        int advanceX{0};
+        /** width * height coverage values, row by row */
+        std::vector<unsigned char> alpha;
+    };
+
+    /**
+     * Rasterizes a codepoint at the font's size. Returns false if the font doesn't have the codepoint.
+     */
+    using Rasterizer = std::function<bool(int codepoint, Bitmap& bitmap)>;
+
+    /**
+     * A glyph's metrics, and where it is packed.
+     */
+    struct Glyph {
+        /** The page with the glyph's pixels, or -1 when its page was evicted */
+        int page{-1};
+        ::Rectangle rec{0, 0, 0, 0};
+        int offsetX{0};
+        int offsetY{0};
+        int advanceX{0};
+    };
+
+    /**
+     * @param rasterizer Rasterizes a codepoint at `baseSize` pixels.
+     * @param baseSize The size of the rasterized glyphs, in pixels.
+     * @param pageSize The width and height of the texture pages.
+     * @param maxPages The number of pages to keep before reusing them.
+     * @param padding Empty pixels around every glyph in a page, so glyphs don't bleed into each other.
+     */
+    DynamicFont(Rasterizer rasterizer, int baseSize, int pageSize = 512, int maxPages = 4, int padding = 1)
+        : rasterizer(std::move(rasterizer))
+        , baseSize(baseSize)
+        , pageSize(pageSize)
+        , maxPages(std::max(1, maxPages))
+        , padding(padding) {
+        // Nothing.
+    }
+
+    /**
+     * Rasterize the glyphs of a TTF or OTF file with ::LoadFontData().
+     *
+     * @throws raylib::RaylibException Throws if the file failed to load.
+     */
+    DynamicFont(const std::string& fileName, int baseSize, int pageSize = 512, int maxPages = 4, int padding = 1)
+        : DynamicFont(LoadFontDataRasterizer(fileName, baseSize), baseSize, pageSize, maxPages, padding) {
+        // Nothing.
+    }
+
+    DynamicFont(const DynamicFont&) = delete;
+    DynamicFont& operator=(const DynamicFont&) = delete;
+
+    DynamicFont(DynamicFont&& other) noexcept = default;
+
+    DynamicFont& operator=(DynamicFont&& other) noexcept {
+        if (this != &other) {
+            Unload();
+            rasterizer = std::move(other.rasterizer);
+            baseSize = other.baseSize;
+            pageSize = other.pageSize;
+            maxPages = other.maxPages;
+            padding = other.padding;
+            lineSpacing = other.lineSpacing;
+            frame = other.frame;
+            glyphs = std::move(other.glyphs);
+            missing = std::move(other.missing);
+            pages = std::move(other.pages);
+            other.pages.clear();
+        }
+        return *this;
+    }
+
+    ~DynamicFont() { Unload(); }
+
+    /**
+     * Unload the page textures, and forget every glyph.
+     */
+    void Unload() {
+        for (Page& page : pages) {
+            if (page.texture.id != 0) {
+                page.texture.Unload();
+            }
+        }
+        pages.clear();
+        glyphs.clear();
+        missing.clear();
+    }
+
+    GETTER(int, BaseSize, baseSize)
+    GETTER(int, PageSize, pageSize)
+    GETTER(int, MaxPages, maxPages)
+
+    /**
+     * Extra space between lines, like ::SetTextLineSpacing(). raylib's default is 2.
+     */
+    GETTERSETTER(int, LineSpacing, lineSpacing)
+
+    /**
+     * Retrieve a glyph, rasterizing and packing it if needed, and mark its page as used in this frame.
+     *
+     * Codepoints the font doesn't have get the '?' glyph.
+     *
+     * @return The glyph, or nullptr if the font has neither the codepoint nor '?'. The pointer stays valid until
+     * Unload().
+     */
+    const Glyph* GetGlyph(int codepoint) { return Find(codepoint, true); }
+
+    /**
+     * Draw text, like ::DrawTextEx().
+     */
+    void DrawText(std::string_view text, ::Vector2 position, float fontSize, float spacing, ::Color tint = WHITE) {
+        const float scale = fontSize / static_cast<float>(baseSize);
+        float offsetX = 0.0f;
+        int offsetY = 0;
+        ForEachCodepoint(text, [&](int codepoint) {
+            if (codepoint == '\n') {
+                offsetY += static_cast<int>(fontSize + static_cast<float>(lineSpacing));
+                offsetX = 0.0f;
+                return;
+            }
+            const Glyph* glyph = GetGlyph(codepoint);
+            if (glyph == nullptr) {
+                return;
+            }
+            if (codepoint != ' ' && codepoint != '\t' && glyph->page >= 0) {
+                // rlgl may flush the render batch on any quad, so a glyph's pixels must be on the texture before
+                // its quad is queued. Upload() does nothing when the page hasn't changed.
+                Page& page = pages[static_cast<std::size_t>(glyph->page)];
+                Upload(page);
+                ::DrawTexturePro(
+                    page.texture,
+                    glyph->rec,
+                    {position.x + offsetX + static_cast<float>(glyph->offsetX) * scale,
+                     position.y + static_cast<float>(offsetY) + static_cast<float>(glyph->offsetY) * scale,
+                     glyph->rec.width * scale,
+                     glyph->rec.height * scale},
+                    {0.0f, 0.0f},
+                    0.0f,
+                    tint);
+            }
+            offsetX += static_cast<float>(Advance(*glyph)) * scale + spacing;
+        });
+    }
+
+    /**
+     * Measure text, like ::MeasureTextEx(). Rasterizes the glyphs it hasn't seen yet.
+     */
+    [[nodiscard]] ::Vector2 MeasureText(std::string_view text, float fontSize, float spacing) {
+        if (text.empty()) {
+            return {0.0f, 0.0f};
+        }
+        float width = 0.0f;
+        float maxWidth = 0.0f;
+        float height = fontSize;
+        int codepoints = 0;
+        int maxCodepoints = 0;
+        ForEachCodepoint(text, [&](int codepoint) {
+            codepoints++;
+            if (codepoint == '\n') {
+                maxWidth = std::max(maxWidth, width);
+                width = 0.0f;
+                codepoints = 0;
+                height += fontSize + static_cast<float>(lineSpacing);
+            } else if (const Glyph* glyph = Find(codepoint, false); glyph != nullptr) {
+                width += static_cast<float>(
+                    glyph->advanceX > 0 ? glyph->advanceX : static_cast<int>(glyph->rec.width) + glyph->offsetX);
+            }
+            maxCodepoints = std::max(maxCodepoints, codepoints);
+        });
+        maxWidth = std::max(maxWidth, width);
+        return {
+            maxWidth * fontSize / static_cast<float>(baseSize) + static_cast<float>(maxCodepoints - 1) * spacing,
+            height};
+    }
+
+    /**
+     * Start a new frame, for tracking which pages are in use.
+     */
+    void NextFrame() { frame++; }
+
+    /**
+     * Free the pages that haven't been drawn from in the last `frames` frames. Their glyphs are rasterized again
+     * when they are drawn.
+     *
+     * @return The number of pages freed.
+     */
+    int EvictCold(unsigned int frames) {
+        int evicted = 0;
+        for (std::size_t i = 0; i < pages.size(); i++) {
+            if (!pages[i].pixels.empty() && frame - pages[i].lastUsed > frames) {
+                Evict(i);
+                pages[i].pixels.clear();
+                pages[i].pixels.shrink_to_fit();
+                if (pages[i].texture.id != 0) {
+                    pages[i].texture.Unload();
+                    pages[i].texture.id = 0;
+                }
+                evicted++;
+            }
+        }
+        return evicted;
+    }
+
+    /**
+     * Retrieve the number of pages, including freed ones.
+     */
+    [[nodiscard]] int GetPageCount() const { return static_cast<int>(pages.size()); }
+
+    /**
+     * Retrieve the pixels of a page, as PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA like the atlas of a raylib::Font.
+     * Freed pages have no pixels.
+     */
+    [[nodiscard]] std::span<const unsigned char> GetPagePixels(int page) const {
+        return pages[static_cast<std::size_t>(page)].pixels;
+    }
+
+    /**
+     * Retrieve a page's texture, which is created when text is drawn from the page.
+     */
+    [[nodiscard]] TextureUnmanaged GetPageTexture(int page) const {
+        return pages[static_cast<std::size_t>(page)].texture;
+    }
+
+    /**
+     * Retrieve the fraction of a page covered by glyphs.
+     */
+    [[nodiscard]] float GetPageOccupancy(int page) const {
+        return pages[static_cast<std::size_t>(page)].packer.GetOccupancy();
+    }
+
+    /**
+     * Retrieve the number of glyphs rasterized so far, including ones whose page was evicted.
+     */
+    [[nodiscard]] std::size_t GetGlyphCount() const { return glyphs.size(); }
+
+    /**
+     * A rasterizer for a TTF or OTF file, using ::LoadFontData().
+     *
+     * @throws raylib::RaylibException Throws if the file failed to load.
+     */
+    static Rasterizer LoadFontDataRasterizer(const std::string& fileName, int fontSize) {
+        auto file = std::make_shared<FileData>(fileName);
+        if (file->GetData() == nullptr) {
+            throw RaylibException("Failed to load font data from file: " + fileName);
+        }
+        return [file, fontSize](int codepoint, Bitmap& bitmap) {
+            int wanted = codepoint;
+            ::GlyphInfo* info =
+                ::LoadFontData(file->GetData(), file->GetBytesRead(), fontSize, &wanted, 1, FONT_DEFAULT);
+            if (info == nullptr) {
+                return false;
+            }
+            const ::Image& image = info->image;
+            if (info->advanceX == 0 && (image.width == 0 || image.height == 0)) {
+                // ::LoadFontData() leaves the glyphs the font doesn't have empty.
+                ::UnloadFontData(info, 1);
+                return false;
+            }
+            bitmap.width = image.width;
+            bitmap.height = image.height;
+            bitmap.offsetX = info->offsetX;
+            bitmap.offsetY = info->offsetY;
+            bitmap.advanceX = info->advanceX;
+            const std::size_t size = static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height);
+            if (image.data != nullptr && image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) {
+                const auto* data = static_cast<const unsigned char*>(image.data);
+                bitmap.alpha.assign(data, data + size);
+            } else {
+                bitmap.alpha.assign(size, 0);
+            }
+            ::UnloadFontData(info, 1);
+            return true;
+        };
+    }
+protected:
+    struct Page {
+        SkylinePacker packer;
+        /** GRAY_ALPHA pixels, or empty when the page was freed */
+        std::vector<unsigned char> pixels;
+        TextureUnmanaged texture;
+        unsigned int lastUsed{0};
+        /** The pixels changed since the last upload, as a bounding box */
+        int dirtyLeft{0};
+        int dirtyTop{0};
+        int dirtyRight{0};
+        int dirtyBottom{0};
+    };
+
+    template<typename F>
+    static void ForEachCodepoint(std::string_view text, F&& fn) {
+        // ::GetCodepointNext() may read up to four bytes, so decode from a terminated copy.
+        const std::string terminated(text);
+        const std::size_t length = std::strlen(terminated.c_str());
+        for (std::size_t i = 0; i < length;) {
+            int byteCount = 0;
+            const int codepoint = ::GetCodepointNext(terminated.c_str() + i, &byteCount);
+            i += static_cast<std::size_t>(byteCount);
+            fn(codepoint);
+        }
+    }
+
+    /**
+     * Retrieve a glyph, rasterizing it if it's new. Glyphs whose page was evicted are rasterized again only when
+     * they are going to be drawn, which also marks their page as used.
+     */
+    const Glyph* Find(int codepoint, bool draw) {
+        auto found = glyphs.find(codepoint);
+        if (found == glyphs.end()) {
+            Bitmap bitmap;
+            if (missing.contains(codepoint) || !rasterizer(codepoint, bitmap)) {
+                missing.insert(codepoint);
+                return codepoint != '?' ? Find('?', draw) : nullptr;
+            }
+            found = glyphs.emplace(codepoint, Glyph{-1, {}, bitmap.offsetX, bitmap.offsetY, bitmap.advanceX}).first;
+            Pack(found->second, bitmap);
+        } else if (draw && found->second.page < 0) {
+            Bitmap bitmap;
+            if (rasterizer(codepoint, bitmap)) {
+                Pack(found->second, bitmap);
+            }
+        }
+        if (draw && found->second.page >= 0) {
+            pages[static_cast<std::size_t>(found->second.page)].lastUsed = frame;
+        }
+        return &found->second;
+    }
+
+    static int Advance(const Glyph& glyph) {
+        return glyph.advanceX == 0 ? static_cast<int>(glyph.rec.width) : glyph.advanceX;
+    }
+
+    /**
+     * Find room for a glyph's bitmap, clearing the least recently used page if every page is full, and copy it in.
+     */
+    void Pack(Glyph& glyph, const Bitmap& bitmap) {
+        const int width = bitmap.width + 2 * padding;
+        const int height = bitmap.height + 2 * padding;
+        if (width > pageSize || height > pageSize) {
+            ::TraceLog(LOG_WARNING, "FONT: Glyph of %ix%i pixels doesn't fit a page of %i", width, height, pageSize);
+            return;
+        }
+
+        ::Rectangle rec;
+        std::size_t index = 0;
+        for (; index < pages.size(); index++) {
+            if (!pages[index].pixels.empty() && pages[index].packer.Pack(width, height, rec)) {
+                break;
+            }
+        }
+        if (index == pages.size()) {
+            // Reuse a freed page, add one, or clear the least recently used one.
+            index = static_cast<std::size_t>(
+                std::find_if(pages.begin(), pages.end(), [](const Page& page) { return page.pixels.empty(); }) -
+                pages.begin());
+            if (index == pages.size() && pages.size() >= static_cast<std::size_t>(maxPages)) {
+                index = static_cast<std::size_t>(
+                    std::min_element(
+                        pages.begin(),
+                        pages.end(),
+                        [](const Page& a, const Page& b) { return a.lastUsed < b.lastUsed; }) -
+                    pages.begin());
+                Evict(index);
+            } else if (index == pages.size()) {
+                pages.emplace_back();
+            }
+            Page& page = pages[index];
+            page.packer.Reset(pageSize, pageSize);
+            page.pixels.assign(static_cast<std::size_t>(pageSize) * static_cast<std::size_t>(pageSize) * 2, 0);
+            for (std::size_t i = 0; i < page.pixels.size(); i += 2) {
+                page.pixels[i] = 255;
+            }
+            MarkDirty(page, 0, 0, pageSize, pageSize);
+            page.packer.Pack(width, height, rec);
+        }
+
+        Page& page = pages[index];
+        const int left = static_cast<int>(rec.x) + padding;
+        const int top = static_cast<int>(rec.y) + padding;
+        for (int y = 0; y < bitmap.height; y++) {
+            const std::size_t row = static_cast<std::size_t>(top + y) * static_cast<std::size_t>(pageSize);
+            for (int x = 0; x < bitmap.width; x++) {
+                const std::size_t pixel = row + static_cast<std::size_t>(left + x);
+                page.pixels[pixel * 2 + 1] =
+                    bitmap.alpha[static_cast<std::size_t>(y) * static_cast<std::size_t>(bitmap.width) +
+                                 static_cast<std::size_t>(x)];
+            }
+        }
+        MarkDirty(page, left, top, left + bitmap.width, top + bitmap.height);
+        glyph.page = static_cast<int>(index);
+        glyph.rec = {
+            static_cast<float>(left),
+            static_cast<float>(top),
+            static_cast<float>(bitmap.width),
+            static_cast<float>(bitmap.height)};
+    }
+
+    /**
+     * Forget which glyphs are on a page, so they are rasterized again when they are drawn.
+     */
+    void Evict(std::size_t index) {
+        Page& page = pages[index];
+        if (page.texture.id != 0 && page.lastUsed == frame) {
+            // Text drawn from the page in this frame may still be waiting in the render batch, so draw it before
+            // the page changes.
+            ::rlDrawRenderBatchActive();
+        }
+        for (auto& [codepoint, glyph] : glyphs) {
+            if (glyph.page == static_cast<int>(index)) {
+                glyph.page = -1;
+            }
+        }
+    }
+
+    static void MarkDirty(Page& page, int left, int top, int right, int bottom) {
+        if (page.dirtyRight <= page.dirtyLeft || page.dirtyBottom <= page.dirtyTop) {
+            page.dirtyLeft = left;
+            page.dirtyTop = top;
+            page.dirtyRight = right;
+            page.dirtyBottom = bottom;
+        } else {
+            page.dirtyLeft = std::min(page.dirtyLeft, left);
+            page.dirtyTop = std::min(page.dirtyTop, top);
+            page.dirtyRight = std::max(page.dirtyRight, right);
+            page.dirtyBottom = std::max(page.dirtyBottom, bottom);
+        }
+    }
+
+    /**
+     * Create the page's texture, or update it with the pixels that changed since the last upload.
+     */
+    void Upload(Page& page) {
+        if (page.dirtyRight <= page.dirtyLeft || page.dirtyBottom <= page.dirtyTop) {
+            return;
+        }
+        if (page.texture.id == 0) {
+            ::Image image{page.pixels.data(), pageSize, pageSize, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA};
+            page.texture.Load(image);
+        } else {
+            const int width = page.dirtyRight - page.dirtyLeft;
+            const int height = page.dirtyBottom - page.dirtyTop;
+            std::vector<unsigned char>& region = uploadBuffer;
+            region.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 2);
+            for (int y = 0; y < height; y++) {
+                const auto row = static_cast<std::size_t>(page.dirtyTop + y) * static_cast<std::size_t>(pageSize);
+                const std::size_t from = (row + static_cast<std::size_t>(page.dirtyLeft)) * 2;
+                std::memcpy(
+                    region.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(width) * 2,
+                    page.pixels.data() + from,
+                    static_cast<std::size_t>(width) * 2);
+            }
+            page.texture.Update(
+                {static_cast<float>(page.dirtyLeft),
+                 static_cast<float>(page.dirtyTop),
+                 static_cast<float>(width),
+                 static_cast<float>(height)},
+                region.data());
+        }
+        page.dirtyLeft = page.dirtyTop = page.dirtyRight = page.dirtyBottom = 0;
+    }
+
+    Rasterizer rasterizer;
+    int baseSize;
+    int pageSize;
+    int maxPages;
+    int padding;
+    int lineSpacing{2};
+    unsigned int frame{0};
+    std::unordered_map<int, Glyph> glyphs;
+    /** Codepoints the font doesn't have */
+    std::unordered_set<int> missing;
+    std::vector<Page> pages;
+    std::vector<unsigned char> uploadBuffer;
+};
+} // namespace raylib
+
+using RDynamicFont = raylib::DynamicFont;
+
+#endif // RAYLIB_CPP_INCLUDE_DYNAMICFONT_HPP_
@@ -1,47 +1,183 @@
 #ifndef RAYLIB_CPP_INCLUDE_FILEDATA_HPP_
 #define RAYLIB_CPP_INCLUDE_FILEDATA_HPP_
 
+#include <climits>
+#include <cstddef>
+#include <span>
 #include <string>
 #include <utility>
 
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
+#if !defined(RAYLIB_CPP_NO_MMAP) && (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#define RAYLIB_CPP_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace raylib {
 
+/**
+ * File contents, either read into memory with ::LoadFileData(), or mapped into memory with Map().
+ */
 class FileData {
 public:
+    /**
+     * Access pattern hint for mapped files.
+     */
+    enum class Access {
+        /** No hint */
+        Normal,
+        /** Read from start to end, so read ahead aggressively */
+        Sequential,
+        /** Read in random order, so don't read ahead */
+        Random,
+        /** Read all of it soon, so start paging it in */
+        WillNeed,
+    };
+
     FileData() = default;
     FileData(const FileData&) = delete;
-    FileData(FileData&& other) noexcept : data(other.data), bytesRead(other.bytesRead) {
+    FileData(FileData&& other) noexcept
+        : data(other.data),
+          bytesRead(other.bytesRead),
+          size(other.size),
+          mapped(other.mapped) {
         other.data = nullptr;
         other.bytesRead = 0;
+        other.size = 0;
+        other.mapped = false;
     }
     FileData& operator=(const FileData&) = delete;
     FileData& operator=(FileData&& other) noexcept {
         std::swap(data, other.data);
         std::swap(bytesRead, other.bytesRead);
+        std::swap(size, other.size);
+        std::swap(mapped, other.mapped);
         return *this;
     }
     ~FileData() { Unload(); }
 
     explicit FileData(const std::string& fileName) { Load(fileName); }
 
+    /**
+     * Map a file into memory.
+     *
+     * @see Map()
+     */
+    FileData(const std::string& fileName, Access access) { Map(fileName, access); }
+
     GETTER(const unsigned char*, Data, data)
     GETTER(int, BytesRead, bytesRead)
 
+    /**
+     * Retrieve the size of the data in bytes, which may be more than GetBytesRead() can hold.
+     */
+    [[nodiscard]] std::size_t GetSize() const { return size; }
+
+    /**
+     * Retrieve the data as a span of bytes.
+     */
+    [[nodiscard]] std::span<const unsigned char> GetSpan() const { return {data, size}; }
+
+    /**
+     * Retrieve whether or not the data is mapped into memory, rather than read into a buffer.
+     */
+    [[nodiscard]] bool IsMapped() const { return mapped; }
+
     void Load(const std::string& fileName) { Load(fileName.c_str()); }
-    void Load(const char* fileName) { data = ::LoadFileData(fileName, &bytesRead); }
+    void Load(const char* fileName) {
+        Unload();
+        data = ::LoadFileData(fileName, &bytesRead);
+        size = data != nullptr ? static_cast<std::size_t>(bytesRead) : 0;
+    }
+
+    /**
+     * Map a file into memory, read-only. Pages are read from the file when first accessed, and shared with the
+     * file system cache, so large files take no heap memory and load instantly.
+     *
+     * Platforms without memory mapping read the whole file with Load() instead.
+     */
+    void Map(const std::string& fileName, Access access = Access::Normal) { Map(fileName.c_str(), access); }
+    void Map(const char* fileName, Access access = Access::Normal) {
+        Unload();
+#if defined(RAYLIB_CPP_MMAP)
+        const int file = ::open(fileName, O_RDONLY);
+        struct stat info {};
+        if (file < 0 || ::fstat(file, &info) != 0 || info.st_size <= 0) {
+            if (file >= 0) {
+                ::close(file);
+            }
+            ::TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+            return;
+        }
+
+        const auto fileSize = static_cast<std::size_t>(info.st_size);
+        void* pages = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+        // The mapping keeps its own reference to the file.
+        ::close(file);
+        if (pages == MAP_FAILED) {
+            ::TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+            return;
+        }
+
+        data = static_cast<unsigned char*>(pages);
+        size = fileSize;
+        bytesRead = size > static_cast<std::size_t>(INT_MAX) ? INT_MAX : static_cast<int>(size);
+        mapped = true;
+        Advise(access);
+#else
+        (void)access;
+        Load(fileName);
+#endif
+    }
+
+    /**
+     * Hint how the mapped data will be accessed. Does nothing for data that isn't mapped.
+     */
+    void Advise(Access access) const {
+#if defined(RAYLIB_CPP_MMAP)
+        if (!mapped) {
+            return;
+        }
+        int advice = MADV_NORMAL;
+        switch (access) {
+            case Access::Normal: advice = MADV_NORMAL; break;
+            case Access::Sequential: advice = MADV_SEQUENTIAL; break;
+            case Access::Random: advice = MADV_RANDOM; break;
+            case Access::WillNeed: advice = MADV_WILLNEED; break;
+        }
+        ::madvise(data, size, advice);
+#else
+        (void)access;
+#endif
+    }
 
     void Unload() {
         if (data != nullptr) {
+#if defined(RAYLIB_CPP_MMAP)
+            if (mapped) {
+                ::munmap(data, size);
+            } else {
+                ::UnloadFileData(data);
+            }
+#else
             ::UnloadFileData(data);
+#endif
             data = nullptr;
         }
+        bytesRead = 0;
+        size = 0;
+        mapped = false;
     }
 private:
     unsigned char* data{nullptr};
     int bytesRead{0};
+    std::size_t size{0};
+    bool mapped{false};
 };
 
 } // namespace raylib
@@ -2,8 +2,13 @@
 #define RAYLIB_CPP_INCLUDE_FONT_HPP_
 
 #include <string>
+#include <string_view>
+#include <utility>
 
+#include "./FileData.hpp"
+#include "./GlyphLookup.hpp"
 #include "./RaylibException.hpp"
+#include "./TextLayout.hpp"
 #include "./TextureUnmanaged.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
@@ -11,6 +16,8 @@
 namespace raylib {
 /**
  * Font type, includes texture and charSet array data
+ *
+ * Keeps a GlyphLookup of its glyphs, built when the font is loaded or assigned, for constant time glyph lookups.
  */
 class Font : public ::Font {
 public:
@@ -22,15 +29,15 @@ public:
         ::Rectangle* recs = nullptr,
         ::GlyphInfo* glyphs = nullptr)
         : ::Font{baseSize, glyphCount, glyphPadding, texture, recs, glyphs} {
-        // Nothing.
+        lookup.Build(*this);
     }
 
     /**
      * Retrieves the default Font.
      */
-    Font() : ::Font(::GetFontDefault()) { }
+    Font() : ::Font(::GetFontDefault()) { lookup.Build(*this); }
 
-    Font(const ::Font& font) : ::Font(font) { }
+    Font(const ::Font& font) : ::Font(font) { lookup.Build(*this); }
 
     /**
      * Loads a Font from the given file.
@@ -84,9 +91,8 @@ public:
 
     Font(const Font&) = delete;
 
-    Font(Font&& other) noexcept {
-        set(other);
-
+    Font(Font&& other) noexcept : ::Font(other), lookup(std::move(other.lookup)) {
+        other.lookup = {};
         other.baseSize = 0;
         other.glyphCount = 0;
         other.glyphPadding = 0;
@@ -103,6 +109,7 @@ public:
             UnloadFont(*this);
             baseSize = 0;
         }
+        lookup = {};
     }
 
     GETTER(int, BaseSize, baseSize)
@@ -135,8 +142,10 @@ public:
         }
 
         Unload();
-        set(other);
+        static_cast<::Font&>(*this) = other;
+        lookup = std::move(other.lookup);
 
+        other.lookup = {};
         other.baseSize = 0;
         other.glyphCount = 0;
         other.glyphPadding = 0;
@@ -200,6 +209,20 @@ public:
         }
     }
 
+    /**
+     * Loads a font from file data, like a mapped raylib::FileData.
+     *
+     * @throws raylib::RaylibException Throws if the given font failed to initialize.
+     */
+    void Load(
+        const std::string& fileType,
+        const FileData& fileData,
+        int fontSize,
+        int* fontChars = nullptr,
+        int charsCount = 0) {
+        Load(fileType, fileData.GetData(), fileData.GetBytesRead(), fontSize, fontChars, charsCount);
+    }
+
     /**
      * Returns if the font is ready to be used.
      */
@@ -297,10 +320,38 @@ public:
         return ::MeasureTextEx(*this, text.c_str(), fontSize, spacing);
     }
 
+    /**
+     * Draw text using font and additional parameters, with the layout from a cache.
+     */
+    void DrawText(
+        TextLayoutCache& cache,
+        std::string_view text,
+        ::Vector2 position,
+        float fontSize,
+        float spacing,
+        ::Color tint = WHITE) const {
+        cache.Get(*this, lookup, text, fontSize, spacing).Draw(position, tint);
+    }
+
+    /**
+     * Measure string size for Font, with the layout from a cache.
+     */
+    [[nodiscard]] Vector2 MeasureText(TextLayoutCache& cache, std::string_view text, float fontSize, float spacing)
+        const {
+        return cache.Get(*this, lookup, text, fontSize, spacing).size;
+    }
+
     /**
      * Get index position for a unicode character on font
      */
-    [[nodiscard]] int GetGlyphIndex(int character) const { return ::GetGlyphIndex(*this, character); }
+    [[nodiscard]] int GetGlyphIndex(int character) const {
+        return lookup.IsEmpty() ? ::GetGlyphIndex(*this, character) : lookup.GetIndex(character);
+    }
+
+    /**
+     * Get the codepoint to glyph index lookup, built when the font was loaded.
+     */
+    [[nodiscard]] const GlyphLookup& GetGlyphLookup() const { return lookup; }
 
     /**
      * Create an image from text (custom sprite font)
@@ -323,7 +374,10 @@ protected:
         texture = font.texture;
         recs = font.recs;
         glyphs = font.glyphs;
+        lookup.Build(font);
     }
+
+    GlyphLookup lookup;
 };
 } // namespace raylib
 
@@ -0,0 +1,123 @@
+#ifndef RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
+#define RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
+
+#include <array>
+#include <cmath>
+
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * The six planes bounding what a camera sees, to test bounds against on the CPU.
+ *
+ * Each plane is a Vector4 of a unit normal pointing inside and a distance, so a point is inside when
+ * `normal . point + w >= 0` for every plane. Box and sphere tests are conservative: a few bounds near the corners of
+ * the frustum pass without being visible, and nothing visible is ever rejected.
+ */
+class Frustum {
+public:
+    enum Plane { Left = 0, Right, Bottom, Top, Near, Far };
+
+    Frustum() = default;
+
+    /**
+     * Extract the planes of a combined view and projection matrix, as `MatrixMultiply(view, projection)`.
+     */
+    explicit Frustum(const ::Matrix& viewProjection) { Set(viewProjection); }
+
+    void Set(const ::Matrix& m) {
+        // Rows of the matrix that takes a point to clip space, where visible points have -w <= x, y, z <= w.
+        const ::Vector4 x{m.m0, m.m4, m.m8, m.m12};
+        const ::Vector4 y{m.m1, m.m5, m.m9, m.m13};
+        const ::Vector4 z{m.m2, m.m6, m.m10, m.m14};
+        const ::Vector4 w{m.m3, m.m7, m.m11, m.m15};
+        planes[Left] = Normalize({w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w});
+        planes[Right] = Normalize({w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w});
+        planes[Bottom] = Normalize({w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w});
+        planes[Top] = Normalize({w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w});
+        planes[Near] = Normalize({w.x + z.x, w.y + z.y, w.z + z.z, w.w + z.w});
+        planes[Far] = Normalize({w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w});
+    }
+
+    [[nodiscard]] const std::array<::Vector4, 6>& GetPlanes() const { return planes; }
+
+    [[nodiscard]] ::Vector4 GetPlane(Plane plane) const { return planes[plane]; }
+
+    /**
+     * Check whether a point is inside the frustum.
+     */
+    [[nodiscard]] bool CheckCollision(::Vector3 point) const {
+        for (const ::Vector4& plane : planes) {
+            if (Distance(plane, point) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Check whether a sphere may be visible.
+     */
+    [[nodiscard]] bool CheckCollision(::Vector3 center, float radius) const {
+        for (const ::Vector4& plane : planes) {
+            if (Distance(plane, center) < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Check whether a box may be visible: no plane has all of its corners outside.
+     */
+    [[nodiscard]] bool CheckCollision(const ::BoundingBox& box) const {
+        for (const ::Vector4& plane : planes) {
+            // The corner furthest along the normal.
+            const ::Vector3 corner{
+                plane.x >= 0.0f ? box.max.x : box.min.x,
+                plane.y >= 0.0f ? box.max.y : box.min.y,
+                plane.z >= 0.0f ? box.max.z : box.min.z};
+            if (Distance(plane, corner) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Check whether a box is entirely inside the frustum.
+     */
+    [[nodiscard]] bool Contains(const ::BoundingBox& box) const {
+        for (const ::Vector4& plane : planes) {
+            // The corner furthest against the normal.
+            const ::Vector3 corner{
+                plane.x >= 0.0f ? box.min.x : box.max.x,
+                plane.y >= 0.0f ? box.min.y : box.max.y,
+                plane.z >= 0.0f ? box.min.z : box.max.z};
+            if (Distance(plane, corner) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+protected:
+    std::array<::Vector4, 6> planes{};
+
+    static ::Vector4 Normalize(::Vector4 plane) {
+        const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if (length == 0.0f) {
+            return plane;
+        }
+        const float inverse = 1.0f / length;
+        return {plane.x * inverse, plane.y * inverse, plane.z * inverse, plane.w * inverse};
+    }
+
+    static float Distance(const ::Vector4& plane, ::Vector3 point) {
+        return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+    }
+};
+} // namespace raylib
+
+using RFrustum = raylib::Frustum;
+
+#endif // RAYLIB_CPP_INCLUDE_FRUSTUM_HPP_
@@ -0,0 +1,102 @@
+#ifndef RAYLIB_CPP_INCLUDE_GLYPHLOOKUP_HPP_
+#define RAYLIB_CPP_INCLUDE_GLYPHLOOKUP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Constant time codepoint to glyph index lookup for a font.
+ *
+ * ::GetGlyphIndex() searches the font's glyphs linearly for every character. The lookup is built once from the
+ * glyphs: a table indexed by codepoint up to the highest codepoint below 0x10000, and a hash map for the rest.
+ * It gives the same indices as ::GetGlyphIndex(), including falling back to the '?' glyph, or the first glyph.
+ */
+class GlyphLookup {
+public:
+    GlyphLookup() = default;
+
+    explicit GlyphLookup(const ::Font& font) { Build(font); }
+
+    /**
+     * Build the lookup for the glyphs of a font.
+     */
+    void Build(const ::Font& font) {
+        table.clear();
+        overflow.clear();
+        fallback = 0;
+        if (font.glyphs == nullptr || font.glyphCount <= 0) {
+            return;
+        }
+
+        int highest = 0;
+        for (int i = 0; i < font.glyphCount; i++) {
+            if (font.glyphs[i].value < DenseLimit) {
+                highest = std::max(highest, font.glyphs[i].value);
+            }
+        }
+        table.assign(static_cast<std::size_t>(highest) + 1, Missing);
+
+        // The first glyph with a codepoint wins, like the linear search. The fallback is the last '?' glyph,
+        // which is where the search ends up when nothing matches.
+        for (int i = 0; i < font.glyphCount; i++) {
+            const int codepoint = font.glyphs[i].value;
+            if (codepoint == '?') {
+                fallback = i;
+            }
+            if (codepoint >= 0 && codepoint < DenseLimit) {
+                int& index = table[static_cast<std::size_t>(codepoint)];
+                if (index == Missing) {
+                    index = i;
+                }
+            } else {
+                overflow.emplace(codepoint, i);
+            }
+        }
+    }
+
+    /**
+     * Retrieve the glyph index for a codepoint, like ::GetGlyphIndex().
+     */
+    [[nodiscard]] int GetIndex(int codepoint) const {
+        if (codepoint >= 0 && static_cast<std::size_t>(codepoint) < table.size()) {
+            const int index = table[static_cast<std::size_t>(codepoint)];
+            return index != Missing ? index : fallback;
+        }
+        if (!overflow.empty()) {
+            const auto found = overflow.find(codepoint);
+            if (found != overflow.end()) {
+                return found->second;
+            }
+        }
+        return fallback;
+    }
+
+    /**
+     * Retrieve whether the lookup was built from a font with glyphs.
+     */
+    [[nodiscard]] bool IsEmpty() const { return table.empty() && overflow.empty(); }
+
+    /**
+     * Retrieve the memory used by the lookup, in bytes.
+     */
+    [[nodiscard]] std::size_t GetMemoryUsage() const {
+        return table.capacity() * sizeof(int) + overflow.size() * (sizeof(int) * 2 + sizeof(void*) * 2);
+    }
+private:
+    static constexpr int DenseLimit = 0x10000;
+    static constexpr int Missing = -1;
+
+    std::vector<int> table;
+    std::unordered_map<int, int> overflow;
+    int fallback{0};
+};
+} // namespace raylib
+
+using RGlyphLookup = raylib::GlyphLookup;
+
+#endif // RAYLIB_CPP_INCLUDE_GLYPHLOOKUP_HPP_
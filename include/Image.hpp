@@ -1,10 +1,19 @@
 #ifndef RAYLIB_CPP_INCLUDE_IMAGE_HPP_
 #define RAYLIB_CPP_INCLUDE_IMAGE_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <string>
 
+#include "./Allocator.hpp"
 #include "./Color.hpp"
+#include "./FileData.hpp"
+#include "./ImageView.hpp"
+#include "./ParallelImage.hpp"
+#include "./PixelKernels.hpp"
 #include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
@@ -66,6 +75,13 @@ public:
         Load(fileType, fileData, dataSize);
     }
 
+    /**
+     * Load an image from file data, like a mapped raylib::FileData.
+     *
+     * @throws raylib::RaylibException Thrown if the image failed to load from the data.
+     */
+    Image(const std::string& fileType, const FileData& fileData) { Load(fileType, fileData); }
+
     /**
      * Load an image from the given file.
      *
@@ -73,7 +89,7 @@ public:
      */
     Image(const ::Texture2D& texture) { Load(texture); }
 
-    Image(int width, int height, ::Color color = {255, 255, 255, 255}) { set(::GenImageColor(width, height, color)); }
+    Image(int width, int height, ::Color color = {255, 255, 255, 255}) { set(PooledColor(width, height, color)); }
 
     Image(const std::string& text, int fontSize, ::Color color = {255, 255, 255, 255}) {
         set(::ImageText(text.c_str(), fontSize, color));
@@ -88,7 +104,7 @@ public:
         set(::ImageTextEx(font, text.c_str(), fontSize, spacing, tint));
     }
 
-    Image(const Image& other) { set(other.Copy()); }
+    Image(const Image& other) { set(other.PooledCopy()); }
 
     Image(Image&& other) noexcept {
         set(other);
@@ -182,7 +198,7 @@ public:
         }
 
         Unload();
-        set(other.Copy());
+        set(other.PooledCopy());
 
         return *this;
     }
@@ -260,6 +276,15 @@ public:
         }
     }
 
+    /**
+     * Load image from file data, like a mapped raylib::FileData, fileType refers to extension: i.e. "png".
+     *
+     * @throws raylib::RaylibException Thrown if the image failed to load from the data.
+     */
+    void Load(const std::string& fileType, const FileData& fileData) {
+        Load(fileType, fileData.GetData(), fileData.GetBytesRead());
+    }
+
     /**
      * Load an image from the given file.
      *
@@ -279,7 +304,9 @@ public:
      */
     void Unload() {
         if (data != nullptr) {
-            ::UnloadImage(*this);
+            if (!ReleaseBuffer(data)) {
+                ::UnloadImage(*this);
+            }
             data = nullptr;
         }
     }
@@ -352,11 +379,31 @@ public:
      */
     [[nodiscard]] ::Image FromImage(::Rectangle rec) const { return ::ImageFromImage(*this, rec); }
 
+    /**
+     * Get a view of the image pixels, without copying them
+     */
+    [[nodiscard]] ImageView GetView() { return ImageView(*this); }
+
+    /**
+     * Get a view of an image piece, without copying it
+     */
+    [[nodiscard]] ImageView GetView(::Rectangle rec) { return ImageView(*this, rec); }
+
     /**
      * Convert image data to desired format
      */
     Image& Format(int newFormat) {
-        ::ImageFormat(this, newFormat);
+        ReplaceBuffer(data, [&] { ::ImageFormat(this, newFormat); });
+        return *this;
+    }
+
+    /**
+     * Convert image data to desired format, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& Format(int newFormat, ThreadPool& pool) {
+        parallel::Format(*this, newFormat, pool);
         return *this;
     }
 
@@ -364,7 +411,7 @@ public:
      * Convert image to POT (power-of-two)
      */
     Image& ToPOT(::Color fillColor) {
-        ::ImageToPOT(this, fillColor);
+        ReplaceBuffer(data, [&] { ::ImageToPOT(this, fillColor); });
         return *this;
     }
 
@@ -372,7 +419,7 @@ public:
      * Crop an image to area defined by a rectangle
      */
     Image& Crop(::Rectangle crop) {
-        ::ImageCrop(this, crop);
+        ReplaceBuffer(data, [&] { ::ImageCrop(this, crop); });
         return *this;
     }
 
@@ -380,7 +427,7 @@ public:
      * Crop image depending on alpha value
      */
     Image& AlphaCrop(float threshold) {
-        ::ImageAlphaCrop(this, threshold);
+        ReplaceBuffer(data, [&] { ::ImageAlphaCrop(this, threshold); });
         return *this;
     }
 
@@ -388,7 +435,21 @@ public:
      * Clear alpha channel to desired color
      */
     Image& AlphaClear(::Color color, float threshold) {
-        ::ImageAlphaClear(this, color, threshold);
+        if (pixels::IsSupported(*this)) {
+            pixels::AlphaClear(pixels::GetSpan(*this), color, threshold);
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageAlphaClear(this, color, threshold); });
+        }
+        return *this;
+    }
+
+    /**
+     * Clear alpha channel to desired color, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& AlphaClear(::Color color, float threshold, ThreadPool& pool) {
+        parallel::AlphaClear(*this, color, threshold, pool);
         return *this;
     }
 
@@ -396,7 +457,7 @@ public:
      * Apply alpha mask to image
      */
     Image& AlphaMask(const ::Image& alphaMask) {
-        ::ImageAlphaMask(this, alphaMask);
+        ReplaceBuffer(data, [&] { ::ImageAlphaMask(this, alphaMask); });
         return *this;
     }
 
@@ -404,7 +465,21 @@ public:
      * Premultiply alpha channel
      */
     Image& AlphaPremultiply() {
-        ::ImageAlphaPremultiply(this);
+        if (pixels::IsSupported(*this)) {
+            pixels::AlphaPremultiply(pixels::GetSpan(*this));
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageAlphaPremultiply(this); });
+        }
+        return *this;
+    }
+
+    /**
+     * Premultiply alpha channel, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& AlphaPremultiply(ThreadPool& pool) {
+        parallel::AlphaPremultiply(*this, pool);
         return *this;
     }
 
@@ -427,7 +502,7 @@ public:
             static_cast<float>(offsetY),
             static_cast<float>(newWidth),
             static_cast<float>(newHeight)};
-        ::ImageCrop(this, rect);
+        ReplaceBuffer(data, [&] { ::ImageCrop(this, rect); });
         return *this;
     }
 
@@ -435,7 +510,7 @@ public:
      * Resize and image to new size
      */
     Image& Resize(int newWidth, int newHeight) {
-        ::ImageResize(this, newWidth, newHeight);
+        ReplaceBuffer(data, [&] { ::ImageResize(this, newWidth, newHeight); });
         return *this;
     }
 
@@ -443,7 +518,7 @@ public:
      * Resize and image to new size using Nearest-Neighbor scaling algorithm
      */
     Image& ResizeNN(int newWidth, int newHeight) {
-        ::ImageResizeNN(this, newWidth, newHeight);
+        ReplaceBuffer(data, [&] { ::ImageResizeNN(this, newWidth, newHeight); });
         return *this;
     }
 
@@ -452,7 +527,7 @@ public:
      */
     Image&
     ResizeCanvas(int newWidth, int newHeight, int offsetX = 0, int offsetY = 0, ::Color color = {255, 255, 255, 255}) {
-        ::ImageResizeCanvas(this, newWidth, newHeight, offsetX, offsetY, color);
+        ReplaceBuffer(data, [&] { ::ImageResizeCanvas(this, newWidth, newHeight, offsetX, offsetY, color); });
         return *this;
     }
 
@@ -460,7 +535,7 @@ public:
      * Generate all mipmap levels for a provided image
      */
     Image& Mipmaps() {
-        ::ImageMipmaps(this);
+        ReplaceBuffer(data, [&] { ::ImageMipmaps(this); });
         return *this;
     }
 
@@ -468,7 +543,7 @@ public:
      * Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
      */
     Image& Dither(int rBpp, int gBpp, int bBpp, int aBpp) {
-        ::ImageDither(this, rBpp, gBpp, bBpp, aBpp);
+        ReplaceBuffer(data, [&] { ::ImageDither(this, rBpp, gBpp, bBpp, aBpp); });
         return *this;
     }
 
@@ -476,7 +551,17 @@ public:
      * Flip image vertically
      */
     Image& FlipVertical() {
-        ::ImageFlipVertical(this);
+        ReplaceBuffer(data, [&] { ::ImageFlipVertical(this); });
+        return *this;
+    }
+
+    /**
+     * Flip image vertically, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& FlipVertical(ThreadPool& pool) {
+        parallel::FlipVertical(*this, pool);
         return *this;
     }
 
@@ -484,7 +569,17 @@ public:
      * Flip image horizontally
      */
     Image& FlipHorizontal() {
-        ::ImageFlipHorizontal(this);
+        ReplaceBuffer(data, [&] { ::ImageFlipHorizontal(this); });
+        return *this;
+    }
+
+    /**
+     * Flip image horizontally, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& FlipHorizontal(ThreadPool& pool) {
+        parallel::FlipHorizontal(*this, pool);
         return *this;
     }
 
@@ -492,7 +587,7 @@ public:
      * Rotate image by input angle in degrees (-359 to 359)
      */
     Image& Rotate(int degrees) {
-        ::ImageRotate(this, degrees);
+        ReplaceBuffer(data, [&] { ::ImageRotate(this, degrees); });
         return *this;
     }
 
@@ -500,7 +595,17 @@ public:
      * Rotate image clockwise 90deg
      */
     Image& RotateCW() {
-        ::ImageRotateCW(this);
+        ReplaceBuffer(data, [&] { ::ImageRotateCW(this); });
+        return *this;
+    }
+
+    /**
+     * Rotate image clockwise 90deg, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& RotateCW(ThreadPool& pool) {
+        parallel::RotateCW(*this, pool);
         return *this;
     }
 
@@ -508,7 +613,17 @@ public:
      * Rotate image counter-clockwise 90deg
      */
     Image& RotateCCW() {
-        ::ImageRotateCCW(this);
+        ReplaceBuffer(data, [&] { ::ImageRotateCCW(this); });
+        return *this;
+    }
+
+    /**
+     * Rotate image counter-clockwise 90deg, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& RotateCCW(ThreadPool& pool) {
+        parallel::RotateCCW(*this, pool);
         return *this;
     }
 
@@ -516,7 +631,21 @@ public:
      * Modify image color: tint
      */
     Image& ColorTint(::Color color = {255, 255, 255, 255}) {
-        ::ImageColorTint(this, color);
+        if (pixels::IsSupported(*this)) {
+            pixels::ColorTint(pixels::GetSpan(*this), color);
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageColorTint(this, color); });
+        }
+        return *this;
+    }
+
+    /**
+     * Modify image color: tint, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorTint(::Color color, ThreadPool& pool) {
+        parallel::ColorTint(*this, color, pool);
         return *this;
     }
 
@@ -524,7 +653,21 @@ public:
      * Modify image color: invert
      */
     Image& ColorInvert() {
-        ::ImageColorInvert(this);
+        if (pixels::IsSupported(*this)) {
+            pixels::ColorInvert(pixels::GetSpan(*this));
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageColorInvert(this); });
+        }
+        return *this;
+    }
+
+    /**
+     * Modify image color: invert, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorInvert(ThreadPool& pool) {
+        parallel::ColorInvert(*this, pool);
         return *this;
     }
 
@@ -532,7 +675,17 @@ public:
      * Modify image color: grayscale
      */
     Image& ColorGrayscale() {
-        ::ImageColorGrayscale(this);
+        ReplaceBuffer(data, [&] { ::ImageColorGrayscale(this); });
+        return *this;
+    }
+
+    /**
+     * Modify image color: grayscale, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorGrayscale(ThreadPool& pool) {
+        parallel::ColorGrayscale(*this, pool);
         return *this;
     }
 
@@ -542,7 +695,17 @@ public:
      * @param contrast Contrast values between -100 and 100
      */
     Image& ColorContrast(float contrast) {
-        ::ImageColorContrast(this, contrast);
+        ReplaceBuffer(data, [&] { ::ImageColorContrast(this, contrast); });
+        return *this;
+    }
+
+    /**
+     * Modify image color: contrast, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorContrast(float contrast, ThreadPool& pool) {
+        parallel::ColorContrast(*this, contrast, pool);
         return *this;
     }
 
@@ -552,7 +715,21 @@ public:
      * @param brightness Brightness values between -255 and 255
      */
     Image& ColorBrightness(int brightness) {
-        ::ImageColorBrightness(this, brightness);
+        if (pixels::IsSupported(*this)) {
+            pixels::ColorBrightness(pixels::GetSpan(*this), brightness);
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageColorBrightness(this, brightness); });
+        }
+        return *this;
+    }
+
+    /**
+     * Modify image color: brightness, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorBrightness(int brightness, ThreadPool& pool) {
+        parallel::ColorBrightness(*this, brightness, pool);
         return *this;
     }
 
@@ -560,7 +737,21 @@ public:
      * Modify image color: replace color
      */
     Image& ColorReplace(::Color color, ::Color replace) {
-        ::ImageColorReplace(this, color, replace);
+        if (pixels::IsSupported(*this)) {
+            pixels::ColorReplace(pixels::GetSpan(*this), color, replace);
+        } else {
+            ReplaceBuffer(data, [&] { ::ImageColorReplace(this, color, replace); });
+        }
+        return *this;
+    }
+
+    /**
+     * Modify image color: replace color, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    Image& ColorReplace(::Color color, ::Color replace, ThreadPool& pool) {
+        parallel::ColorReplace(*this, color, replace, pool);
         return *this;
     }
 
@@ -647,6 +838,18 @@ public:
         ::ImageDraw(this, src, srcRec, dstRec, tint);
     }
 
+    /**
+     * Draw a view of an image piece, reading its pixels in place
+     */
+    void Draw(const ImageView& src, ::Rectangle dstRec, ::Color tint = {255, 255, 255, 255}) {
+        ::ImageDraw(this, src.GetParent(), src.GetRegion(), dstRec, tint);
+    }
+
+    void Draw(const ImageView& src, ::Vector2 position = {0, 0}, ::Color tint = {255, 255, 255, 255}) {
+        const ::Rectangle region = src.GetRegion();
+        Draw(src, ::Rectangle{position.x, position.y, region.width, region.height}, tint);
+    }
+
     void DrawText(const char* text, ::Vector2 position, int fontSize, ::Color color = {255, 255, 255, 255}) {
         ::ImageDrawText(this, text, static_cast<int>(position.x), static_cast<int>(position.y), fontSize, color);
     }
@@ -753,9 +956,54 @@ public:
      * Apply custom square convolution kernel to image
      */
     void KernelConvolution(const float* kernel, int kernelSize) {
-        ::ImageKernelConvolution(this, kernel, kernelSize);
+        ReplaceBuffer(data, [&] { ::ImageKernelConvolution(this, kernel, kernelSize); });
+    }
+
+    /**
+     * Apply custom square convolution kernel to image, splitting the work over a thread pool
+     *
+     * @see raylib::parallel
+     */
+    void KernelConvolution(const float* kernel, int kernelSize, ThreadPool& pool) {
+        parallel::KernelConvolution(*this, kernel, kernelSize, pool);
     }
 protected:
+    /**
+     * Generate a plain color image with pixels from the buffer allocator, for an image this wrapper owns.
+     */
+    static ::Image PooledColor(int width, int height, ::Color color) {
+        if (GetBufferAllocator() == nullptr || width <= 0 || height <= 0) {
+            return ::GenImageColor(width, height, color);
+        }
+        const auto count = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        auto* pixels = static_cast<::Color*>(AllocateBuffer(count * sizeof(::Color)));
+        if (pixels != nullptr) {
+            std::fill_n(pixels, count, color);
+        }
+        return {pixels, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    }
+
+    /**
+     * Copy the image into a buffer from the buffer allocator, for an image this wrapper owns.
+     */
+    [[nodiscard]] ::Image PooledCopy() const {
+        if (GetBufferAllocator() == nullptr || data == nullptr) {
+            return ::ImageCopy(*this);
+        }
+        // Size of all mipmap levels, as ImageCopy() computes it.
+        std::size_t size = 0;
+        for (int level = 0, w = width, h = height; level < mipmaps; level++) {
+            size += static_cast<std::size_t>(::GetPixelDataSize(w, h, format));
+            w = std::max(w / 2, 1);
+            h = std::max(h / 2, 1);
+        }
+        ::Image copy{AllocateBuffer(size), width, height, mipmaps, format};
+        if (copy.data != nullptr) {
+            std::memcpy(copy.data, data, size);
+        }
+        return copy;
+    }
+
     void set(const ::Image& image) {
         data = image.data;
         width = image.width;
@@ -0,0 +1,347 @@
+#ifndef RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
+#define RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "./Allocator.hpp"
+#include "./PixelKernels.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Non-owning view of a rectangular region of an image's pixels.
+ *
+ * A view is a pointer, a row stride and a pixel format. It never copies or frees pixels, so slicing an atlas
+ * or processing part of an image costs nothing. The viewed image must outlive the view, and must not be
+ * reallocated (resized, reformatted, ...) while the view is in use.
+ */
+class ImageView {
+public:
+    ImageView() = default;
+
+    /**
+     * View all of an image's pixels. The view can write them, so it takes a mutable image.
+     *
+     * @throws raylib::RaylibException Thrown if the image has a compressed or unknown format.
+     */
+    ImageView(::Image& image)
+        : image{image.data, image.width, image.height, 1, image.format},
+          width(image.width),
+          height(image.height) {
+        CheckFormat();
+    }
+
+    /**
+     * View a region of an image. The region is clipped to the image bounds.
+     *
+     * @throws raylib::RaylibException Thrown if the image has a compressed or unknown format.
+     */
+    ImageView(::Image& image, ::Rectangle region) : ImageView(image) { *this = SubView(region); }
+
+    /**
+     * View raw pixel memory, where rows are `stride` bytes apart.
+     *
+     * @throws raylib::RaylibException Thrown for compressed or unknown formats, or a stride that's not a whole number
+     * of pixels.
+     */
+    ImageView(void* data, int width, int height, int stride, int format)
+        : image{data, 0, height, 1, format},
+          width(width),
+          height(height) {
+        CheckFormat();
+        const int pixelSize = ::GetPixelDataSize(1, 1, format);
+        if (stride % pixelSize != 0 || stride < width * pixelSize) {
+            throw RaylibException("ImageView stride must be a whole number of pixels, at least one row long");
+        }
+        image.width = stride / pixelSize;
+    }
+
+    GETTER(int, Width, width)
+    GETTER(int, Height, height)
+    GETTER(int, Format, image.format)
+
+    /**
+     * Retrieve the first pixel of the view.
+     */
+    [[nodiscard]] void* GetData() const { return GetRowData(0); }
+
+    /**
+     * Retrieve the number of bytes between the start of two rows.
+     */
+    [[nodiscard]] int GetStride() const { return ::GetPixelDataSize(image.width, 1, image.format); }
+
+    /**
+     * Retrieve the image header the view points into, with its full width and height.
+     */
+    [[nodiscard]] const ::Image& GetParent() const { return image; }
+
+    /**
+     * Retrieve the viewed region, in the parent image's pixel coordinates.
+     */
+    [[nodiscard]] ::Rectangle GetRegion() const {
+        return {
+            static_cast<float>(x),
+            static_cast<float>(y),
+            static_cast<float>(width),
+            static_cast<float>(height)};
+    }
+
+    /**
+     * Retrieve whether or not the view covers any pixels.
+     */
+    [[nodiscard]] bool IsValid() const { return image.data != nullptr && width > 0 && height > 0; }
+
+    /**
+     * Retrieve whether or not the rows follow each other without gaps.
+     */
+    [[nodiscard]] bool IsContiguous() const { return height <= 1 || width == image.width; }
+
+    /**
+     * Retrieve the size of the viewed pixels, in bytes.
+     */
+    [[nodiscard]] int GetPixelDataSize() const { return ::GetPixelDataSize(width, height, image.format); }
+
+    /**
+     * A view of a region of this view, clipped to its bounds.
+     */
+    [[nodiscard]] ImageView SubView(::Rectangle region) const {
+        const int left = std::clamp(static_cast<int>(region.x), 0, width);
+        const int top = std::clamp(static_cast<int>(region.y), 0, height);
+        const int right = std::clamp(static_cast<int>(region.x + region.width), left, width);
+        const int bottom = std::clamp(static_cast<int>(region.y + region.height), top, height);
+
+        ImageView view = *this;
+        view.x = x + left;
+        view.y = y + top;
+        view.width = right - left;
+        view.height = bottom - top;
+        return view;
+    }
+
+    /**
+     * Retrieve the raw bytes of a row.
+     */
+    [[nodiscard]] unsigned char* GetRowData(int row) const {
+        const auto pixelSize = static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format));
+        const std::size_t offset =
+            (static_cast<std::size_t>(y + row) * static_cast<std::size_t>(image.width) + static_cast<std::size_t>(x)) *
+            pixelSize;
+        return static_cast<unsigned char*>(image.data) + offset;
+    }
+
+    /**
+     * Retrieve a row as typed pixels, like ::Color for PIXELFORMAT_UNCOMPRESSED_R8G8B8A8.
+     *
+     * @throws raylib::RaylibException Thrown if the size of T is not the size of a pixel.
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> GetRow(int row) const {
+        CheckPixelType<T>();
+        return {reinterpret_cast<T*>(GetRowData(row)), static_cast<std::size_t>(width)};
+    }
+
+    /**
+     * Call fn(pixel), or fn(x, y, pixel), for every pixel as type T, row by row.
+     *
+     * @throws raylib::RaylibException Thrown if the size of T is not the size of a pixel.
+     */
+    template<typename T, typename F>
+    void ForEachPixel(F&& fn) const {
+        CheckPixelType<T>();
+        for (int row = 0; row < height; row++) {
+            std::span<T> pixels = GetRow<T>(row);
+            for (int column = 0; column < width; column++) {
+                if constexpr (std::is_invocable_v<F&, int, int, T&>) {
+                    fn(column, row, pixels[static_cast<std::size_t>(column)]);
+                } else {
+                    fn(pixels[static_cast<std::size_t>(column)]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Get the color of a pixel, in any uncompressed format.
+     */
+    [[nodiscard]] ::Color GetColor(int posX, int posY) const {
+        return ::GetPixelColor(GetRowData(posY) + PixelOffset(posX), image.format);
+    }
+
+    /**
+     * Copy the viewed pixels into a new image, which the caller must unload.
+     *
+     * @throws raylib::RaylibException Thrown if the new image could not be allocated.
+     */
+    [[nodiscard]] ::Image ToImage() const {
+        const auto size = static_cast<std::size_t>(std::max(GetPixelDataSize(), 0));
+        ::Image result{AllocateRaylibBuffer(size), width, height, 1, image.format};
+        if (result.data == nullptr && size > 0) {
+            throw RaylibException("Failed to allocate the ImageView copy");
+        }
+        const auto rowSize = static_cast<std::size_t>(::GetPixelDataSize(width, 1, image.format));
+        for (int row = 0; row < height; row++) {
+            std::memcpy(static_cast<unsigned char*>(result.data) + static_cast<std::size_t>(row) * rowSize,
+                GetRowData(row), rowSize);
+        }
+        return result;
+    }
+
+    /**
+     * Modify image color: tint
+     */
+    ImageView& ColorTint(::Color color = {255, 255, 255, 255}) {
+        return ForEachRow([color](std::span<::Color> row) { pixels::ColorTint(row, color); });
+    }
+
+    /**
+     * Modify image color: invert
+     */
+    ImageView& ColorInvert() {
+        return ForEachRow([](std::span<::Color> row) { pixels::ColorInvert(row); });
+    }
+
+    /**
+     * Modify image color: replace color
+     */
+    ImageView& ColorReplace(::Color color, ::Color replace) {
+        return ForEachRow([color, replace](std::span<::Color> row) { pixels::ColorReplace(row, color, replace); });
+    }
+
+    /**
+     * Modify image color: brightness
+     *
+     * @param brightness Brightness values between -255 and 255
+     */
+    ImageView& ColorBrightness(int brightness) {
+        return ForEachRow([brightness](std::span<::Color> row) { pixels::ColorBrightness(row, brightness); });
+    }
+
+    /**
+     * Premultiply alpha channel
+     */
+    ImageView& AlphaPremultiply() {
+        return ForEachRow([](std::span<::Color> row) { pixels::AlphaPremultiply(row); });
+    }
+
+    /**
+     * Clear alpha channel to desired color
+     */
+    ImageView& AlphaClear(::Color color, float threshold) {
+        return ForEachRow([color, threshold](std::span<::Color> row) { pixels::AlphaClear(row, color, threshold); });
+    }
+
+    /**
+     * Fill the view with a color
+     */
+    void ClearBackground(::Color color = {0, 0, 0, 255}) { DrawRectangle(0, 0, width, height, color); }
+
+    /**
+     * Draw pixel within the view
+     */
+    void DrawPixel(int posX, int posY, ::Color color = {255, 255, 255, 255}) {
+        if (posX >= 0 && posX < width && posY >= 0 && posY < height) {
+            ::ImageDrawPixel(&image, x + posX, y + posY, color);
+        }
+    }
+
+    /**
+     * Draw rectangle within the view, clipped to its bounds
+     */
+    void DrawRectangle(int posX, int posY, int rectWidth, int rectHeight, ::Color color = {255, 255, 255, 255}) {
+        const int left = std::max(posX, 0);
+        const int top = std::max(posY, 0);
+        const int right = std::min(posX + rectWidth, width);
+        const int bottom = std::min(posY + rectHeight, height);
+        if (right > left && bottom > top) {
+            ::ImageDrawRectangle(&image, x + left, y + top, right - left, bottom - top, color);
+        }
+    }
+
+    /**
+     * Draw a source view within this view at the given position, clipped to its bounds.
+     */
+    void Draw(const ImageView& src, int posX = 0, int posY = 0, ::Color tint = {255, 255, 255, 255}) {
+        const int left = std::max(posX, 0);
+        const int top = std::max(posY, 0);
+        const int right = std::min(posX + src.width, width);
+        const int bottom = std::min(posY + src.height, height);
+        if (right <= left || bottom <= top) {
+            return;
+        }
+        const auto w = static_cast<float>(right - left);
+        const auto h = static_cast<float>(bottom - top);
+        ::ImageDraw(
+            &image,
+            src.image,
+            {static_cast<float>(src.x + left - posX), static_cast<float>(src.y + top - posY), w, h},
+            {static_cast<float>(x + left), static_cast<float>(y + top), w, h},
+            tint);
+    }
+protected:
+    void CheckFormat() const {
+        if (image.format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE || image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+            throw RaylibException("ImageView requires an uncompressed pixel format");
+        }
+    }
+
+    template<typename T>
+    void CheckPixelType() const {
+        if (sizeof(T) != static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format))) {
+            throw RaylibException("ImageView pixel type does not match the pixel format");
+        }
+    }
+
+    [[nodiscard]] std::size_t PixelOffset(int column) const {
+        return static_cast<std::size_t>(column) * static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format));
+    }
+
+    /**
+     * Run a raylib::pixels kernel on each row. Rows in other formats than R8G8B8A8 are converted to colors and back.
+     */
+    template<typename F>
+    ImageView& ForEachRow(F kernel) {
+        if (!IsValid()) {
+            return *this;
+        }
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+            for (int row = 0; row < height; row++) {
+                kernel(GetRow<::Color>(row));
+            }
+            return *this;
+        }
+
+        std::vector<::Color> colors(static_cast<std::size_t>(width));
+        for (int row = 0; row < height; row++) {
+            unsigned char* data = GetRowData(row);
+            for (int column = 0; column < width; column++) {
+                colors[static_cast<std::size_t>(column)] = ::GetPixelColor(data + PixelOffset(column), image.format);
+            }
+            kernel(std::span<::Color>(colors));
+            for (int column = 0; column < width; column++) {
+                ::SetPixelColor(data + PixelOffset(column), colors[static_cast<std::size_t>(column)], image.format);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Header for the parent pixels: full row width and height.
+     */
+    ::Image image{nullptr, 0, 0, 1, 0};
+    int x{0};
+    int y{0};
+    int width{0};
+    int height{0};
+};
+} // namespace raylib
+
+using RImageView = raylib::ImageView;
+
+#endif // RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
@@ -1,6 +1,7 @@
 #ifndef RAYLIB_CPP_INCLUDE_MATRIX_HPP_
 #define RAYLIB_CPP_INCLUDE_MATRIX_HPP_
 
+#include "./MatrixKernels.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 #include "./raymath.hpp"
@@ -89,10 +90,17 @@ public:
 
     /**
      * Transposes provided matrix
+     *
+     * @see raylib::matrices::Transpose()
      */
-    [[nodiscard]] Matrix Transpose() const { return ::MatrixTranspose(*this); }
+    [[nodiscard]] Matrix Transpose() const { return matrices::Transpose(*this); }
 
-    [[nodiscard]] Matrix Invert() const { return ::MatrixInvert(*this); }
+    /**
+     * Invert provided matrix
+     *
+     * @see raylib::matrices::Invert()
+     */
+    [[nodiscard]] Matrix Invert() const { return matrices::Invert(*this); }
 
     static Matrix Identity() { return ::MatrixIdentity(); }
 
@@ -118,9 +126,14 @@ public:
 
     static Matrix Scale(float x, float y, float z) { return ::MatrixScale(x, y, z); }
 
-    [[nodiscard]] Matrix Multiply(const ::Matrix& right) const { return ::MatrixMultiply(*this, right); }
+    /**
+     * Multiply two matrices
+     *
+     * @see raylib::matrices::Multiply()
+     */
+    [[nodiscard]] Matrix Multiply(const ::Matrix& right) const { return matrices::Multiply(*this, right); }
 
-    Matrix operator*(const ::Matrix& matrix) { return ::MatrixMultiply(*this, matrix); }
+    Matrix operator*(const ::Matrix& matrix) const { return matrices::Multiply(*this, matrix); }
 
     static Matrix Frustum(double left, double right, double bottom, double top, double near, double far) {
         return ::MatrixFrustum(left, right, bottom, top, near, far);
@@ -0,0 +1,230 @@
+#ifndef RAYLIB_CPP_INCLUDE_MATRIXKERNELS_HPP_
+#define RAYLIB_CPP_INCLUDE_MATRIXKERNELS_HPP_
+
+#include <cstring>
+
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+#include "./raymath.hpp"
+
+#if defined(RAYLIB_CPP_SIMD_SSE2)
+#define RAYLIB_CPP_SIMD_MATRIX
+#elif defined(RAYLIB_CPP_SIMD_NEON) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12))
+#define RAYLIB_CPP_SIMD_MATRIX
+#endif
+
+namespace raylib {
+/**
+ * 4x4 matrix kernels, one matrix row per 4-lane register: SSE on x86 (also when AVX2 is enabled), NEON on AArch64,
+ * and raymath otherwise. RAYLIB_CPP_SIMD_MATRIX is defined when a SIMD path is in use.
+ *
+ * Multiply() and Transpose() give the same results as raymath. Invert() uses a block-wise formula, so its results
+ * may differ from MatrixInvert() in the last bits.
+ */
+namespace matrices {
+#if defined(RAYLIB_CPP_SIMD_MATRIX)
+namespace detail {
+#if defined(RAYLIB_CPP_SIMD_SSE2)
+using vec4 = __m128;
+
+inline vec4 Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, vec4 v) { _mm_storeu_ps(p, v); }
+inline vec4 Set(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+inline vec4 Add(vec4 a, vec4 b) { return _mm_add_ps(a, b); }
+inline vec4 Sub(vec4 a, vec4 b) { return _mm_sub_ps(a, b); }
+inline vec4 Mul(vec4 a, vec4 b) { return _mm_mul_ps(a, b); }
+inline vec4 Div(vec4 a, vec4 b) { return _mm_div_ps(a, b); }
+
+/**
+ * (a[X], a[Y], b[Z], b[W])
+ */
+template<int X, int Y, int Z, int W>
+vec4 Shuffle(vec4 a, vec4 b) {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+#else
+using vec4 = float32x4_t;
+
+inline vec4 Load(const float* p) { return vld1q_f32(p); }
+inline void Store(float* p, vec4 v) { vst1q_f32(p, v); }
+inline vec4 Set(float a, float b, float c, float d) {
+    const float values[4] = {a, b, c, d};
+    return vld1q_f32(values);
+}
+inline vec4 Add(vec4 a, vec4 b) { return vaddq_f32(a, b); }
+inline vec4 Sub(vec4 a, vec4 b) { return vsubq_f32(a, b); }
+inline vec4 Mul(vec4 a, vec4 b) { return vmulq_f32(a, b); }
+inline vec4 Div(vec4 a, vec4 b) { return vdivq_f32(a, b); }
+
+/**
+ * (a[X], a[Y], b[Z], b[W])
+ */
+template<int X, int Y, int Z, int W>
+vec4 Shuffle(vec4 a, vec4 b) {
+    return __builtin_shufflevector(a, b, X, Y, Z + 4, W + 4);
+}
+#endif
+
+template<int X, int Y, int Z, int W>
+vec4 Swizzle(vec4 v) {
+    return Shuffle<X, Y, Z, W>(v, v);
+}
+
+template<int I>
+vec4 Splat(vec4 v) {
+    return Shuffle<I, I, I, I>(v, v);
+}
+
+/**
+ * out = left * right, with raymath's MatrixMultiply() order. Registers hold the memory rows (m0, m4, m8, m12),
+ * (m1, m5, m9, m13), ... and out row b is the sum of left's rows scaled by the lanes of right's row b. The output
+ * may overlap either input.
+ */
+inline void Multiply(const float* left, const float* right, float* out) {
+    const vec4 l0 = Load(left);
+    const vec4 l1 = Load(left + 4);
+    const vec4 l2 = Load(left + 8);
+    const vec4 l3 = Load(left + 12);
+    const vec4 r0 = Load(right);
+    const vec4 r1 = Load(right + 4);
+    const vec4 r2 = Load(right + 8);
+    const vec4 r3 = Load(right + 12);
+    auto row = [&](vec4 r) {
+        return Add(Add(Add(Mul(l0, Splat<0>(r)), Mul(l1, Splat<1>(r))), Mul(l2, Splat<2>(r))), Mul(l3, Splat<3>(r)));
+    };
+    Store(out, row(r0));
+    Store(out + 4, row(r1));
+    Store(out + 8, row(r2));
+    Store(out + 12, row(r3));
+}
+
+inline void Transpose(const float* in, float* out) {
+    const vec4 r0 = Load(in);
+    const vec4 r1 = Load(in + 4);
+    const vec4 r2 = Load(in + 8);
+    const vec4 r3 = Load(in + 12);
+    const vec4 t0 = Shuffle<0, 1, 0, 1>(r0, r1);
+    const vec4 t1 = Shuffle<2, 3, 2, 3>(r0, r1);
+    const vec4 t2 = Shuffle<0, 1, 0, 1>(r2, r3);
+    const vec4 t3 = Shuffle<2, 3, 2, 3>(r2, r3);
+    Store(out, Shuffle<0, 2, 0, 2>(t0, t2));
+    Store(out + 4, Shuffle<1, 3, 1, 3>(t0, t2));
+    Store(out + 8, Shuffle<0, 2, 0, 2>(t1, t3));
+    Store(out + 12, Shuffle<1, 3, 1, 3>(t1, t3));
+}
+
+// 2x2 matrices (a0 a1 / a2 a3) in one register, for the block-wise inverse.
+
+/** a * b */
+inline vec4 Mat2Mul(vec4 a, vec4 b) {
+    return Add(Mul(a, Swizzle<0, 3, 0, 3>(b)), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+/** adjugate(a) * b */
+inline vec4 Mat2AdjMul(vec4 a, vec4 b) {
+    return Sub(Mul(Swizzle<3, 3, 0, 0>(a), b), Mul(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+/** a * adjugate(b) */
+inline vec4 Mat2MulAdj(vec4 a, vec4 b) {
+    return Sub(Mul(a, Swizzle<3, 0, 3, 0>(b)), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+/**
+ * Inverse from the 2x2 blocks of the matrix, as in "Fast 4x4 Matrix Inverse with SSE SIMD" by Eric Zhang. The
+ * inverse of a matrix's transpose is the transpose of its inverse, so the memory rows can be used directly.
+ */
+inline void Invert(const float* in, float* out) {
+    const vec4 r0 = Load(in);
+    const vec4 r1 = Load(in + 4);
+    const vec4 r2 = Load(in + 8);
+    const vec4 r3 = Load(in + 12);
+
+    const vec4 a = Shuffle<0, 1, 0, 1>(r0, r1);
+    const vec4 b = Shuffle<2, 3, 2, 3>(r0, r1);
+    const vec4 c = Shuffle<0, 1, 0, 1>(r2, r3);
+    const vec4 d = Shuffle<2, 3, 2, 3>(r2, r3);
+
+    // Determinants of the blocks, as (|A|, |B|, |C|, |D|).
+    const vec4 detSub = Sub(
+        Mul(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+        Mul(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+    const vec4 detA = Splat<0>(detSub);
+    const vec4 detB = Splat<1>(detSub);
+    const vec4 detC = Splat<2>(detSub);
+    const vec4 detD = Splat<3>(detSub);
+
+    const vec4 dc = Mat2AdjMul(d, c);
+    const vec4 ab = Mat2AdjMul(a, b);
+    vec4 x = Sub(Mul(detD, a), Mat2Mul(b, dc));
+    vec4 w = Sub(Mul(detA, d), Mat2Mul(c, ab));
+    vec4 y = Sub(Mul(detB, c), Mat2MulAdj(d, ab));
+    vec4 z = Sub(Mul(detC, b), Mat2MulAdj(a, dc));
+
+    // |M| = |A| |D| + |B| |C| - tr((A# B) (D# C))
+    vec4 trace = Mul(ab, Swizzle<0, 2, 1, 3>(dc));
+    trace = Add(trace, Swizzle<1, 0, 3, 2>(trace));
+    trace = Add(trace, Swizzle<2, 3, 0, 1>(trace));
+    const vec4 det = Sub(Add(Mul(detA, detD), Mul(detB, detC)), trace);
+
+    const vec4 invDet = Div(Set(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = Mul(x, invDet);
+    y = Mul(y, invDet);
+    z = Mul(z, invDet);
+    w = Mul(w, invDet);
+
+    Store(out, Shuffle<3, 1, 3, 1>(x, y));
+    Store(out + 4, Shuffle<2, 0, 2, 0>(x, y));
+    Store(out + 8, Shuffle<3, 1, 3, 1>(z, w));
+    Store(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+}
+
+inline const float* Floats(const ::Matrix& matrix) { return reinterpret_cast<const float*>(&matrix); }
+inline float* Floats(::Matrix& matrix) { return reinterpret_cast<float*>(&matrix); }
+} // namespace detail
+#endif
+
+static_assert(sizeof(::Matrix) == sizeof(float) * 16, "::Matrix must be 16 packed floats");
+
+/**
+ * Multiply two matrices, like MatrixMultiply().
+ */
+inline ::Matrix Multiply(const ::Matrix& left, const ::Matrix& right) {
+#if defined(RAYLIB_CPP_SIMD_MATRIX)
+    ::Matrix result;
+    detail::Multiply(detail::Floats(left), detail::Floats(right), detail::Floats(result));
+    return result;
+#else
+    return ::MatrixMultiply(left, right);
+#endif
+}
+
+/**
+ * Transpose a matrix, like MatrixTranspose().
+ */
+inline ::Matrix Transpose(const ::Matrix& matrix) {
+#if defined(RAYLIB_CPP_SIMD_MATRIX)
+    ::Matrix result;
+    detail::Transpose(detail::Floats(matrix), detail::Floats(result));
+    return result;
+#else
+    return ::MatrixTranspose(matrix);
+#endif
+}
+
+/**
+ * Invert a matrix, like MatrixInvert().
+ */
+inline ::Matrix Invert(const ::Matrix& matrix) {
+#if defined(RAYLIB_CPP_SIMD_MATRIX)
+    ::Matrix result;
+    detail::Invert(detail::Floats(matrix), detail::Floats(result));
+    return result;
+#else
+    return ::MatrixInvert(matrix);
+#endif
+}
+} // namespace matrices
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_MATRIXKERNELS_HPP_
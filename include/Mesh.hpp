@@ -21,6 +21,15 @@ class Mesh : public MeshUnmanaged {
 public:
     using MeshUnmanaged::MeshUnmanaged;
 
+    /**
+     * Allocate zeroed vertex, texcoord and normal data, and index data when `indexed`, from the buffer allocator.
+     *
+     * @throws raylib::RaylibException Thrown if an array could not be allocated, freeing the ones that were.
+     * @see raylib::SetBufferAllocator()
+     */
+    Mesh(int vertexCount, int triangleCount, bool indexed = false)
+        : MeshUnmanaged(vertexCount, triangleCount, indexed, AllocateBuffer) {}
+
     /**
      * Explicitly forbid the copy constructor.
      */
@@ -0,0 +1,547 @@
+#ifndef RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
+#define RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "./RayCollision.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Bounding volume hierarchy over the triangles of a mesh, to cast rays without testing every triangle.
+ *
+ * It is built once from the mesh vertex and index data on the CPU, splitting each node where the surface area
+ * heuristic says rays are cheapest to trace. The nodes are stored depth-first in one array of 32 byte nodes, with the
+ * left child right after its parent, and the triangles are copied in leaf order, so queries walk memory forward.
+ *
+ * Closest hits are the ones GetRayCollisionMesh() finds, with the same distance, point and normal.
+ *
+ * @code
+ * raylib::MeshBVH bvh(model.meshes[0], model.transform);
+ * raylib::RayCollision hit = bvh.GetCollision(raylib::Ray::GetMouse(camera));
+ * @endcode
+ */
+class MeshBVH {
+public:
+    /**
+     * A node of the flattened tree.
+     */
+    struct Node {
+        ::Vector3 min;
+        /** The first triangle of a leaf, or the right child of an inner node */
+        std::uint32_t index;
+        ::Vector3 max;
+        /** The number of triangles of a leaf, 0 for inner nodes */
+        std::uint32_t count;
+    };
+    static_assert(sizeof(Node) == 32);
+
+    /** Deepest a tree gets, which bounds the traversal stack */
+    static constexpr int MaxDepth = 64;
+    /** Leaves with more triangles are always split */
+    static constexpr std::uint32_t MaxLeafSize = 8;
+    /** Candidate split planes per axis */
+    static constexpr int Bins = 16;
+
+    MeshBVH() = default;
+
+    /**
+     * Build the hierarchy of a mesh, in model space.
+     */
+    explicit MeshBVH(const ::Mesh& mesh) { Build(mesh, nullptr); }
+
+    /**
+     * Build the hierarchy of a mesh, with its vertices moved by a transform.
+     */
+    MeshBVH(const ::Mesh& mesh, const ::Matrix& transform) { Build(mesh, &transform); }
+
+    /**
+     * Rebuild the hierarchy, after the mesh vertices changed.
+     */
+    void Build(const ::Mesh& mesh) { Build(mesh, nullptr); }
+
+    /**
+     * Rebuild the hierarchy with a transform, after the mesh vertices or the transform changed.
+     */
+    void Build(const ::Mesh& mesh, const ::Matrix& transform) { Build(mesh, &transform); }
+
+    [[nodiscard]] int GetTriangleCount() const { return static_cast<int>(triangles.size()); }
+    [[nodiscard]] int GetNodeCount() const { return static_cast<int>(nodes.size()); }
+    [[nodiscard]] int GetDepth() const { return depth; }
+    [[nodiscard]] bool IsEmpty() const { return nodes.empty(); }
+    [[nodiscard]] const std::vector<Node>& GetNodes() const { return nodes; }
+
+    /**
+     * Retrieve the bounds of every triangle.
+     */
+    [[nodiscard]] ::BoundingBox GetBoundingBox() const {
+        return nodes.empty() ? ::BoundingBox{} : ::BoundingBox{nodes[0].min, nodes[0].max};
+    }
+
+    /**
+     * Get the closest collision of a ray, closer than a distance, in the space the hierarchy was built in.
+     */
+    [[nodiscard]] RayCollision GetCollision(
+        const ::Ray& ray,
+        float maxDistance = std::numeric_limits<float>::infinity()) const {
+        return ToCollision(ray, Trace<false>(ray, maxDistance));
+    }
+
+    /**
+     * Get the closest collision of a ray with the mesh moved by a transform, without rebuilding the hierarchy.
+     *
+     * The ray is moved into the space the hierarchy was built in instead, so results can differ from
+     * GetRayCollisionMesh() in the last bits.
+     */
+    [[nodiscard]] RayCollision GetCollision(const ::Ray& ray, const ::Matrix& transform) const {
+        // The rows of the inverse are the cross products of the columns, over the determinant.
+        const ::Vector3 c0{transform.m0, transform.m1, transform.m2};
+        const ::Vector3 c1{transform.m4, transform.m5, transform.m6};
+        const ::Vector3 c2{transform.m8, transform.m9, transform.m10};
+        const ::Vector3 r0 = Cross(c1, c2);
+        const ::Vector3 r1 = Cross(c2, c0);
+        const ::Vector3 r2 = Cross(c0, c1);
+        const float det = Dot(c0, r0);
+        if (det == 0.0f) {
+            return ::RayCollision{};
+        }
+
+        const float inverse = 1.0f / det;
+        const ::Vector3 offset{
+            ray.position.x - transform.m12,
+            ray.position.y - transform.m13,
+            ray.position.z - transform.m14};
+        const ::Ray local{
+            {Dot(r0, offset) * inverse, Dot(r1, offset) * inverse, Dot(r2, offset) * inverse},
+            {Dot(r0, ray.direction) * inverse, Dot(r1, ray.direction) * inverse, Dot(r2, ray.direction) * inverse}};
+        const Hit hit = Trace<false>(local, std::numeric_limits<float>::infinity());
+        if (hit.triangle == NoTriangle) {
+            return ::RayCollision{};
+        }
+
+        // Normals move by the cofactor matrix, which keeps them facing the same way as raylib's.
+        const Triangle& triangle = triangles[hit.triangle];
+        const ::Vector3 n = Cross(triangle.edge1, triangle.edge2);
+        const ::Vector3 normal{
+            r0.x * n.x + r1.x * n.y + r2.x * n.z,
+            r0.y * n.x + r1.y * n.y + r2.y * n.z,
+            r0.z * n.x + r1.z * n.y + r2.z * n.z};
+        return ::RayCollision{true, hit.distance, PointAt(ray, hit.distance), Normalize(normal)};
+    }
+
+    /**
+     * Get any collision of a ray closer than a distance, not necessarily the closest one. Faster for line of sight
+     * and shadow checks.
+     */
+    [[nodiscard]] RayCollision GetAnyCollision(
+        const ::Ray& ray,
+        float maxDistance = std::numeric_limits<float>::infinity()) const {
+        return ToCollision(ray, Trace<true>(ray, maxDistance));
+    }
+
+    /**
+     * Detect whether a ray hits the mesh closer than a distance.
+     */
+    [[nodiscard]] bool CheckCollision(
+        const ::Ray& ray,
+        float maxDistance = std::numeric_limits<float>::infinity()) const {
+        return Trace<true>(ray, maxDistance).triangle != NoTriangle;
+    }
+
+    /**
+     * Retrieve the index of the closest triangle a ray hits in the mesh, or -1.
+     */
+    [[nodiscard]] int GetTriangle(const ::Ray& ray) const {
+        const Hit hit = Trace<false>(ray, std::numeric_limits<float>::infinity());
+        return hit.triangle == NoTriangle ? -1 : static_cast<int>(ids[hit.triangle]);
+    }
+protected:
+    static constexpr std::uint32_t NoTriangle = ~0u;
+
+    /**
+     * A triangle as raylib's ray test uses it: a corner and the edges to the other two.
+     */
+    struct Triangle {
+        ::Vector3 p1;
+        ::Vector3 edge1;
+        ::Vector3 edge2;
+    };
+
+    struct Hit {
+        float distance;
+        std::uint32_t triangle;
+    };
+
+    struct Bounds {
+        ::Vector3 min{
+            std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::infinity()};
+        ::Vector3 max{
+            -std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity(),
+            -std::numeric_limits<float>::infinity()};
+
+        void Grow(::Vector3 point) {
+            min = {std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z)};
+            max = {std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z)};
+        }
+
+        void Grow(const Bounds& bounds) {
+            Grow(bounds.min);
+            Grow(bounds.max);
+        }
+
+        [[nodiscard]] float Area() const {
+            const ::Vector3 size{max.x - min.x, max.y - min.y, max.z - min.z};
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+    };
+
+    static ::Vector3 Cross(::Vector3 a, ::Vector3 b) {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+
+    static float Dot(::Vector3 a, ::Vector3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    static ::Vector3 Sub(::Vector3 a, ::Vector3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+
+    static float Axis(::Vector3 v, int axis) { return axis == 0 ? v.x : (axis == 1 ? v.y : v.z); }
+
+    static ::Vector3 Normalize(::Vector3 v) {
+        const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+        if (length != 0.0f) {
+            const float inverse = 1.0f / length;
+            v = {v.x * inverse, v.y * inverse, v.z * inverse};
+        }
+        return v;
+    }
+
+    static ::Vector3 PointAt(const ::Ray& ray, float t) {
+        return {
+            ray.position.x + ray.direction.x * t,
+            ray.position.y + ray.direction.y * t,
+            ray.position.z + ray.direction.z * t};
+    }
+
+    /**
+     * Transform a point the way Vector3Transform() does.
+     */
+    static ::Vector3 Transform(::Vector3 v, const ::Matrix& mat) {
+        return {
+            mat.m0 * v.x + mat.m4 * v.y + mat.m8 * v.z + mat.m12,
+            mat.m1 * v.x + mat.m5 * v.y + mat.m9 * v.z + mat.m13,
+            mat.m2 * v.x + mat.m6 * v.y + mat.m10 * v.z + mat.m14};
+    }
+
+    /**
+     * The Möller-Trumbore test of GetRayCollisionTriangle(), step for step, so distances match raylib's.
+     */
+    static bool Intersect(const ::Ray& ray, const Triangle& triangle, float& distance) {
+        constexpr float epsilon = 0.000001f;
+        const ::Vector3 p = Cross(ray.direction, triangle.edge2);
+        const float det = Dot(triangle.edge1, p);
+        if (det > -epsilon && det < epsilon) {
+            return false;
+        }
+        const float invDet = 1.0f / det;
+        const ::Vector3 tv = Sub(ray.position, triangle.p1);
+        const float u = Dot(tv, p) * invDet;
+        if (u < 0.0f || u > 1.0f) {
+            return false;
+        }
+        const ::Vector3 q = Cross(tv, triangle.edge1);
+        const float v = Dot(ray.direction, q) * invDet;
+        if (v < 0.0f || u + v > 1.0f) {
+            return false;
+        }
+        distance = Dot(triangle.edge2, q) * invDet;
+        return distance > epsilon;
+    }
+
+    /**
+     * Ray against node bounds, with the direction inverted once per ray.
+     */
+    struct Slab {
+        ::Vector3 origin;
+        ::Vector3 inverse;
+
+        explicit Slab(const ::Ray& ray) : origin(ray.position) {
+            // A huge finite inverse instead of infinity keeps 0 * inverse from being NaN.
+            auto invert = [](float d) { return d != 0.0f ? 1.0f / d : std::numeric_limits<float>::max(); };
+            inverse = {invert(ray.direction.x), invert(ray.direction.y), invert(ray.direction.z)};
+        }
+
+        /**
+         * Distance at which the ray enters a node, or infinity if it misses it or only enters past the limit.
+         */
+        [[nodiscard]] float Enter(const Node& node, float limit) const {
+            const float x1 = (node.min.x - origin.x) * inverse.x;
+            const float x2 = (node.max.x - origin.x) * inverse.x;
+            const float y1 = (node.min.y - origin.y) * inverse.y;
+            const float y2 = (node.max.y - origin.y) * inverse.y;
+            const float z1 = (node.min.z - origin.z) * inverse.z;
+            const float z2 = (node.max.z - origin.z) * inverse.z;
+            const float enter = std::max({std::min(x1, x2), std::min(y1, y2), std::min(z1, z2), 0.0f});
+            // Widened by a few rounding errors, so rays grazing flat nodes aren't lost.
+            const float exit = std::min({std::max(x1, x2), std::max(y1, y2), std::max(z1, z2)}) * Widen;
+            return enter <= exit && enter <= limit ? enter : std::numeric_limits<float>::infinity();
+        }
+
+        static constexpr float Widen = 1.0f + 4.0f * std::numeric_limits<float>::epsilon();
+    };
+
+    /**
+     * Walk the tree, nearer child first. Ties between triangles go to the first one in the mesh, like raylib.
+     */
+    template<bool Any>
+    [[nodiscard]] Hit Trace(const ::Ray& ray, float maxDistance) const {
+        Hit best{maxDistance, NoTriangle};
+        if (nodes.empty()) {
+            return best;
+        }
+
+        const Slab slab(ray);
+        if (slab.Enter(nodes[0], maxDistance) == std::numeric_limits<float>::infinity()) {
+            return best;
+        }
+
+        std::array<std::uint32_t, MaxDepth> stack{};
+        std::array<float, MaxDepth> stackEnter{};
+        int top = 0;
+        std::uint32_t current = 0;
+        while (true) {
+            const Node& node = nodes[current];
+            if (node.count > 0) {
+                for (std::uint32_t i = node.index; i < node.index + node.count; i++) {
+                    float distance = 0.0f;
+                    if (!Intersect(ray, triangles[i], distance)) {
+                        continue;
+                    }
+                    if (distance < best.distance ||
+                        (distance == best.distance && best.triangle != NoTriangle && ids[i] < ids[best.triangle])) {
+                        best = {distance, i};
+                        if constexpr (Any) {
+                            return best;
+                        }
+                    }
+                }
+            } else {
+                std::uint32_t closer = current + 1;
+                std::uint32_t further = node.index;
+                float closerEnter = slab.Enter(nodes[closer], best.distance);
+                float furtherEnter = slab.Enter(nodes[further], best.distance);
+                if (furtherEnter < closerEnter) {
+                    std::swap(closer, further);
+                    std::swap(closerEnter, furtherEnter);
+                }
+                if (closerEnter != std::numeric_limits<float>::infinity()) {
+                    if (furtherEnter != std::numeric_limits<float>::infinity()) {
+                        stack[static_cast<std::size_t>(top)] = further;
+                        stackEnter[static_cast<std::size_t>(top)] = furtherEnter;
+                        top++;
+                    }
+                    current = closer;
+                    continue;
+                }
+            }
+
+            // Pop the next node the ray still reaches before the closest hit so far.
+            do {
+                if (top == 0) {
+                    return best;
+                }
+                top--;
+            } while (stackEnter[static_cast<std::size_t>(top)] > best.distance);
+            current = stack[static_cast<std::size_t>(top)];
+        }
+    }
+
+    [[nodiscard]] ::RayCollision ToCollision(const ::Ray& ray, const Hit& hit) const {
+        if (hit.triangle == NoTriangle) {
+            return ::RayCollision{};
+        }
+        const Triangle& triangle = triangles[hit.triangle];
+        return ::RayCollision{
+            true,
+            hit.distance,
+            PointAt(ray, hit.distance),
+            Normalize(Cross(triangle.edge1, triangle.edge2))};
+    }
+
+    void Build(const ::Mesh& mesh, const ::Matrix* transform) {
+        nodes.clear();
+        triangles.clear();
+        ids.clear();
+        depth = 0;
+        if (mesh.vertices == nullptr || mesh.triangleCount <= 0) {
+            return;
+        }
+
+        // Corners as GetRayCollisionMesh() reads them.
+        const auto count = static_cast<std::uint32_t>(mesh.triangleCount);
+        std::vector<Triangle> source(count);
+        bounds.assign(count, Bounds{});
+        centroids.resize(count);
+        for (std::uint32_t i = 0; i < count; i++) {
+            std::array<::Vector3, 3> corners{};
+            for (std::uint32_t j = 0; j < 3; j++) {
+                const std::size_t vertex = mesh.indices != nullptr ? mesh.indices[i * 3 + j] : i * 3 + j;
+                corners[j] = {mesh.vertices[vertex * 3], mesh.vertices[vertex * 3 + 1], mesh.vertices[vertex * 3 + 2]};
+                if (transform != nullptr) {
+                    corners[j] = Transform(corners[j], *transform);
+                }
+                bounds[i].Grow(corners[j]);
+            }
+            source[i] = {corners[0], Sub(corners[1], corners[0]), Sub(corners[2], corners[0])};
+            centroids[i] = {
+                (bounds[i].min.x + bounds[i].max.x) * 0.5f,
+                (bounds[i].min.y + bounds[i].max.y) * 0.5f,
+                (bounds[i].min.z + bounds[i].max.z) * 0.5f};
+        }
+
+        ids.resize(count);
+        for (std::uint32_t i = 0; i < count; i++) {
+            ids[i] = i;
+        }
+        nodes.reserve(static_cast<std::size_t>(count) * 2);
+        Subdivide(0, count, 1);
+
+        triangles.resize(count);
+        for (std::uint32_t i = 0; i < count; i++) {
+            triangles[i] = source[ids[i]];
+        }
+        bounds.clear();
+        bounds.shrink_to_fit();
+        centroids.clear();
+        centroids.shrink_to_fit();
+    }
+
+    /**
+     * Add the node of the triangles [first, first + count) and, depth-first, its children.
+     */
+    void Subdivide(std::uint32_t first, std::uint32_t count, int level) {
+        const std::size_t index = nodes.size();
+        nodes.emplace_back();
+        depth = std::max(depth, level);
+
+        Bounds box;
+        Bounds centers;
+        for (std::uint32_t i = first; i < first + count; i++) {
+            box.Grow(bounds[ids[i]]);
+            centers.Grow(centroids[ids[i]]);
+        }
+        nodes[index] = {box.min, first, box.max, count};
+
+        std::uint32_t split = first;
+        if (count > 1 && level < MaxDepth) {
+            split = Partition(first, count, box, centers);
+        }
+        if (split == first) {
+            return;
+        }
+
+        Subdivide(first, split - first, level + 1);
+        nodes[index].index = static_cast<std::uint32_t>(nodes.size());
+        nodes[index].count = 0;
+        Subdivide(split, first + count - split, level + 1);
+    }
+
+    /**
+     * Sort the triangles of a node to either side of the cheapest binned split.
+     *
+     * @return Where the right side starts, or `first` to keep the node a leaf.
+     */
+    std::uint32_t Partition(std::uint32_t first, std::uint32_t count, const Bounds& box, const Bounds& centers) {
+        struct Bin {
+            Bounds bounds;
+            std::uint32_t count = 0;
+        };
+
+        float bestCost = std::numeric_limits<float>::infinity();
+        int bestAxis = -1;
+        int bestBin = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            const float low = Axis(centers.min, axis);
+            const float extent = Axis(centers.max, axis) - low;
+            if (!(extent > 0.0f)) {
+                continue;
+            }
+
+            std::array<Bin, Bins> bins{};
+            const float scale = static_cast<float>(Bins) / extent;
+            for (std::uint32_t i = first; i < first + count; i++) {
+                const int bin = std::min(Bins - 1, static_cast<int>((Axis(centroids[ids[i]], axis) - low) * scale));
+                bins[static_cast<std::size_t>(bin)].bounds.Grow(bounds[ids[i]]);
+                bins[static_cast<std::size_t>(bin)].count++;
+            }
+
+            // Sweep from the right, then from the left, pricing each plane between two bins.
+            std::array<float, Bins - 1> rightCost{};
+            Bounds right;
+            std::uint32_t rightCount = 0;
+            for (int i = Bins - 1; i > 0; i--) {
+                const Bin& bin = bins[static_cast<std::size_t>(i)];
+                right.Grow(bin.bounds);
+                rightCount += bin.count;
+                rightCost[static_cast<std::size_t>(i - 1)] =
+                    rightCount > 0 ? right.Area() * static_cast<float>(rightCount) : 0.0f;
+            }
+            Bounds left;
+            std::uint32_t leftCount = 0;
+            for (int i = 0; i < Bins - 1; i++) {
+                const Bin& bin = bins[static_cast<std::size_t>(i)];
+                left.Grow(bin.bounds);
+                leftCount += bin.count;
+                if (leftCount == 0 || leftCount == count) {
+                    continue;
+                }
+                const float cost = left.Area() * static_cast<float>(leftCount) + rightCost[static_cast<std::size_t>(i)];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        // A leaf costs a test per triangle, a split one node visit plus the tests of the children it reaches.
+        const float area = box.Area();
+        const float leafCost = static_cast<float>(count);
+        const float splitCost = area > 0.0f ? 1.0f + bestCost / area : leafCost;
+        auto* begin = ids.data() + first;
+        auto* end = begin + count;
+        if (bestAxis < 0 || (count <= MaxLeafSize && splitCost >= leafCost)) {
+            // Triangles whose centers all coincide can't be told apart, so large leaves are halved in mesh order.
+            return count > MaxLeafSize ? first + count / 2 : first;
+        }
+
+        const float low = Axis(centers.min, bestAxis);
+        const float scale = static_cast<float>(Bins) / (Axis(centers.max, bestAxis) - low);
+        auto* middle = std::partition(begin, end, [&](std::uint32_t id) {
+            return std::min(Bins - 1, static_cast<int>((Axis(centroids[id], bestAxis) - low) * scale)) <= bestBin;
+        });
+        return first + static_cast<std::uint32_t>(middle - begin);
+    }
+
+    std::vector<Node> nodes;
+    /** Triangles in leaf order */
+    std::vector<Triangle> triangles;
+    /** The mesh index of each triangle, and the build order while building */
+    std::vector<std::uint32_t> ids;
+    int depth = 0;
+
+    /** Scratch space of Build() */
+    std::vector<Bounds> bounds;
+    std::vector<::Vector3> centroids;
+};
+} // namespace raylib
+
+using RMeshBVH = raylib::MeshBVH;
+
+#endif // RAYLIB_CPP_INCLUDE_MESHBVH_HPP_
@@ -1,9 +1,12 @@
 #ifndef RAYLIB_CPP_INCLUDE_MESHUNMANAGED_HPP_
 #define RAYLIB_CPP_INCLUDE_MESHUNMANAGED_HPP_
 
+#include <cstddef>
+#include <cstring>
 #include <string>
 #include <vector>
 
+#include "./Allocator.hpp"
 #include "./BoundingBox.hpp"
 #include "./Matrix.hpp"
 #include "./Model.hpp"
@@ -45,6 +48,15 @@ public:
 
     MeshUnmanaged(const ::Mesh& mesh) { set(mesh); }
 
+    /**
+     * Allocate zeroed vertex, texcoord and normal data, and index data when `indexed`, with raylib's MemAlloc(), so
+     * that a Model loaded from the mesh can free it. raylib::Mesh takes its arrays from the buffer allocator instead.
+     *
+     * @throws raylib::RaylibException Thrown if an array could not be allocated, freeing the ones that were.
+     */
+    MeshUnmanaged(int vertexCount, int triangleCount, bool indexed = false)
+        : MeshUnmanaged(vertexCount, triangleCount, indexed, AllocateRaylibBuffer) {}
+
     MeshUnmanaged(::Mesh&& mesh) { set(mesh); }
 
     /**
@@ -144,6 +156,19 @@ public:
      * Unload mesh from memory (RAM and/or VRAM)
      */
     void Unload() {
+        // Arrays from the buffer allocator go back to it, raylib frees the others.
+        ReleaseArray(vertices);
+        ReleaseArray(texcoords);
+        ReleaseArray(texcoords2);
+        ReleaseArray(normals);
+        ReleaseArray(tangents);
+        ReleaseArray(colors);
+        ReleaseArray(indices);
+        ReleaseArray(animVertices);
+        ReleaseArray(animNormals);
+        ReleaseArray(boneIds);
+        ReleaseArray(boneWeights);
+
         if (vboId != nullptr) {
             ::UnloadMesh(*this);
             vboId = nullptr;
@@ -210,7 +235,7 @@ public:
      * Compute mesh tangents
      */
     Mesh& GenTangents() {
-        ::GenMeshTangents(this);
+        ReplaceBuffer(tangents, [this] { ::GenMeshTangents(this); });
         return *this;
     }
 
@@ -230,6 +255,27 @@ public:
     bool IsValid() { return ::IsModelValid(*this); }
 
 protected:
+    MeshUnmanaged(int vertexCount, int triangleCount, bool indexed, void* (*allocate)(std::size_t)) : MeshUnmanaged() {
+        this->vertexCount = vertexCount;
+        this->triangleCount = triangleCount;
+        vertices = AllocateArray<float>(vertexCount * 3, allocate);
+        texcoords = AllocateArray<float>(vertexCount * 2, allocate);
+        normals = AllocateArray<float>(vertexCount * 3, allocate);
+        if (indexed) {
+            indices = AllocateArray<unsigned short>(triangleCount * 3, allocate); // NOLINT
+        }
+
+        const bool failed = (vertexCount > 0 && (vertices == nullptr || texcoords == nullptr || normals == nullptr)) ||
+                            (indexed && triangleCount > 0 && indices == nullptr);
+        if (failed) {
+            FreeArray(vertices);
+            FreeArray(texcoords);
+            FreeArray(normals);
+            FreeArray(indices);
+            throw RaylibException("Failed to allocate the Mesh arrays");
+        }
+    }
+
     void set(const ::Mesh& mesh) {
         vertexCount = mesh.vertexCount;
         triangleCount = mesh.triangleCount;
@@ -248,6 +294,31 @@ protected:
         vaoId = mesh.vaoId;
         vboId = mesh.vboId;
     }
+
+    template<typename T>
+    static T* AllocateArray(int count, void* (*allocate)(std::size_t)) {
+        const std::size_t size = sizeof(T) * static_cast<std::size_t>(count > 0 ? count : 0);
+        auto* array = static_cast<T*>(allocate(size));
+        if (array != nullptr) {
+            std::memset(array, 0, size);
+        }
+        return array;
+    }
+
+    template<typename T>
+    static void ReleaseArray(T*& array) {
+        if (ReleaseBuffer(array)) {
+            array = nullptr;
+        }
+    }
+
+    template<typename T>
+    static void FreeArray(T*& array) {
+        if (array != nullptr && !ReleaseBuffer(array)) {
+            ::MemFree(array);
+        }
+        array = nullptr;
+    }
 };
 } // namespace raylib
 
@@ -0,0 +1,500 @@
+#ifndef RAYLIB_CPP_INCLUDE_MUSICSTREAMER_HPP_
+#define RAYLIB_CPP_INCLUDE_MUSICSTREAMER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "./AudioStream.hpp"
+#include "./RaylibException.hpp"
+#include "./Wave.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Music that a worker thread decodes ahead of time, into a queue of buffers.
+ *
+ * raylib::Music decodes in Update(), on the thread that calls it, so a slow decode makes the frame late. Here a
+ * worker thread keeps up to the prefetch depth of buffers decoded, and Update() only hands the next decoded buffer
+ * to raylib when the stream wants one. When the worker falls behind, Update() counts an underrun.
+ *
+ * Update(), Play(), Stop() and Seek() must be called from the same thread.
+ *
+ * @code
+ * raylib::MusicStreamer music("resources/country.mp3");
+ * music.Play();
+ * while (!window.ShouldClose()) {
+ *     music.Update();
+ * }
+ * @endcode
+ */
+class MusicStreamer {
+public:
+    /**
+     * Fills up to `frameCount` frames in the stream's format, starting `position` frames into the music, on the
+     * worker thread. Returns the number of frames filled, where fewer than asked for means the music ended.
+     */
+    using Decoder = std::function<unsigned int(void* frames, unsigned int frameCount, unsigned int position)>;
+
+    /**
+     * Counters of the decoding and swapping.
+     */
+    struct Stats {
+        /** Buffers the worker decoded */
+        std::uint64_t decoded;
+        /** Buffers handed to raylib */
+        std::uint64_t played;
+        /** Times the stream wanted a buffer, and none was decoded yet */
+        std::uint64_t underruns;
+        /** The fewest decoded buffers waiting when the stream wanted one */
+        unsigned int minQueued;
+        /** The longest time a buffer took to decode, in seconds */
+        float maxDecodeTime;
+    };
+
+    /**
+     * Stream music from a decoder.
+     *
+     * @param bufferFrames Frames per buffer. raylib's stream buffers get the same size, so it must be at least the
+     * audio device's period.
+     * @param prefetchDepth How many buffers the worker decodes ahead.
+     *
+     * @throws raylib::RaylibException Throws if the audio stream failed to load.
+     */
+    MusicStreamer(
+        Decoder decoder,
+        unsigned int sampleRate,
+        unsigned int sampleSize,
+        unsigned int channels,
+        unsigned int bufferFrames = 4096,
+        unsigned int prefetchDepth = 4)
+        : stream(LoadStream(sampleRate, sampleSize, channels, bufferFrames))
+        , decoder(std::move(decoder))
+        , bufferFrames(bufferFrames)
+        , prefetchDepth(std::max(prefetchDepth, 1u))
+        , bufferSize(static_cast<std::size_t>(bufferFrames) * (sampleSize / 8 * channels))
+        , buffers(bufferSize * this->prefetchDepth)
+        , bufferLengths(this->prefetchDepth, 0) {
+        ResetStats();
+        worker = std::thread([this] { WorkerLoop(); });
+    }
+
+    /**
+     * Stream music from a wave.
+     *
+     * @throws raylib::RaylibException Throws if the audio stream failed to load.
+     */
+    MusicStreamer(std::shared_ptr<const ::Wave> wave, unsigned int bufferFrames = 4096, unsigned int prefetchDepth = 4)
+        : MusicStreamer(
+              WaveDecoder(wave),
+              wave->sampleRate,
+              wave->sampleSize,
+              wave->channels,
+              bufferFrames,
+              prefetchDepth) {}
+
+    /**
+     * Play music from a file.
+     *
+     * raylib doesn't expose its music decoders, so this doesn't stream: the worker thread decodes the whole file into
+     * memory before the first buffer, and Update() counts underruns until it's done. Only the file's format is read
+     * here. Give a Decoder to decode a long file in pieces.
+     *
+     * @throws raylib::RaylibException Throws if the file's format couldn't be read, or the audio stream failed to
+     * load. A file that fails to decode afterwards plays as silence that ends at once.
+     */
+    MusicStreamer(const std::string& fileName, unsigned int bufferFrames = 4096, unsigned int prefetchDepth = 4)
+        : MusicStreamer(fileName, LoadFormat(fileName), bufferFrames, prefetchDepth) {}
+
+    MusicStreamer(const MusicStreamer&) = delete;
+    MusicStreamer& operator=(const MusicStreamer&) = delete;
+
+    /**
+     * Stops the worker, and unloads the stream.
+     */
+    ~MusicStreamer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        worker.join();
+    }
+
+    GETTER(unsigned int, BufferFrames, bufferFrames)
+    GETTER(unsigned int, PrefetchDepth, prefetchDepth)
+
+    /**
+     * Retrieve the stream the buffers are handed to.
+     */
+    [[nodiscard]] AudioStream& GetStream() { return stream; }
+
+    /**
+     * Set whether the music starts over when it ends. Takes effect on the buffers decoded afterwards.
+     */
+    MusicStreamer& SetLooping(bool value) {
+        looping.store(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    [[nodiscard]] bool GetLooping() const { return looping.load(std::memory_order_relaxed); }
+
+    /**
+     * Hand decoded buffers to raylib, for as many as the stream has played. Call it once a frame.
+     */
+    MusicStreamer& Update() {
+        while (stream.IsProcessed()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (queued == 0) {
+                if (!finished) {
+                    if (stream.IsPlaying()) {
+                        stats.underruns++;
+                    }
+                    break;
+                }
+                lock.unlock();
+                // Fill the played buffer with silence, and stop once the other one, with the last frames, is played.
+                stream.Update(buffers.data(), 0);
+                if (++drained >= 2) {
+                    Stop();
+                    break;
+                }
+                continue;
+            }
+            stats.minQueued = std::min(stats.minQueued, static_cast<unsigned int>(queued));
+            const std::size_t slot = head;
+            lock.unlock();
+
+            // The worker never writes to a buffer that is still queued, so this doesn't need the lock.
+            stream.Update(&buffers[slot * bufferSize], static_cast<int>(bufferLengths[slot]));
+
+            lock.lock();
+            head = (head + 1) % prefetchDepth;
+            queued--;
+            stats.played++;
+            lock.unlock();
+            wake.notify_one();
+        }
+        return *this;
+    }
+
+    /**
+     * Start music playing
+     */
+    MusicStreamer& Play() {
+        stream.Play();
+        return *this;
+    }
+
+    /**
+     * Stop music playing, and go back to the start.
+     */
+    MusicStreamer& Stop() {
+        stream.Stop();
+        Restart(0);
+        return *this;
+    }
+
+    /**
+     * Pause music playing
+     */
+    MusicStreamer& Pause() {
+        stream.Pause();
+        return *this;
+    }
+
+    /**
+     * Resume music playing
+     */
+    MusicStreamer& Resume() {
+        stream.Resume();
+        return *this;
+    }
+
+    /**
+     * Seek music to a position (in seconds). Drops the decoded buffers.
+     */
+    MusicStreamer& Seek(float position) {
+        Restart(static_cast<unsigned int>(std::max(position, 0.0f) * static_cast<float>(stream.sampleRate)));
+        return *this;
+    }
+
+    /**
+     * Check if music is playing
+     */
+    [[nodiscard]] bool IsPlaying() const { return stream.IsPlaying(); }
+
+    /**
+     * Set volume for music (1.0 is max level)
+     */
+    MusicStreamer& SetVolume(float volume = 1.0f) {
+        stream.SetVolume(volume);
+        return *this;
+    }
+
+    /**
+     * Set pitch for music (1.0 is base level)
+     */
+    MusicStreamer& SetPitch(float pitch) {
+        stream.SetPitch(pitch);
+        return *this;
+    }
+
+    /**
+     * Set pan for music (0.5 is center)
+     */
+    MusicStreamer& SetPan(float pan = 0.5f) {
+        stream.SetPan(pan);
+        return *this;
+    }
+
+    /**
+     * Retrieve how many decoded buffers are waiting for Update().
+     */
+    [[nodiscard]] unsigned int GetQueued() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<unsigned int>(queued);
+    }
+
+    /**
+     * Retrieve whether the worker decoded the last frames of the music.
+     */
+    [[nodiscard]] bool IsFinished() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return finished;
+    }
+
+    /**
+     * Retrieve the counters.
+     */
+    [[nodiscard]] Stats GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        Stats result = stats;
+        if (result.minQueued == NoSwaps) {
+            result.minQueued = 0;
+        }
+        return result;
+    }
+
+    /**
+     * Set the counters back to zero.
+     */
+    void ResetStats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats = {0, 0, 0, NoSwaps, 0.0f};
+    }
+
+    /**
+     * Create a decoder that copies frames out of a wave.
+     */
+    static Decoder WaveDecoder(std::shared_ptr<const ::Wave> wave) {
+        return [wave = std::move(wave)](void* frames, unsigned int frameCount, unsigned int position) {
+            if (position >= wave->frameCount) {
+                return 0u;
+            }
+            const unsigned int count = std::min(frameCount, wave->frameCount - position);
+            const std::size_t frameSize = wave->sampleSize / 8 * wave->channels;
+            std::memcpy(
+                frames,
+                static_cast<const unsigned char*>(wave->data) + static_cast<std::size_t>(position) * frameSize,
+                static_cast<std::size_t>(count) * frameSize);
+            return count;
+        };
+    }
+protected:
+    static constexpr unsigned int NoSwaps = ~0u;
+
+    /**
+     * The format raylib plays a file in.
+     */
+    struct Format {
+        unsigned int sampleRate;
+        unsigned int sampleSize;
+        unsigned int channels;
+    };
+
+    MusicStreamer(
+        const std::string& fileName,
+        const Format& format,
+        unsigned int bufferFrames,
+        unsigned int prefetchDepth)
+        : MusicStreamer(
+              FileDecoder(fileName, format),
+              format.sampleRate,
+              format.sampleSize,
+              format.channels,
+              bufferFrames,
+              prefetchDepth) {}
+
+    /**
+     * Read a file's format, by opening it as raylib's music, which decodes no more than its header.
+     */
+    static Format LoadFormat(const std::string& fileName) {
+        ::Music music = ::LoadMusicStream(fileName.c_str());
+        if (!::IsMusicValid(music)) {
+            throw RaylibException("Failed to load Music from file: " + fileName);
+        }
+        const Format result{music.stream.sampleRate, music.stream.sampleSize, music.stream.channels};
+        ::UnloadMusicStream(music);
+        return result;
+    }
+
+    /**
+     * Create a decoder that decodes a file into a wave on its first call, which is on the worker thread.
+     */
+    static Decoder FileDecoder(const std::string& fileName, const Format& format) {
+        return [fileName, format, decode = Decoder()](
+                   void* frames,
+                   unsigned int frameCount,
+                   unsigned int position) mutable {
+            if (!decode) {
+                auto wave = std::make_shared<Wave>();
+                try {
+                    wave->Load(fileName);
+                    // raylib's music and waves don't always decode a file to the same sample size.
+                    wave->Format(
+                        static_cast<int>(format.sampleRate),
+                        static_cast<int>(format.sampleSize),
+                        static_cast<int>(format.channels));
+                } catch (const RaylibException&) {
+                    wave = std::make_shared<Wave>();
+                }
+                decode = WaveDecoder(std::move(wave));
+            }
+            return decode(frames, frameCount, position);
+        };
+    }
+
+    /**
+     * Load a stream whose two buffers hold `bufferFrames` frames each, so each decoded buffer fills one exactly.
+     */
+    static ::AudioStream
+    LoadStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int bufferFrames) {
+        ::SetAudioStreamBufferSizeDefault(static_cast<int>(bufferFrames));
+        ::AudioStream result = ::LoadAudioStream(sampleRate, sampleSize, channels);
+        // Back to the size other streams get, as set through AudioStream::SetBufferSizeDefault().
+        ::SetAudioStreamBufferSizeDefault(AudioStream::GetBufferSizeDefault());
+        if (!::IsAudioStreamValid(result)) {
+            throw RaylibException("Failed to load the AudioStream for a MusicStreamer");
+        }
+        return result;
+    }
+
+    /**
+     * Drop the decoded buffers, and decode from a position.
+     */
+    void Restart(unsigned int position) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            generation++;
+            head = 0;
+            queued = 0;
+            decodePosition = position;
+            finished = false;
+            drained = 0;
+        }
+        wake.notify_one();
+    }
+
+    void WorkerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wake.wait(lock, [this] { return stopping || (!finished && queued < prefetchDepth); });
+            if (stopping) {
+                return;
+            }
+            const std::size_t slot = (head + queued) % prefetchDepth;
+            const unsigned int started = generation;
+            unsigned int position = decodePosition;
+            lock.unlock();
+
+            const auto start = std::chrono::steady_clock::now();
+            bool ended = false;
+            const unsigned int length = Decode(&buffers[slot * bufferSize], position, ended);
+            const std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+
+            lock.lock();
+            // A seek while decoding makes the buffer stale.
+            if (started != generation) {
+                continue;
+            }
+            decodePosition = position;
+            finished = ended;
+            if (length > 0) {
+                bufferLengths[slot] = length;
+                queued++;
+                stats.decoded++;
+                stats.maxDecodeTime = std::max(stats.maxDecodeTime, elapsed.count());
+            }
+        }
+    }
+
+    /**
+     * Decode one buffer, going back to the start when looping.
+     */
+    unsigned int Decode(unsigned char* out, unsigned int& position, bool& ended) {
+        const std::size_t frameSize = bufferSize / bufferFrames;
+        unsigned int filled = 0;
+        while (filled < bufferFrames) {
+            const unsigned int wanted = bufferFrames - filled;
+            const unsigned int count = decoder(out + filled * frameSize, wanted, position);
+            filled += count;
+            position += count;
+            if (count < wanted) {
+                // Music without frames would loop forever.
+                if (!looping.load(std::memory_order_relaxed) || position == 0) {
+                    ended = true;
+                    break;
+                }
+                position = 0;
+            }
+        }
+        return filled;
+    }
+
+    AudioStream stream;
+    Decoder decoder;
+    unsigned int bufferFrames;
+    unsigned int prefetchDepth;
+    std::size_t bufferSize;
+    std::atomic<bool> looping{false};
+
+    /** Every buffer, one after the other */
+    std::vector<unsigned char> buffers;
+    /** The frames decoded into each buffer */
+    std::vector<unsigned int> bufferLengths;
+
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    /** The buffer Update() hands to raylib next */
+    std::size_t head{0};
+    std::size_t queued{0};
+    /** Where the worker decodes next */
+    unsigned int decodePosition{0};
+    /** Changes with every seek, so the worker can drop what it was decoding */
+    unsigned int generation{0};
+    bool finished{false};
+    bool stopping{false};
+    /** Buffers of silence given to raylib after the last frames */
+    int drained{0};
+    Stats stats;
+
+    std::thread worker;
+};
+} // namespace raylib
+
+using RMusicStreamer = raylib::MusicStreamer;
+
+#endif // RAYLIB_CPP_INCLUDE_MUSICSTREAMER_HPP_
@@ -0,0 +1,390 @@
+#ifndef RAYLIB_CPP_INCLUDE_PARALLELIMAGE_HPP_
+#define RAYLIB_CPP_INCLUDE_PARALLELIMAGE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <span>
+
+#include "./Allocator.hpp"
+#include "./PixelKernels.hpp"
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Tile-parallel image processing.
+ *
+ * Splits an image's pixel rows into bands, and processes the bands concurrently on a ThreadPool. Each band is
+ * run through the same routine as the serial Image methods, so the output is byte-identical to them. R8G8B8A8
+ * bands are processed in place by the raylib::pixels kernels.
+ * Compressed images, images with mipmaps, and pools without workers fall back to the serial routine.
+ */
+namespace parallel {
+namespace detail {
+/**
+ * Whether the image's rows can be processed as independent bands, and there are workers to share them with.
+ */
+inline bool CanSplit(const ::Image& image, const ThreadPool& pool) {
+    return pool.GetWorkerCount() > 0 && image.data != nullptr && image.width > 0 && image.height > 0 &&
+           image.mipmaps == 1 && image.format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE &&
+           image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB;
+}
+
+/**
+ * Rows per band: a few bands per thread, so that work-stealing can even out the load.
+ */
+inline std::size_t BandRows(const ::Image& image, const ThreadPool& pool) {
+    const int bands = static_cast<int>(pool.GetConcurrency()) * 4;
+    return static_cast<std::size_t>(std::max(16, (image.height + bands - 1) / bands));
+}
+
+/**
+ * Run `process` on a copy of each band, extended by `halo` rows above and below, and assemble the processed
+ * rows into image data of `resultFormat`.
+ *
+ * @throws raylib::RaylibException Thrown if `process` did not produce a band of `resultFormat`, or a buffer could
+ * not be allocated.
+ */
+template<typename F>
+void ForEachBand(::Image& image, int halo, int resultFormat, ThreadPool& pool, F process) {
+    const auto sourceRow = static_cast<std::size_t>(::GetPixelDataSize(image.width, 1, image.format));
+    const auto resultRow = static_cast<std::size_t>(::GetPixelDataSize(image.width, 1, resultFormat));
+    const auto height = static_cast<std::size_t>(image.height);
+
+    // Without a halo, bands never read each other's rows, so they can be written back in place.
+    const bool inPlace = halo == 0 && sourceRow == resultRow;
+    auto* const source = static_cast<unsigned char*>(image.data);
+    // The result goes to the caller's image, which may be a plain ::Image freed by raylib, so it skips the allocator.
+    auto* const result =
+        inPlace ? source : static_cast<unsigned char*>(AllocateRaylibBuffer(resultRow * height));
+    if (result == nullptr) {
+        throw RaylibException("Failed to allocate the processed image");
+    }
+    std::atomic<bool> failed{false};
+
+    pool.ParallelFor(0, height, BandRows(image, pool), [&](std::size_t first, std::size_t last) {
+        const std::size_t top = first > static_cast<std::size_t>(halo) ? first - static_cast<std::size_t>(halo) : 0;
+        const std::size_t bottom = std::min(height, last + static_cast<std::size_t>(halo));
+        const std::size_t rows = bottom - top;
+
+        ::Image band{AllocateBuffer(sourceRow * rows), image.width, static_cast<int>(rows), 1, image.format};
+        if (band.data == nullptr) {
+            failed = true;
+            return;
+        }
+        std::memcpy(band.data, source + top * sourceRow, sourceRow * rows);
+        ReplaceBuffer(band.data, [&] { process(&band); });
+
+        if (band.data == nullptr || band.width != image.width || band.height != static_cast<int>(rows) ||
+            band.format != resultFormat) {
+            failed = true;
+        } else {
+            std::memcpy(
+                result + first * resultRow,
+                static_cast<unsigned char*>(band.data) + (first - top) * resultRow,
+                (last - first) * resultRow);
+        }
+        if (!ReleaseBuffer(band.data)) {
+            ::UnloadImage(band);
+        }
+    });
+
+    if (failed) {
+        if (!inPlace) {
+            ::MemFree(result);
+        }
+        throw RaylibException("Failed to process image bands");
+    }
+    if (!inPlace) {
+        if (!ReleaseBuffer(image.data)) {
+            ::MemFree(image.data);
+        }
+        image.data = result;
+    }
+    image.format = resultFormat;
+}
+
+/**
+ * Apply a raylib routine that works on each pixel independently, keeping the image format.
+ */
+template<typename F>
+void PerPixel(::Image& image, ThreadPool& pool, F process) {
+    if (!CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { process(&image); });
+        return;
+    }
+    ForEachBand(image, 0, image.format, pool, process);
+}
+
+/**
+ * Run a raylib::pixels kernel in place over bands of an R8G8B8A8 image's rows.
+ */
+template<typename F>
+void ForEachPixelBand(::Image& image, ThreadPool& pool, F kernel) {
+    const std::span<::Color> all = pixels::GetSpan(image);
+    if (!CanSplit(image, pool)) {
+        kernel(all);
+        return;
+    }
+    const auto width = static_cast<std::size_t>(image.width);
+    pool.ParallelFor(0, static_cast<std::size_t>(image.height), BandRows(image, pool),
+        [&](std::size_t first, std::size_t last) { kernel(all.subspan(first * width, (last - first) * width)); });
+}
+
+/**
+ * Apply a byte-level remap of the pixels, where `copyRow(result, y)` fills result row `y`.
+ *
+ * @throws raylib::RaylibException Thrown if the result could not be allocated, leaving the image as it was.
+ */
+template<typename F>
+void Remap(::Image& image, int newWidth, int newHeight, ThreadPool& pool, F copyRow) {
+    const auto resultRow = static_cast<std::size_t>(::GetPixelDataSize(newWidth, 1, image.format));
+    auto* const result =
+        static_cast<unsigned char*>(AllocateRaylibBuffer(resultRow * static_cast<std::size_t>(newHeight)));
+    if (result == nullptr) {
+        throw RaylibException("Failed to allocate the remapped image");
+    }
+    ::Image resultImage{result, newWidth, newHeight, 1, image.format};
+
+    pool.ParallelFor(0, static_cast<std::size_t>(newHeight), BandRows(resultImage, pool),
+        [&](std::size_t first, std::size_t last) {
+            for (std::size_t y = first; y < last; y++) {
+                copyRow(result + y * resultRow, y);
+            }
+        });
+
+    if (!ReleaseBuffer(image.data)) {
+        ::MemFree(image.data);
+    }
+    image.data = result;
+    image.width = newWidth;
+    image.height = newHeight;
+}
+} // namespace detail
+
+/**
+ * Convert image data to desired format
+ */
+inline void Format(::Image& image, int newFormat, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool) || newFormat == image.format || newFormat < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE ||
+        newFormat >= PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+        ReplaceBuffer(image.data, [&] { ::ImageFormat(&image, newFormat); });
+        return;
+    }
+    detail::ForEachBand(image, 0, newFormat, pool, [newFormat](::Image* band) { ::ImageFormat(band, newFormat); });
+}
+
+/**
+ * Modify image color: tint
+ */
+inline void ColorTint(::Image& image, ::Color color, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [color](std::span<::Color> band) { pixels::ColorTint(band, color); });
+        return;
+    }
+    detail::PerPixel(image, pool, [color](::Image* band) { ::ImageColorTint(band, color); });
+}
+
+/**
+ * Modify image color: invert
+ */
+inline void ColorInvert(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [](std::span<::Color> band) { pixels::ColorInvert(band); });
+        return;
+    }
+    detail::PerPixel(image, pool, [](::Image* band) { ::ImageColorInvert(band); });
+}
+
+/**
+ * Modify image color: grayscale
+ */
+inline void ColorGrayscale(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { ::ImageColorGrayscale(&image); });
+        return;
+    }
+    detail::ForEachBand(image, 0, PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, pool, [](::Image* band) {
+        ::ImageColorGrayscale(band);
+    });
+}
+
+/**
+ * Modify image color: contrast
+ *
+ * @param contrast Contrast values between -100 and 100
+ */
+inline void ColorContrast(::Image& image, float contrast, ThreadPool& pool = ThreadPool::GetDefault()) {
+    detail::PerPixel(image, pool, [contrast](::Image* band) { ::ImageColorContrast(band, contrast); });
+}
+
+/**
+ * Modify image color: brightness
+ *
+ * @param brightness Brightness values between -255 and 255
+ */
+inline void ColorBrightness(::Image& image, int brightness, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [brightness](std::span<::Color> band) {
+            pixels::ColorBrightness(band, brightness);
+        });
+        return;
+    }
+    detail::PerPixel(image, pool, [brightness](::Image* band) { ::ImageColorBrightness(band, brightness); });
+}
+
+/**
+ * Modify image color: replace color
+ */
+inline void ColorReplace(::Image& image, ::Color color, ::Color replace, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [color, replace](std::span<::Color> band) {
+            pixels::ColorReplace(band, color, replace);
+        });
+        return;
+    }
+    detail::PerPixel(image, pool, [color, replace](::Image* band) { ::ImageColorReplace(band, color, replace); });
+}
+
+/**
+ * Clear alpha channel to desired color
+ */
+inline void AlphaClear(::Image& image, ::Color color, float threshold, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [color, threshold](std::span<::Color> band) {
+            pixels::AlphaClear(band, color, threshold);
+        });
+        return;
+    }
+    detail::PerPixel(image, pool, [color, threshold](::Image* band) { ::ImageAlphaClear(band, color, threshold); });
+}
+
+/**
+ * Premultiply alpha channel
+ */
+inline void AlphaPremultiply(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (pixels::IsSupported(image)) {
+        detail::ForEachPixelBand(image, pool, [](std::span<::Color> band) { pixels::AlphaPremultiply(band); });
+        return;
+    }
+    detail::PerPixel(image, pool, [](::Image* band) { ::ImageAlphaPremultiply(band); });
+}
+
+/**
+ * Apply custom square convolution kernel to image
+ *
+ * Bands overlap by the kernel radius, plus one row, since raylib's kernel reads wrap around row ends.
+ */
+inline void KernelConvolution(
+    ::Image& image,
+    const float* kernel,
+    int kernelSize,
+    ThreadPool& pool = ThreadPool::GetDefault()) {
+    const auto kernelWidth = static_cast<int>(std::sqrt(static_cast<float>(kernelSize)));
+    if (!detail::CanSplit(image, pool) || kernel == nullptr || kernelWidth * kernelWidth != kernelSize) {
+        ReplaceBuffer(image.data, [&] { ::ImageKernelConvolution(&image, kernel, kernelSize); });
+        return;
+    }
+    detail::ForEachBand(image, kernelWidth / 2 + 1, image.format, pool, [kernel, kernelSize](::Image* band) {
+        ::ImageKernelConvolution(band, kernel, kernelSize);
+    });
+}
+
+/**
+ * Flip image vertically
+ */
+inline void FlipVertical(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { ::ImageFlipVertical(&image); });
+        return;
+    }
+    const auto row = static_cast<std::size_t>(::GetPixelDataSize(image.width, 1, image.format));
+    const auto* const source = static_cast<const unsigned char*>(image.data);
+    const auto height = static_cast<std::size_t>(image.height);
+    detail::Remap(image, image.width, image.height, pool, [=](unsigned char* result, std::size_t y) {
+        std::memcpy(result, source + (height - y - 1) * row, row);
+    });
+}
+
+/**
+ * Flip image horizontally
+ */
+inline void FlipHorizontal(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { ::ImageFlipHorizontal(&image); });
+        return;
+    }
+    const auto pixel = static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format));
+    const auto* const source = static_cast<const unsigned char*>(image.data);
+    const auto width = static_cast<std::size_t>(image.width);
+    detail::Remap(image, image.width, image.height, pool, [=](unsigned char* result, std::size_t y) {
+        const unsigned char* sourceRow = source + y * width * pixel;
+        for (std::size_t x = 0; x < width; x++) {
+            std::memcpy(result + x * pixel, sourceRow + (width - x - 1) * pixel, pixel);
+        }
+    });
+}
+
+/**
+ * Rotate image clockwise 90deg
+ */
+inline void RotateCW(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { ::ImageRotateCW(&image); });
+        return;
+    }
+    const auto pixel = static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format));
+    const auto* const source = static_cast<const unsigned char*>(image.data);
+    const auto width = static_cast<std::size_t>(image.width);
+    const auto height = static_cast<std::size_t>(image.height);
+    // Result row y is source column y, read bottom to top.
+    detail::Remap(image, image.height, image.width, pool, [=](unsigned char* result, std::size_t y) {
+        for (std::size_t x = 0; x < height; x++) {
+            std::memcpy(result + x * pixel, source + ((height - x - 1) * width + y) * pixel, pixel);
+        }
+    });
+}
+
+/**
+ * Rotate image counter-clockwise 90deg
+ */
+inline void RotateCCW(::Image& image, ThreadPool& pool = ThreadPool::GetDefault()) {
+    if (!detail::CanSplit(image, pool)) {
+        ReplaceBuffer(image.data, [&] { ::ImageRotateCCW(&image); });
+        return;
+    }
+    const auto pixel = static_cast<std::size_t>(::GetPixelDataSize(1, 1, image.format));
+    const auto* const source = static_cast<const unsigned char*>(image.data);
+    const auto width = static_cast<std::size_t>(image.width);
+    const auto height = static_cast<std::size_t>(image.height);
+    // Result row y is source column (width - y - 1), read top to bottom.
+    detail::Remap(image, image.height, image.width, pool, [=](unsigned char* result, std::size_t y) {
+        for (std::size_t x = 0; x < height; x++) {
+            std::memcpy(result + x * pixel, source + (x * width + (width - y - 1)) * pixel, pixel);
+        }
+    });
+}
+
+/**
+ * Run `fn` on every image of a range, one image per task.
+ *
+ * Use this for operations that can't be split into bands of rows, like Resize(), Rotate() or Dither(), when
+ * there are many images to process.
+ */
+template<typename Range, typename F>
+void ForEach(Range& images, F fn, ThreadPool& pool = ThreadPool::GetDefault()) {
+    pool.ParallelFor(0, std::size(images), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++) {
+            fn(images[i]);
+        }
+    });
+}
+} // namespace parallel
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_PARALLELIMAGE_HPP_
@@ -0,0 +1,225 @@
+#ifndef RAYLIB_CPP_INCLUDE_PARTICLES_HPP_
+#define RAYLIB_CPP_INCLUDE_PARTICLES_HPP_
+
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./SpriteBatch.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Particles stored as a structure of arrays: contiguous position, velocity and color streams.
+ *
+ * Updates stream through memory instead of chasing pointers, run on several lanes at once with raylib::simd, and
+ * split into chunks on a ThreadPool. Removing a particle moves the last one into its place, so indices are only
+ * stable until the next removal.
+ *
+ * @code
+ * raylib::Particles bunnies;
+ * bunnies.Add(GetMousePosition(), {4, -2}, RED);
+ * bunnies.Update(1.0f, {0, 40, 800, 410});
+ * bunnies.Draw(batch, texBunny);
+ * @endcode
+ */
+class Particles {
+public:
+    Particles() = default;
+
+    /**
+     * @param capacity Number of particles to reserve room for.
+     */
+    explicit Particles(std::size_t capacity) { Reserve(capacity); }
+
+    void Reserve(std::size_t capacity) {
+        positions.reserve(capacity);
+        velocities.reserve(capacity);
+        colors.reserve(capacity);
+    }
+
+    /**
+     * Add a particle.
+     *
+     * @return The index of the new particle.
+     */
+    std::size_t Add(::Vector2 position, ::Vector2 velocity = {0.0f, 0.0f}, ::Color color = {255, 255, 255, 255}) {
+        positions.push_back(position);
+        velocities.push_back(velocity);
+        colors.push_back(color);
+        return positions.size() - 1;
+    }
+
+    /**
+     * Remove a particle by moving the last particle into its place.
+     */
+    void Remove(std::size_t index) {
+        const std::size_t last = positions.size() - 1;
+        if (index != last) {
+            positions[index] = positions[last];
+            velocities[index] = velocities[last];
+            colors[index] = colors[last];
+        }
+        positions.pop_back();
+        velocities.pop_back();
+        colors.pop_back();
+    }
+
+    /**
+     * Remove every particle for which `predicate(index)` returns true, by swapping in particles from the end.
+     *
+     * @return The number of particles removed.
+     */
+    template<typename F>
+    std::size_t RemoveIf(F&& predicate) {
+        const std::size_t count = positions.size();
+        std::size_t i = 0;
+        while (i < positions.size()) {
+            if (predicate(i)) {
+                // The particle moved into `i` hasn't been checked yet.
+                Remove(i);
+            } else {
+                i++;
+            }
+        }
+        return count - positions.size();
+    }
+
+    void Clear() {
+        positions.clear();
+        velocities.clear();
+        colors.clear();
+    }
+
+    [[nodiscard]] std::size_t GetCount() const { return positions.size(); }
+    [[nodiscard]] bool IsEmpty() const { return positions.empty(); }
+
+    [[nodiscard]] std::span<::Vector2> GetPositions() { return positions; }
+    [[nodiscard]] std::span<const ::Vector2> GetPositions() const { return positions; }
+    [[nodiscard]] std::span<::Vector2> GetVelocities() { return velocities; }
+    [[nodiscard]] std::span<const ::Vector2> GetVelocities() const { return velocities; }
+    [[nodiscard]] std::span<::Color> GetColors() { return colors; }
+    [[nodiscard]] std::span<const ::Color> GetColors() const { return colors; }
+
+    /**
+     * Move every particle by its velocity times `delta`.
+     */
+    void Update(float delta) { Update(0, positions.size(), delta, nullptr); }
+
+    /**
+     * Move every particle by its velocity times `delta`, then turn around the particles that are outside `bounds`
+     * and still moving away from it.
+     */
+    void Update(float delta, ::Rectangle bounds) { Update(0, positions.size(), delta, &bounds); }
+
+    /**
+     * Update() in chunks on a thread pool.
+     */
+    void Update(float delta, ThreadPool& pool, std::size_t grain = 16384) {
+        ForEachChunk(pool, grain, [this, delta](std::size_t begin, std::size_t end) {
+            Update(begin, end, delta, nullptr);
+        });
+    }
+
+    /**
+     * Update() with bounds, in chunks on a thread pool.
+     */
+    void Update(float delta, ::Rectangle bounds, ThreadPool& pool, std::size_t grain = 16384) {
+        ForEachChunk(pool, grain, [this, delta, &bounds](std::size_t begin, std::size_t end) {
+            Update(begin, end, delta, &bounds);
+        });
+    }
+
+    /**
+     * Call fn(begin, end) for chunks of at most `grain` particles in parallel, and wait for all of them. Chunks
+     * may change the particles in their range, but not add or remove any.
+     */
+    template<typename F>
+    void ForEachChunk(ThreadPool& pool, std::size_t grain, F&& fn) {
+        pool.ParallelFor(0, positions.size(), grain, std::forward<F>(fn));
+    }
+
+    /**
+     * Draw every particle with the texture at its position, tinted by its color.
+     */
+    void Draw(const ::Texture2D& texture) const {
+        for (std::size_t i = 0; i < positions.size(); i++) {
+            ::DrawTextureV(texture, positions[i], colors[i]);
+        }
+    }
+
+    /**
+     * Add every particle to a sprite batch.
+     */
+    void Draw(SpriteBatch& batch, const ::Texture2D& texture, int layer = 0) const {
+        batch.Draw(texture, positions, colors, layer);
+    }
+protected:
+    /**
+     * Positions and velocities are interleaved x, y pairs, so the SIMD loop treats them as flat float arrays, with
+     * alternating x and y bounds in the lanes. Turning around uses the velocity's magnitude, so a particle outside
+     * the bounds that is already moving back keeps going.
+     */
+    void Update(std::size_t begin, std::size_t end, float delta, const ::Rectangle* bounds) {
+        if (begin >= end) {
+            return;
+        }
+        float* position = &positions.data()->x;
+        float* velocity = &velocities.data()->x;
+        const float lower[2] = {bounds ? bounds->x : 0.0f, bounds ? bounds->y : 0.0f};
+        const float upper[2] = {
+            bounds ? bounds->x + bounds->width : 0.0f,
+            bounds ? bounds->y + bounds->height : 0.0f};
+
+        std::size_t i = begin * 2;
+        const std::size_t count = end * 2;
+        if constexpr (simd::width % 2 == 0) {
+            float lowerLanes[simd::width];
+            float upperLanes[simd::width];
+            for (std::size_t lane = 0; lane < simd::width; lane++) {
+                lowerLanes[lane] = lower[lane % 2];
+                upperLanes[lane] = upper[lane % 2];
+            }
+            const simd::floatv vlower = simd::Load(lowerLanes);
+            const simd::floatv vupper = simd::Load(upperLanes);
+            const simd::floatv vdelta = simd::Set(delta);
+            const simd::floatv zero = simd::Set(0.0f);
+            for (; i + simd::width <= count; i += simd::width) {
+                simd::floatv v = simd::Load(velocity + i);
+                const simd::floatv p = simd::Add(simd::Load(position + i), simd::Mul(v, vdelta));
+                simd::Store(position + i, p);
+                if (bounds != nullptr) {
+                    const simd::floatv speed = simd::Max(v, simd::Sub(zero, v));
+                    v = simd::Select(simd::Greater(vlower, p), speed, v);
+                    v = simd::Select(simd::Greater(p, vupper), simd::Sub(zero, speed), v);
+                    simd::Store(velocity + i, v);
+                }
+            }
+        }
+        for (; i < count; i++) {
+            const float p = position[i] + velocity[i] * delta;
+            position[i] = p;
+            if (bounds != nullptr) {
+                const float speed = velocity[i] < 0.0f ? -velocity[i] : velocity[i];
+                if (lower[i % 2] > p) {
+                    velocity[i] = speed;
+                }
+                if (p > upper[i % 2]) {
+                    velocity[i] = -speed;
+                }
+            }
+        }
+    }
+
+    std::vector<::Vector2> positions;
+    std::vector<::Vector2> velocities;
+    std::vector<::Color> colors;
+};
+} // namespace raylib
+
+using RParticles = raylib::Particles;
+
+#endif // RAYLIB_CPP_INCLUDE_PARTICLES_HPP_
@@ -0,0 +1,248 @@
+#ifndef RAYLIB_CPP_INCLUDE_PIXELKERNELS_HPP_
+#define RAYLIB_CPP_INCLUDE_PIXELKERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Color kernels for PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 pixel data.
+ *
+ * The kernels work on the raw pixels in place, several pixels per SIMD instruction, instead of going through
+ * raylib's LoadImageColors() copy. They reproduce raylib's arithmetic exactly, so results are byte-identical
+ * to the matching raylib Image functions.
+ */
+namespace pixels {
+namespace detail {
+/**
+ * The pixel as a 32-bit value, in memory byte order.
+ */
+inline std::uint32_t Pack(::Color color) {
+    std::uint32_t value;
+    std::memcpy(&value, &color, sizeof(value));
+    return value;
+}
+
+inline unsigned char Tint(unsigned char channel, float factor) {
+    return static_cast<unsigned char>(((static_cast<float>(channel) / 255 * factor) * 255.0f));
+}
+
+inline unsigned char Brighten(unsigned char channel, int brightness) {
+    int value = channel + brightness;
+    // Matches raylib, which clamps negative results to 1.
+    if (value < 0) {
+        value = 1;
+    }
+    if (value > 255) {
+        value = 255;
+    }
+    return static_cast<unsigned char>(value);
+}
+
+#if defined(RAYLIB_CPP_SIMD_INT)
+/**
+ * Number of pixels in one integer SIMD register.
+ */
+constexpr std::size_t step = simd::intBytes / sizeof(::Color);
+
+/**
+ * Run `kernel` on each full register of pixels, and return how many pixels were processed.
+ */
+template<typename F>
+std::size_t ForEachRegister(std::span<::Color> pixels, F kernel) {
+    auto* const bytes = reinterpret_cast<unsigned char*>(pixels.data());
+    std::size_t i = 0;
+    for (; i + step <= pixels.size(); i += step) {
+        simd::StoreInt(bytes + i * sizeof(::Color), kernel(simd::LoadInt(bytes + i * sizeof(::Color))));
+    }
+    return i;
+}
+#endif
+} // namespace detail
+
+/**
+ * Whether the kernels can work directly on the image's data: a single R8G8B8A8 level.
+ */
+inline bool IsSupported(const ::Image& image) {
+    return image.data != nullptr && image.width > 0 && image.height > 0 && image.mipmaps == 1 &&
+           image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
+
+/**
+ * The image's pixels. Only valid when IsSupported() is true.
+ */
+inline std::span<::Color> GetSpan(::Image& image) {
+    return {
+        static_cast<::Color*>(image.data),
+        static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height)};
+}
+
+/**
+ * Modify pixel colors: tint
+ */
+inline void ColorTint(std::span<::Color> pixels, ::Color color) {
+    const float cR = static_cast<float>(color.r) / 255;
+    const float cG = static_cast<float>(color.g) / 255;
+    const float cB = static_cast<float>(color.b) / 255;
+    const float cA = static_cast<float>(color.a) / 255;
+
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    const simd::floatv factor = simd::SetRGBA(cR, cG, cB, cA);
+    const simd::floatv max = simd::Set(255.0f);
+    i = detail::ForEachRegister(pixels, [&](simd::intv value) {
+        simd::floatv channels[4];
+        simd::PixelsToFloats(value, channels);
+        for (simd::floatv& channel : channels) {
+            channel = simd::Mul(simd::Mul(simd::Div(channel, max), factor), max);
+        }
+        return simd::FloatsToPixels(channels);
+    });
+#endif
+    for (; i < pixels.size(); i++) {
+        pixels[i].r = detail::Tint(pixels[i].r, cR);
+        pixels[i].g = detail::Tint(pixels[i].g, cG);
+        pixels[i].b = detail::Tint(pixels[i].b, cB);
+        pixels[i].a = detail::Tint(pixels[i].a, cA);
+    }
+}
+
+/**
+ * Modify pixel colors: invert
+ */
+inline void ColorInvert(std::span<::Color> pixels) {
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    // 255 - x is x ^ 255 for a byte. Alpha is left alone.
+    const simd::intv mask = simd::SetInt(detail::Pack({255, 255, 255, 0}));
+    i = detail::ForEachRegister(pixels, [&](simd::intv value) { return simd::BitXor(value, mask); });
+#endif
+    for (; i < pixels.size(); i++) {
+        pixels[i].r = static_cast<unsigned char>(255 - pixels[i].r);
+        pixels[i].g = static_cast<unsigned char>(255 - pixels[i].g);
+        pixels[i].b = static_cast<unsigned char>(255 - pixels[i].b);
+    }
+}
+
+/**
+ * Modify pixel colors: replace color
+ */
+inline void ColorReplace(std::span<::Color> pixels, ::Color color, ::Color replace) {
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    const simd::intv match = simd::SetInt(detail::Pack(color));
+    const simd::intv replacement = simd::SetInt(detail::Pack(replace));
+    i = detail::ForEachRegister(pixels, [&](simd::intv value) {
+        return simd::BitSelect(simd::Equal32(value, match), replacement, value);
+    });
+#endif
+    for (; i < pixels.size(); i++) {
+        if (pixels[i].r == color.r && pixels[i].g == color.g && pixels[i].b == color.b && pixels[i].a == color.a) {
+            pixels[i] = replace;
+        }
+    }
+}
+
+/**
+ * Modify pixel colors: brightness
+ *
+ * @param brightness Brightness values between -255 and 255
+ */
+inline void ColorBrightness(std::span<::Color> pixels, int brightness) {
+    if (brightness < -255) {
+        brightness = -255;
+    }
+    if (brightness > 255) {
+        brightness = 255;
+    }
+
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    const auto amount = static_cast<unsigned char>(brightness < 0 ? -brightness : brightness);
+    const simd::intv delta = simd::SetInt(detail::Pack({amount, amount, amount, 0}));
+    if (brightness >= 0) {
+        i = detail::ForEachRegister(pixels, [&](simd::intv value) { return simd::AddSaturate8(value, delta); });
+    } else {
+        // Channels that would go below zero become 1, as in raylib: those where value <= amount - 1.
+        const auto below = static_cast<unsigned char>(amount - 1);
+        const simd::intv limit = simd::SetInt(detail::Pack({below, below, below, 0}));
+        const simd::intv rgb = simd::SetInt(detail::Pack({255, 255, 255, 0}));
+        const simd::intv one = simd::SetInt(detail::Pack({1, 1, 1, 0}));
+        i = detail::ForEachRegister(pixels, [&](simd::intv value) {
+            const simd::intv negative = simd::BitAnd(simd::Equal8(simd::Min8(value, limit), value), rgb);
+            return simd::BitSelect(negative, one, simd::SubSaturate8(value, delta));
+        });
+    }
+#endif
+    for (; i < pixels.size(); i++) {
+        pixels[i].r = detail::Brighten(pixels[i].r, brightness);
+        pixels[i].g = detail::Brighten(pixels[i].g, brightness);
+        pixels[i].b = detail::Brighten(pixels[i].b, brightness);
+    }
+}
+
+/**
+ * Premultiply alpha channel
+ */
+inline void AlphaPremultiply(std::span<::Color> pixels) {
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    // Alpha 0 and 255 need no special case here: multiplying by 0.0f or 1.0f gives the same bytes.
+    const simd::floatv max = simd::Set(255.0f);
+    const simd::floatv alphaLanes = simd::Greater(simd::SetRGBA(0.0f, 0.0f, 0.0f, 1.0f), simd::Set(0.0f));
+    i = detail::ForEachRegister(pixels, [&](simd::intv value) {
+        simd::floatv channels[4];
+        simd::PixelsToFloats(value, channels);
+        for (simd::floatv& channel : channels) {
+            const simd::floatv alpha = simd::Div(simd::BroadcastAlpha(channel), max);
+            channel = simd::Select(alphaLanes, channel, simd::Mul(channel, alpha));
+        }
+        return simd::FloatsToPixels(channels);
+    });
+#endif
+    for (; i < pixels.size(); i++) {
+        if (pixels[i].a == 0) {
+            pixels[i].r = 0;
+            pixels[i].g = 0;
+            pixels[i].b = 0;
+        } else if (pixels[i].a < 255) {
+            const float alpha = static_cast<float>(pixels[i].a) / 255.0f;
+            pixels[i].r = static_cast<unsigned char>(static_cast<float>(pixels[i].r) * alpha);
+            pixels[i].g = static_cast<unsigned char>(static_cast<float>(pixels[i].g) * alpha);
+            pixels[i].b = static_cast<unsigned char>(static_cast<float>(pixels[i].b) * alpha);
+        }
+    }
+}
+
+/**
+ * Clear alpha channel to desired color
+ *
+ * @param threshold Pixels with an alpha at or below threshold * 255 are replaced by `color`.
+ */
+inline void AlphaClear(std::span<::Color> pixels, ::Color color, float threshold) {
+    const auto thresholdValue = static_cast<unsigned char>(threshold * 255.0f);
+
+    std::size_t i = 0;
+#if defined(RAYLIB_CPP_SIMD_INT)
+    const simd::intv clear = simd::SetInt(detail::Pack(color));
+    const simd::intv limit = simd::SetInt(thresholdValue);
+    i = detail::ForEachRegister(pixels, [&](simd::intv value) {
+        // Alpha is the top byte of each little-endian pixel.
+        return simd::BitSelect(simd::Greater32(simd::ShiftRight32<24>(value), limit), value, clear);
+    });
+#endif
+    for (; i < pixels.size(); i++) {
+        if (pixels[i].a <= thresholdValue) {
+            pixels[i] = color;
+        }
+    }
+}
+} // namespace pixels
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_PIXELKERNELS_HPP_
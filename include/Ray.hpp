@@ -1,6 +1,7 @@
 #ifndef RAYLIB_CPP_INCLUDE_RAY_HPP_
 #define RAYLIB_CPP_INCLUDE_RAY_HPP_
 
+#include "./MeshBVH.hpp"
 #include "./RayCollision.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
@@ -52,6 +53,18 @@ public:
         return ::GetRayCollisionMesh(*this, mesh, transform);
     }
 
+    /**
+     * Get the closest collision between ray and a mesh hierarchy
+     */
+    RayCollision GetCollision(const MeshBVH& bvh) const { return bvh.GetCollision(*this); }
+
+    /**
+     * Get the closest collision between ray and a mesh hierarchy moved by a transform
+     */
+    RayCollision GetCollision(const MeshBVH& bvh, const ::Matrix& transform) const {
+        return bvh.GetCollision(*this, transform);
+    }
+
     /**
      * Get collision info between ray and triangle
      */
@@ -0,0 +1,647 @@
+#ifndef RAYLIB_CPP_INCLUDE_RAYKERNELS_HPP_
+#define RAYLIB_CPP_INCLUDE_RAYKERNELS_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "./RaylibException.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Ray queries over arrays of rays, several rays per SIMD instruction.
+ *
+ * Rays are tested against boxes, spheres and triangles with the same arithmetic as GetRayCollisionBox(),
+ * GetRayCollisionSphere() and GetRayCollisionTriangle(), so hits have the same distance, point and normal. Misses
+ * are written as a zeroed RayCollision. Every function also has an overload that splits the rays into chunks on a
+ * ThreadPool.
+ *
+ * - GetCollisions() tests each ray against the primitive at the same index.
+ * - GetClosestCollisions() tests each ray against every primitive, for picking.
+ * - GetAnyCollisions() stops at the first primitive each ray hits, for line of sight. With a ray from an eye
+ *   towards `target - eye` and a maximum distance of 1, only primitives between the two points count.
+ *
+ * @see raylib-cpp-simd.hpp for the instruction set in use.
+ */
+namespace rays {
+/**
+ * A sphere to cast rays at.
+ */
+struct Sphere {
+    ::Vector3 center;
+    float radius;
+};
+
+/**
+ * A triangle to cast rays at, with the corners in the order GetRayCollisionTriangle() takes them.
+ */
+struct Triangle {
+    ::Vector3 p1;
+    ::Vector3 p2;
+    ::Vector3 p3;
+};
+
+namespace detail {
+using simd::floatv;
+using simd::Gather;
+using simd::Registers;
+
+constexpr std::size_t lanes = simd::width;
+
+/** Primitive indices are kept in float lanes, which hold integers exactly up to 2^24 */
+constexpr std::size_t maxPrimitives = std::size_t{1} << 24;
+
+inline void CheckSize(std::size_t expected, std::size_t actual) {
+    if (expected != actual) {
+        throw RaylibException("Ray batch input and output sizes do not match");
+    }
+}
+
+inline void CheckCount(std::size_t count) {
+    if (count > maxPrimitives) {
+        throw RaylibException("Ray batches test at most 2^24 primitives");
+    }
+}
+
+inline floatv AllLanes() { return simd::Greater(simd::Set(1.0f), simd::Set(0.0f)); }
+
+/**
+ * `lanes` rays, one component per register.
+ */
+struct RayLanes {
+    floatv px, py, pz;
+    floatv dx, dy, dz;
+};
+
+inline RayLanes GatherRays(const ::Ray* rays, std::size_t count) {
+    const auto v = Gather<6>(rays, count, [](const ::Ray& ray) {
+        return std::array<float, 6>{
+            ray.position.x,
+            ray.position.y,
+            ray.position.z,
+            ray.direction.x,
+            ray.direction.y,
+            ray.direction.z};
+    });
+    return {v[0], v[1], v[2], v[3], v[4], v[5]};
+}
+
+inline ::Vector3 PointAt(const ::Ray& ray, float distance) {
+    return {
+        ray.position.x + ray.direction.x * distance,
+        ray.position.y + ray.direction.y * distance,
+        ray.position.z + ray.direction.z * distance};
+}
+
+inline ::Vector3 Normalize(::Vector3 v) {
+    const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+    if (length != 0.0f) {
+        const float inverse = 1.0f / length;
+        v = {v.x * inverse, v.y * inverse, v.z * inverse};
+    }
+    return v;
+}
+
+/**
+ * How to test each kind of primitive: its components, the SIMD hit test, which returns a mask of the lanes that hit
+ * and their distance, and the rest of raylib's result for a hit, done once per hit.
+ */
+template<typename P>
+struct Shape;
+
+template<>
+struct Shape<::BoundingBox> {
+    static constexpr std::size_t size = 6;
+
+    static std::array<float, size> Components(const ::BoundingBox& box) {
+        return {box.min.x, box.min.y, box.min.z, box.max.x, box.max.y, box.max.z};
+    }
+
+    /**
+     * Slabs, after reversing rays that start inside the box, like GetRayCollisionBox().
+     */
+    static floatv Test(const Registers<size>& b, const RayLanes& r, floatv& distance) {
+        const floatv zero = simd::Set(0.0f);
+        const floatv one = simd::Set(1.0f);
+        const floatv minusOne = simd::Set(-1.0f);
+        const floatv inside = simd::And(
+            simd::And(
+                simd::And(simd::Greater(r.px, b[0]), simd::Greater(b[3], r.px)),
+                simd::And(simd::Greater(r.py, b[1]), simd::Greater(b[4], r.py))),
+            simd::And(simd::Greater(r.pz, b[2]), simd::Greater(b[5], r.pz)));
+        const floatv ix = simd::Div(one, simd::Select(inside, simd::Mul(r.dx, minusOne), r.dx));
+        const floatv iy = simd::Div(one, simd::Select(inside, simd::Mul(r.dy, minusOne), r.dy));
+        const floatv iz = simd::Div(one, simd::Select(inside, simd::Mul(r.dz, minusOne), r.dz));
+        const floatv t0 = simd::Mul(simd::Sub(b[0], r.px), ix);
+        const floatv t1 = simd::Mul(simd::Sub(b[3], r.px), ix);
+        const floatv t2 = simd::Mul(simd::Sub(b[1], r.py), iy);
+        const floatv t3 = simd::Mul(simd::Sub(b[4], r.py), iy);
+        const floatv t4 = simd::Mul(simd::Sub(b[2], r.pz), iz);
+        const floatv t5 = simd::Mul(simd::Sub(b[5], r.pz), iz);
+        // A ray parallel to a slab, starting on one of its planes, gives 0 * inf = NaN, which fmin() and fmax() skip.
+        const floatv enter = simd::MaxNumber(
+            simd::MaxNumber(simd::MinNumber(t0, t1), simd::MinNumber(t2, t3)),
+            simd::MinNumber(t4, t5));
+        const floatv exit = simd::MinNumber(
+            simd::MinNumber(simd::MaxNumber(t0, t1), simd::MaxNumber(t2, t3)),
+            simd::MaxNumber(t4, t5));
+        distance = simd::Select(inside, simd::Mul(enter, minusOne), enter);
+        return simd::AndNot(AllLanes(), simd::Or(simd::Greater(zero, exit), simd::Greater(enter, exit)));
+    }
+
+    static ::RayCollision Finish(const ::Ray& ray, const ::BoundingBox& box, float distance) {
+        const bool inside = ray.position.x > box.min.x && ray.position.x < box.max.x &&
+                            ray.position.y > box.min.y && ray.position.y < box.max.y &&
+                            ray.position.z > box.min.z && ray.position.z < box.max.z;
+        const ::Vector3 point = PointAt(ray, distance);
+
+        // The offset from the center, scaled a little past the unit cube, truncates to the face normal.
+        const ::Vector3 size{box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z};
+        const ::Vector3 center{box.min.x + 0.5f * size.x, box.min.y + 0.5f * size.y, box.min.z + 0.5f * size.z};
+        ::Vector3 normal{
+            static_cast<float>(static_cast<int>((point.x - center.x) * 2.01f / size.x)),
+            static_cast<float>(static_cast<int>((point.y - center.y) * 2.01f / size.y)),
+            static_cast<float>(static_cast<int>((point.z - center.z) * 2.01f / size.z))};
+        normal = Normalize(normal);
+        if (inside) {
+            normal = {-normal.x, -normal.y, -normal.z};
+        }
+        return {true, distance, point, normal};
+    }
+};
+
+template<>
+struct Shape<Sphere> {
+    static constexpr std::size_t size = 4;
+
+    static std::array<float, size> Components(const Sphere& sphere) {
+        return {sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius};
+    }
+
+    /**
+     * Like GetRayCollisionSphere(), spheres behind the ray count as hits, at a negative distance.
+     */
+    static floatv Test(const Registers<size>& s, const RayLanes& r, floatv& distance) {
+        const floatv x = simd::Sub(s[0], r.px);
+        const floatv y = simd::Sub(s[1], r.py);
+        const floatv z = simd::Sub(s[2], r.pz);
+        const floatv along = simd::Add(simd::Add(simd::Mul(x, r.dx), simd::Mul(y, r.dy)), simd::Mul(z, r.dz));
+        const floatv length = simd::Sqrt(simd::Add(simd::Add(simd::Mul(x, x), simd::Mul(y, y)), simd::Mul(z, z)));
+        const floatv d =
+            simd::Sub(simd::Mul(s[3], s[3]), simd::Sub(simd::Mul(length, length), simd::Mul(along, along)));
+        const floatv root = simd::Sqrt(d);
+        distance = simd::Select(simd::Greater(s[3], length), simd::Add(along, root), simd::Sub(along, root));
+        return simd::AndNot(AllLanes(), simd::Greater(simd::Set(0.0f), d));
+    }
+
+    static ::RayCollision Finish(const ::Ray& ray, const Sphere& sphere, float distance) {
+        const ::Vector3 offset{
+            sphere.center.x - ray.position.x,
+            sphere.center.y - ray.position.y,
+            sphere.center.z - ray.position.z};
+        const bool inside = std::sqrt(offset.x * offset.x + offset.y * offset.y + offset.z * offset.z) < sphere.radius;
+        const ::Vector3 point = PointAt(ray, distance);
+        ::Vector3 normal = Normalize({point.x - sphere.center.x, point.y - sphere.center.y, point.z - sphere.center.z});
+        if (inside) {
+            normal = {-normal.x, -normal.y, -normal.z};
+        }
+        return {true, distance, point, normal};
+    }
+};
+
+template<>
+struct Shape<Triangle> {
+    static constexpr std::size_t size = 9;
+
+    /**
+     * The first corner and the edges to the other two.
+     */
+    static std::array<float, size> Components(const Triangle& triangle) {
+        return {
+            triangle.p1.x,
+            triangle.p1.y,
+            triangle.p1.z,
+            triangle.p2.x - triangle.p1.x,
+            triangle.p2.y - triangle.p1.y,
+            triangle.p2.z - triangle.p1.z,
+            triangle.p3.x - triangle.p1.x,
+            triangle.p3.y - triangle.p1.y,
+            triangle.p3.z - triangle.p1.z};
+    }
+
+    /**
+     * The Möller-Trumbore test of GetRayCollisionTriangle().
+     */
+    static floatv Test(const Registers<size>& t, const RayLanes& r, floatv& distance) {
+        const floatv zero = simd::Set(0.0f);
+        const floatv one = simd::Set(1.0f);
+        const floatv epsilon = simd::Set(0.000001f);
+        const floatv minusEpsilon = simd::Set(-0.000001f);
+
+        const floatv px = simd::Sub(simd::Mul(r.dy, t[8]), simd::Mul(r.dz, t[7]));
+        const floatv py = simd::Sub(simd::Mul(r.dz, t[6]), simd::Mul(r.dx, t[8]));
+        const floatv pz = simd::Sub(simd::Mul(r.dx, t[7]), simd::Mul(r.dy, t[6]));
+        const floatv det = simd::Add(simd::Add(simd::Mul(t[3], px), simd::Mul(t[4], py)), simd::Mul(t[5], pz));
+        const floatv invDet = simd::Div(one, det);
+
+        const floatv tx = simd::Sub(r.px, t[0]);
+        const floatv ty = simd::Sub(r.py, t[1]);
+        const floatv tz = simd::Sub(r.pz, t[2]);
+        const floatv u =
+            simd::Mul(simd::Add(simd::Add(simd::Mul(tx, px), simd::Mul(ty, py)), simd::Mul(tz, pz)), invDet);
+
+        const floatv qx = simd::Sub(simd::Mul(ty, t[5]), simd::Mul(tz, t[4]));
+        const floatv qy = simd::Sub(simd::Mul(tz, t[3]), simd::Mul(tx, t[5]));
+        const floatv qz = simd::Sub(simd::Mul(tx, t[4]), simd::Mul(ty, t[3]));
+        const floatv v =
+            simd::Mul(simd::Add(simd::Add(simd::Mul(r.dx, qx), simd::Mul(r.dy, qy)), simd::Mul(r.dz, qz)), invDet);
+        distance =
+            simd::Mul(simd::Add(simd::Add(simd::Mul(t[6], qx), simd::Mul(t[7], qy)), simd::Mul(t[8], qz)), invDet);
+
+        const floatv parallel = simd::And(simd::Greater(det, minusEpsilon), simd::Greater(epsilon, det));
+        const floatv outside = simd::Or(
+            simd::Or(simd::Greater(zero, u), simd::Greater(u, one)),
+            simd::Or(simd::Greater(zero, v), simd::Greater(simd::Add(u, v), one)));
+        return simd::AndNot(simd::Greater(distance, epsilon), simd::Or(parallel, outside));
+    }
+
+    static ::RayCollision Finish(const ::Ray& ray, const Triangle& triangle, float distance) {
+        const ::Vector3 edge1{
+            triangle.p2.x - triangle.p1.x,
+            triangle.p2.y - triangle.p1.y,
+            triangle.p2.z - triangle.p1.z};
+        const ::Vector3 edge2{
+            triangle.p3.x - triangle.p1.x,
+            triangle.p3.y - triangle.p1.y,
+            triangle.p3.z - triangle.p1.z};
+        const ::Vector3 normal{
+            edge1.y * edge2.z - edge1.z * edge2.y,
+            edge1.z * edge2.x - edge1.x * edge2.z,
+            edge1.x * edge2.y - edge1.y * edge2.x};
+        return {true, distance, PointAt(ray, distance), Normalize(normal)};
+    }
+};
+
+template<typename P>
+Registers<Shape<P>::size> Broadcast(const P& primitive) {
+    const std::array<float, Shape<P>::size> components = Shape<P>::Components(primitive);
+    Registers<Shape<P>::size> result;
+    for (std::size_t k = 0; k < Shape<P>::size; k++) {
+        result[k] = simd::Set(components[k]);
+    }
+    return result;
+}
+
+/**
+ * Rays [begin, end) against the primitives at the same indices.
+ */
+template<typename P>
+void Collisions(
+    std::span<const ::Ray> rays,
+    std::span<const P> primitives,
+    std::span<::RayCollision> out,
+    std::size_t begin,
+    std::size_t end) {
+    alignas(32) float distances[lanes];
+    for (std::size_t i = begin; i < end; i += lanes) {
+        const std::size_t count = std::min(lanes, end - i);
+        const RayLanes r = GatherRays(rays.data() + i, count);
+        const auto p = Gather<Shape<P>::size>(primitives.data() + i, count, Shape<P>::Components);
+        floatv distance;
+        const unsigned int hits = simd::MoveMask(Shape<P>::Test(p, r, distance));
+        simd::Store(distances, distance);
+        for (std::size_t lane = 0; lane < count; lane++) {
+            out[i + lane] = ((hits >> lane) & 1u) != 0
+                                ? Shape<P>::Finish(rays[i + lane], primitives[i + lane], distances[lane])
+                                : ::RayCollision{};
+        }
+    }
+}
+
+/**
+ * Rays [begin, end) against every primitive. With `any`, each ray stops at its first hit.
+ */
+template<typename P, bool Any>
+void Search(
+    std::span<const ::Ray> rays,
+    std::span<const P> primitives,
+    std::span<::RayCollision> out,
+    std::span<int> indices,
+    float maxDistance,
+    std::size_t begin,
+    std::size_t end) {
+    const floatv zero = simd::Set(0.0f);
+    const floatv limit = simd::Set(maxDistance);
+    alignas(32) float distances[lanes];
+    alignas(32) float found[lanes];
+    for (std::size_t i = begin; i < end; i += lanes) {
+        const std::size_t count = std::min(lanes, end - i);
+        const RayLanes r = GatherRays(rays.data() + i, count);
+        floatv best = limit;
+        floatv index = simd::Set(-1.0f);
+        floatv done = simd::AndNot(AllLanes(), AllLanes());
+        for (std::size_t j = 0; j < primitives.size(); j++) {
+            floatv distance;
+            const floatv hit = Shape<P>::Test(Broadcast(primitives[j]), r, distance);
+            // The first of equally close hits wins, like in raylib. Hits behind the ray don't count.
+            const floatv closer = simd::AndNot(
+                simd::And(hit, simd::Greater(best, distance)),
+                simd::Or(simd::Greater(zero, distance), done));
+            best = simd::Select(closer, distance, best);
+            index = simd::Select(closer, simd::Set(static_cast<float>(j)), index);
+            if constexpr (Any) {
+                done = simd::Or(done, closer);
+                if (simd::MoveMask(done) == (1u << lanes) - 1) {
+                    break;
+                }
+            }
+        }
+
+        simd::Store(distances, best);
+        simd::Store(found, index);
+        for (std::size_t lane = 0; lane < count; lane++) {
+            const int primitive = static_cast<int>(found[lane]);
+            if (!indices.empty()) {
+                indices[i + lane] = primitive;
+            }
+            if (!out.empty()) {
+                out[i + lane] = primitive < 0 ? ::RayCollision{}
+                                              : Shape<P>::Finish(
+                                                    rays[i + lane],
+                                                    primitives[static_cast<std::size_t>(primitive)],
+                                                    distances[lane]);
+            }
+        }
+    }
+}
+
+/**
+ * Run `kernel(begin, end)` over the rays, on a pool when there is one.
+ */
+template<typename F>
+void ForEachChunk(std::size_t count, ThreadPool* pool, std::size_t grain, F kernel) {
+    if (pool == nullptr) {
+        kernel(std::size_t{0}, count);
+        return;
+    }
+    // Chunks of whole registers, so only the last one has unused lanes.
+    grain = std::max(lanes, grain / lanes * lanes);
+    pool->ParallelFor(0, count, grain, kernel);
+}
+
+template<typename P>
+void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const P> primitives,
+    std::span<::RayCollision> out,
+    ThreadPool* pool,
+    std::size_t grain) {
+    CheckSize(rays.size(), primitives.size());
+    CheckSize(rays.size(), out.size());
+    ForEachChunk(rays.size(), pool, grain, [&](std::size_t begin, std::size_t end) {
+        Collisions<P>(rays, primitives, out, begin, end);
+    });
+}
+
+template<typename P, bool Any>
+void Search(
+    std::span<const ::Ray> rays,
+    std::span<const P> primitives,
+    std::span<::RayCollision> out,
+    std::span<int> indices,
+    float maxDistance,
+    ThreadPool* pool,
+    std::size_t grain) {
+    if (!out.empty()) {
+        CheckSize(rays.size(), out.size());
+    }
+    if (!indices.empty()) {
+        CheckSize(rays.size(), indices.size());
+    }
+    CheckCount(primitives.size());
+    ForEachChunk(rays.size(), pool, grain, [&](std::size_t begin, std::size_t end) {
+        Search<P, Any>(rays, primitives, out, indices, maxDistance, begin, end);
+    });
+}
+} // namespace detail
+
+/** Rays per chunk in the ThreadPool overloads */
+constexpr std::size_t defaultGrain = 1024;
+constexpr float noLimit = std::numeric_limits<float>::infinity();
+
+/**
+ * Get the collision of each ray with the box at the same index.
+ *
+ * @throws raylib::RaylibException Thrown if the spans have different sizes.
+ */
+inline void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<::RayCollision> out) {
+    detail::GetCollisions(rays, boxes, out, nullptr, 0);
+}
+
+inline void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<::RayCollision> out,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::GetCollisions(rays, boxes, out, &pool, grain);
+}
+
+/**
+ * Get the collision of each ray with the sphere at the same index.
+ *
+ * @throws raylib::RaylibException Thrown if the spans have different sizes.
+ */
+inline void GetCollisions(std::span<const ::Ray> rays, std::span<const Sphere> spheres, std::span<::RayCollision> out) {
+    detail::GetCollisions(rays, spheres, out, nullptr, 0);
+}
+
+inline void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Sphere> spheres,
+    std::span<::RayCollision> out,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::GetCollisions(rays, spheres, out, &pool, grain);
+}
+
+/**
+ * Get the collision of each ray with the triangle at the same index.
+ *
+ * @throws raylib::RaylibException Thrown if the spans have different sizes.
+ */
+inline void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<::RayCollision> out) {
+    detail::GetCollisions(rays, triangles, out, nullptr, 0);
+}
+
+inline void GetCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<::RayCollision> out,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::GetCollisions(rays, triangles, out, &pool, grain);
+}
+
+/**
+ * Get the closest box each ray hits, in front of it and closer than `maxDistance`, and optionally its index, or -1.
+ *
+ * @throws raylib::RaylibException Thrown if an output has a different size than the rays.
+ */
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<::RayCollision> out,
+    std::span<int> indices = {},
+    float maxDistance = noLimit) {
+    detail::Search<::BoundingBox, false>(rays, boxes, out, indices, maxDistance, nullptr, 0);
+}
+
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<::RayCollision> out,
+    std::span<int> indices,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<::BoundingBox, false>(rays, boxes, out, indices, maxDistance, &pool, grain);
+}
+
+/**
+ * Get the closest sphere each ray hits, in front of it and closer than `maxDistance`, and optionally its index, or
+ * -1.
+ *
+ * @throws raylib::RaylibException Thrown if an output has a different size than the rays.
+ */
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Sphere> spheres,
+    std::span<::RayCollision> out,
+    std::span<int> indices = {},
+    float maxDistance = noLimit) {
+    detail::Search<Sphere, false>(rays, spheres, out, indices, maxDistance, nullptr, 0);
+}
+
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Sphere> spheres,
+    std::span<::RayCollision> out,
+    std::span<int> indices,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<Sphere, false>(rays, spheres, out, indices, maxDistance, &pool, grain);
+}
+
+/**
+ * Get the closest triangle each ray hits, closer than `maxDistance`, and optionally its index, or -1.
+ *
+ * @throws raylib::RaylibException Thrown if an output has a different size than the rays.
+ */
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<::RayCollision> out,
+    std::span<int> indices = {},
+    float maxDistance = noLimit) {
+    detail::Search<Triangle, false>(rays, triangles, out, indices, maxDistance, nullptr, 0);
+}
+
+inline void GetClosestCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<::RayCollision> out,
+    std::span<int> indices,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<Triangle, false>(rays, triangles, out, indices, maxDistance, &pool, grain);
+}
+
+/**
+ * Get the index of a box each ray hits in front of it and closer than `maxDistance`, not necessarily the closest
+ * one, or -1.
+ *
+ * @throws raylib::RaylibException Thrown if the output has a different size than the rays.
+ */
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<int> out,
+    float maxDistance = noLimit) {
+    detail::Search<::BoundingBox, true>(rays, boxes, {}, out, maxDistance, nullptr, 0);
+}
+
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const ::BoundingBox> boxes,
+    std::span<int> out,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<::BoundingBox, true>(rays, boxes, {}, out, maxDistance, &pool, grain);
+}
+
+/**
+ * Get the index of a sphere each ray hits in front of it and closer than `maxDistance`, not necessarily the closest
+ * one, or -1.
+ *
+ * @throws raylib::RaylibException Thrown if the output has a different size than the rays.
+ */
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Sphere> spheres,
+    std::span<int> out,
+    float maxDistance = noLimit) {
+    detail::Search<Sphere, true>(rays, spheres, {}, out, maxDistance, nullptr, 0);
+}
+
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Sphere> spheres,
+    std::span<int> out,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<Sphere, true>(rays, spheres, {}, out, maxDistance, &pool, grain);
+}
+
+/**
+ * Get the index of a triangle each ray hits closer than `maxDistance`, not necessarily the closest one, or -1.
+ *
+ * @throws raylib::RaylibException Thrown if the output has a different size than the rays.
+ */
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<int> out,
+    float maxDistance = noLimit) {
+    detail::Search<Triangle, true>(rays, triangles, {}, out, maxDistance, nullptr, 0);
+}
+
+inline void GetAnyCollisions(
+    std::span<const ::Ray> rays,
+    std::span<const Triangle> triangles,
+    std::span<int> out,
+    float maxDistance,
+    ThreadPool& pool,
+    std::size_t grain = defaultGrain) {
+    detail::Search<Triangle, true>(rays, triangles, {}, out, maxDistance, &pool, grain);
+}
+} // namespace rays
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_RAYKERNELS_HPP_
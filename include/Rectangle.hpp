@@ -11,31 +11,37 @@ namespace raylib {
  */
 class Rectangle : public ::Rectangle {
 public:
-    Rectangle(const ::Rectangle& rect) : ::Rectangle{rect.x, rect.y, rect.width, rect.height} {}
+    constexpr Rectangle(const ::Rectangle& rect) : ::Rectangle{rect.x, rect.y, rect.width, rect.height} {}
 
-    Rectangle(float x, float y, float width, float height) : ::Rectangle{x, y, width, height} {}
-    Rectangle(float x, float y, float width) : ::Rectangle{x, y, width, 0} {}
-    Rectangle(float x, float y) : ::Rectangle{x, y, 0, 0} {}
-    Rectangle(float x) : ::Rectangle{x, 0, 0, 0} {}
-    Rectangle() : ::Rectangle{0, 0, 0, 0} {}
+    constexpr Rectangle(float x, float y, float width, float height) : ::Rectangle{x, y, width, height} {}
+    constexpr Rectangle(float x, float y, float width) : ::Rectangle{x, y, width, 0} {}
+    constexpr Rectangle(float x, float y) : ::Rectangle{x, y, 0, 0} {}
+    constexpr Rectangle(float x) : ::Rectangle{x, 0, 0, 0} {}
+    constexpr Rectangle() : ::Rectangle{0, 0, 0, 0} {}
 
-    Rectangle(::Vector2 position, ::Vector2 size) : ::Rectangle{position.x, position.y, size.x, size.y} {}
-    Rectangle(::Vector2 size) : ::Rectangle{0, 0, size.x, size.y} {}
-    Rectangle(::Vector4 rect) : ::Rectangle{rect.x, rect.y, rect.z, rect.w} {}
+    constexpr Rectangle(::Vector2 position, ::Vector2 size) : ::Rectangle{position.x, position.y, size.x, size.y} {}
+    constexpr Rectangle(::Vector2 size) : ::Rectangle{0, 0, size.x, size.y} {}
+    constexpr Rectangle(::Vector4 rect) : ::Rectangle{rect.x, rect.y, rect.z, rect.w} {}
 
     GETTERSETTER(float, X, x)
     GETTERSETTER(float, Y, y)
     GETTERSETTER(float, Width, width)
     GETTERSETTER(float, Height, height)
 
-    Rectangle& operator=(const ::Rectangle& rect) {
+    constexpr Rectangle& operator=(const ::Rectangle& rect) {
         set(rect);
         return *this;
     }
 
-    ::Vector4 ToVector4() { return {x, y, width, height}; }
+    constexpr bool operator==(const ::Rectangle& other) const {
+        return x == other.x && y == other.y && width == other.width && height == other.height;
+    }
+
+    constexpr bool operator!=(const ::Rectangle& other) const { return !(*this == other); }
+
+    constexpr ::Vector4 ToVector4() const { return {x, y, width, height}; }
 
-    explicit operator ::Vector4() const { return {x, y, width, height}; }
+    constexpr explicit operator ::Vector4() const { return {x, y, width, height}; }
 
     /**
      * Draw a color-filled rectangle
@@ -96,7 +102,10 @@ public:
     /**
      * Check collision between two rectangles
      */
-    [[nodiscard]] bool CheckCollision(::Rectangle rec2) const { return ::CheckCollisionRecs(*this, rec2); }
+    [[nodiscard]] constexpr bool CheckCollision(::Rectangle rec2) const {
+        return (x < (rec2.x + rec2.width) && (x + width) > rec2.x) &&
+               (y < (rec2.y + rec2.height) && (y + height) > rec2.y);
+    }
 
     /**
      * Get collision rectangle for two rectangles collision
@@ -106,7 +115,9 @@ public:
     /**
      * Check if point is inside rectangle
      */
-    [[nodiscard]] bool CheckCollision(::Vector2 point) const { return ::CheckCollisionPointRec(point, *this); }
+    [[nodiscard]] constexpr bool CheckCollision(::Vector2 point) const {
+        return (point.x >= x) && (point.x < (x + width)) && (point.y >= y) && (point.y < (y + height));
+    }
 
     /**
      * Check collision between circle and rectangle
@@ -115,32 +126,32 @@ public:
         return ::CheckCollisionCircleRec(center, radius, *this);
     }
 
-    [[nodiscard]] Vector2 GetSize() const { return {width, height}; }
+    [[nodiscard]] constexpr Vector2 GetSize() const { return {width, height}; }
 
-    Rectangle& SetSize(float newWidth, float newHeight) {
+    constexpr Rectangle& SetSize(float newWidth, float newHeight) {
         width = newWidth;
         height = newHeight;
         return *this;
     }
 
-    Rectangle& SetSize(const ::Vector2& size) { return SetSize(size.x, size.y); }
+    constexpr Rectangle& SetSize(const ::Vector2& size) { return SetSize(size.x, size.y); }
 
     Rectangle& SetShapesTexture(const ::Texture2D& texture) {
         ::SetShapesTexture(texture, *this);
         return *this;
     }
 
-    [[nodiscard]] Vector2 GetPosition() const { return {x, y}; }
+    [[nodiscard]] constexpr Vector2 GetPosition() const { return {x, y}; }
 
-    Rectangle& SetPosition(float newX, float newY) {
+    constexpr Rectangle& SetPosition(float newX, float newY) {
         x = newX;
         y = newY;
         return *this;
     }
 
-    Rectangle& SetPosition(const ::Vector2& position) { return SetPosition(position.x, position.y); }
+    constexpr Rectangle& SetPosition(const ::Vector2& position) { return SetPosition(position.x, position.y); }
 protected:
-    void set(const ::Rectangle& rect) {
+    constexpr void set(const ::Rectangle& rect) {
         x = rect.x;
         y = rect.y;
         width = rect.width;
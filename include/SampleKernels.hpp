@@ -0,0 +1,378 @@
+#ifndef RAYLIB_CPP_INCLUDE_SAMPLEKERNELS_HPP_
+#define RAYLIB_CPP_INCLUDE_SAMPLEKERNELS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Conversion kernels for audio samples: between unsigned 8-bit, 16-bit and 32-bit float samples, between channel
+ * counts, and between sample rates.
+ *
+ * Floats are in [-1, 1]. 16-bit samples are scaled by 32768, and unsigned 8-bit samples are centered on 128 and
+ * scaled by 128. Converting to integers rounds to the nearest value and clamps to the range, so converting back and
+ * forth between the same formats gives the same samples.
+ */
+namespace samples {
+namespace detail {
+constexpr float ShortScale = 32768.0f;
+constexpr float ByteScale = 128.0f;
+
+/**
+ * Run `kernel` on each full register of samples, and return how many samples were processed.
+ */
+template<typename F>
+std::size_t ForEachRegister(std::size_t count, F kernel) {
+    std::size_t i = 0;
+    for (; i + simd::width <= count; i += simd::width) {
+        kernel(i);
+    }
+    return i;
+}
+
+inline float ClampShort(float value) { return std::min(std::max(value, -ShortScale), ShortScale - 1.0f); }
+inline float ClampByte(float value) { return std::min(std::max(value, 0.0f), 255.0f); }
+} // namespace detail
+
+/**
+ * Convert 16-bit samples to floats.
+ */
+inline void Int16ToFloat(std::span<const std::int16_t> in, std::span<float> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv scale = simd::Set(1.0f / detail::ShortScale);
+    std::size_t i = detail::ForEachRegister(
+        count, [&](std::size_t at) { simd::Store(&out[at], simd::Mul(simd::LoadShorts(&in[at]), scale)); });
+    for (; i < count; i++) {
+        out[i] = static_cast<float>(in[i]) * (1.0f / detail::ShortScale);
+    }
+}
+
+/**
+ * Convert floats to 16-bit samples.
+ */
+inline void FloatToInt16(std::span<const float> in, std::span<std::int16_t> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv scale = simd::Set(detail::ShortScale);
+    const simd::floatv low = simd::Set(-detail::ShortScale);
+    const simd::floatv high = simd::Set(detail::ShortScale - 1.0f);
+    std::size_t i = detail::ForEachRegister(count, [&](std::size_t at) {
+        simd::StoreShorts(&out[at], simd::Min(simd::Max(simd::Mul(simd::Load(&in[at]), scale), low), high));
+    });
+    for (; i < count; i++) {
+        out[i] = static_cast<std::int16_t>(std::lrint(detail::ClampShort(in[i] * detail::ShortScale)));
+    }
+}
+
+/**
+ * Convert unsigned 8-bit samples to floats.
+ */
+inline void Uint8ToFloat(std::span<const std::uint8_t> in, std::span<float> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv center = simd::Set(detail::ByteScale);
+    const simd::floatv scale = simd::Set(1.0f / detail::ByteScale);
+    std::size_t i = detail::ForEachRegister(count, [&](std::size_t at) {
+        simd::Store(&out[at], simd::Mul(simd::Sub(simd::LoadBytes(&in[at]), center), scale));
+    });
+    for (; i < count; i++) {
+        out[i] = (static_cast<float>(in[i]) - detail::ByteScale) * (1.0f / detail::ByteScale);
+    }
+}
+
+/**
+ * Convert floats to unsigned 8-bit samples.
+ */
+inline void FloatToUint8(std::span<const float> in, std::span<std::uint8_t> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv scale = simd::Set(detail::ByteScale);
+    const simd::floatv low = simd::Set(0.0f);
+    const simd::floatv high = simd::Set(255.0f);
+    std::size_t i = detail::ForEachRegister(count, [&](std::size_t at) {
+        const simd::floatv value = simd::Add(simd::Mul(simd::Load(&in[at]), scale), scale);
+        simd::StoreBytes(&out[at], simd::Min(simd::Max(value, low), high));
+    });
+    for (; i < count; i++) {
+        const float value = in[i] * detail::ByteScale + detail::ByteScale;
+        out[i] = static_cast<std::uint8_t>(std::lrint(detail::ClampByte(value)));
+    }
+}
+
+/**
+ * Convert 16-bit samples to unsigned 8-bit samples.
+ */
+inline void Int16ToUint8(std::span<const std::int16_t> in, std::span<std::uint8_t> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv scale = simd::Set(detail::ByteScale / detail::ShortScale);
+    const simd::floatv center = simd::Set(detail::ByteScale);
+    const simd::floatv high = simd::Set(255.0f);
+    std::size_t i = detail::ForEachRegister(count, [&](std::size_t at) {
+        const simd::floatv value = simd::Add(simd::Mul(simd::LoadShorts(&in[at]), scale), center);
+        simd::StoreBytes(&out[at], simd::Min(value, high));
+    });
+    for (; i < count; i++) {
+        const float value = static_cast<float>(in[i]) * (detail::ByteScale / detail::ShortScale) + detail::ByteScale;
+        out[i] = static_cast<std::uint8_t>(std::lrint(detail::ClampByte(value)));
+    }
+}
+
+/**
+ * Convert unsigned 8-bit samples to 16-bit samples.
+ */
+inline void Uint8ToInt16(std::span<const std::uint8_t> in, std::span<std::int16_t> out) {
+    const std::size_t count = std::min(in.size(), out.size());
+    const simd::floatv center = simd::Set(detail::ByteScale);
+    const simd::floatv scale = simd::Set(detail::ShortScale / detail::ByteScale);
+    std::size_t i = detail::ForEachRegister(count, [&](std::size_t at) {
+        simd::StoreShorts(&out[at], simd::Mul(simd::Sub(simd::LoadBytes(&in[at]), center), scale));
+    });
+    for (; i < count; i++) {
+        out[i] = static_cast<std::int16_t>((in[i] - 128) * 256);
+    }
+}
+
+/**
+ * Whether the kernels convert samples of a size in bits: 8, 16 or 32.
+ */
+inline bool IsSupported(unsigned int sampleSize) { return sampleSize == 8 || sampleSize == 16 || sampleSize == 32; }
+
+/**
+ * Convert `count` samples between sizes in bits, like raylib::Wave's sampleSize. Both sizes must be supported.
+ */
+inline void ConvertSamples(
+    const void* in,
+    unsigned int inSampleSize,
+    void* out,
+    unsigned int outSampleSize,
+    std::size_t count) {
+    const auto* bytes = static_cast<const std::uint8_t*>(in);
+    const auto* shorts = static_cast<const std::int16_t*>(in);
+    const auto* floats = static_cast<const float*>(in);
+    auto* outBytes = static_cast<std::uint8_t*>(out);
+    auto* outShorts = static_cast<std::int16_t*>(out);
+    auto* outFloats = static_cast<float*>(out);
+    if (inSampleSize == outSampleSize) {
+        std::copy(bytes, bytes + count * (inSampleSize / 8), outBytes);
+    } else if (inSampleSize == 8) {
+        if (outSampleSize == 16) {
+            Uint8ToInt16({bytes, count}, {outShorts, count});
+        } else {
+            Uint8ToFloat({bytes, count}, {outFloats, count});
+        }
+    } else if (inSampleSize == 16) {
+        if (outSampleSize == 8) {
+            Int16ToUint8({shorts, count}, {outBytes, count});
+        } else {
+            Int16ToFloat({shorts, count}, {outFloats, count});
+        }
+    } else if (outSampleSize == 8) {
+        FloatToUint8({floats, count}, {outBytes, count});
+    } else {
+        FloatToInt16({floats, count}, {outShorts, count});
+    }
+}
+
+/**
+ * Change the number of channels of interleaved float frames.
+ *
+ * Mixing to mono averages the channels, and mixing from mono copies the channel into every channel. Otherwise the
+ * channels both have are copied, and new channels are silent.
+ */
+inline void MixChannels(
+    std::span<const float> in,
+    unsigned int inChannels,
+    std::span<float> out,
+    unsigned int outChannels) {
+    if (inChannels == 0 || outChannels == 0) {
+        return;
+    }
+    const std::size_t frames = std::min(in.size() / inChannels, out.size() / outChannels);
+    std::size_t frame = 0;
+    if (inChannels == 2 && outChannels == 1) {
+        const simd::floatv half = simd::Set(0.5f);
+        frame = detail::ForEachRegister(frames, [&](std::size_t at) {
+            simd::floatv left, right;
+            simd::Deinterleave2(simd::Load(&in[at * 2]), simd::Load(&in[at * 2 + simd::width]), left, right);
+            simd::Store(&out[at], simd::Mul(simd::Add(left, right), half));
+        });
+    } else if (inChannels == 1 && outChannels == 2) {
+        frame = detail::ForEachRegister(frames, [&](std::size_t at) {
+            const simd::floatv mono = simd::Load(&in[at]);
+            simd::floatv first, second;
+            simd::Interleave2(mono, mono, first, second);
+            simd::Store(&out[at * 2], first);
+            simd::Store(&out[at * 2 + simd::width], second);
+        });
+    }
+    for (; frame < frames; frame++) {
+        const float* source = &in[frame * inChannels];
+        float* target = &out[frame * outChannels];
+        if (outChannels == 1) {
+            target[0] = std::accumulate(source, source + inChannels, 0.0f) / static_cast<float>(inChannels);
+        } else if (inChannels == 1) {
+            std::fill(target, target + outChannels, source[0]);
+        } else {
+            for (unsigned int channel = 0; channel < outChannels; channel++) {
+                target[channel] = channel < inChannels ? source[channel] : 0.0f;
+            }
+        }
+    }
+}
+
+/**
+ * Polyphase windowed sinc resampler, for interleaved float frames.
+ *
+ * Each output frame is a dot product of the input frames around it with one of a table of filters, one per phase
+ * of the output frame between two input frames. When the ratio of the rates reduces to at most MaxPhases output
+ * frames per cycle, the phases are exact; otherwise the output interpolates between the two nearest phases. The
+ * filters are Kaiser windowed sinc low pass filters, widened when downsampling to cut everything above the new
+ * Nyquist frequency.
+ *
+ * @code
+ * raylib::samples::Resampler resampler(44100, 48000);
+ * std::vector<float> out(resampler.GetOutputFrames(frames) * channels);
+ * resampler.Process(in, out, channels);
+ * @endcode
+ */
+class Resampler {
+public:
+    static constexpr unsigned int MaxPhases = 1024;
+
+    /**
+     * @param taps Input frames each output frame is computed from, when upsampling.
+     * @param passband Fraction of the lower Nyquist frequency that is kept.
+     * @param beta Kaiser window shape. Higher values attenuate more outside the passband, with a wider transition.
+     */
+    Resampler(
+        unsigned int inRate,
+        unsigned int outRate,
+        unsigned int taps = 32,
+        float passband = 0.9f,
+        float beta = 9.0f) {
+        const unsigned int divisor = std::gcd(std::max(inRate, 1u), std::max(outRate, 1u));
+        up = std::max(outRate, 1u) / divisor;
+        down = std::max(inRate, 1u) / divisor;
+        phases = std::min(up, MaxPhases);
+
+        const double cutoff = std::min(1.0, static_cast<double>(up) / down) * passband;
+        const auto width = static_cast<std::size_t>(std::ceil(std::max(taps, 2u) / std::min(1.0, cutoff / passband)));
+        // Whole registers, and an even count so the filter centers between its two middle taps.
+        length = (width + simd::width * 2 - 1) / (simd::width * 2) * (simd::width * 2);
+
+        // One more phase than needed, a copy of the first shifted by a frame, to interpolate into.
+        filters.assign((phases + 1) * length, 0.0f);
+        const double half = static_cast<double>(length) / 2;
+        for (unsigned int phase = 0; phase <= phases; phase++) {
+            float* filter = &filters[phase * length];
+            const double offset = static_cast<double>(phase) / phases;
+            double sum = 0;
+            for (std::size_t tap = 0; tap < length; tap++) {
+                // The distance of the input frame from the output frame.
+                const double distance = static_cast<double>(tap) - (half - 1) - offset;
+                const double x = distance * cutoff;
+                const double sinc = x == 0 ? 1.0 : std::sin(PI * x) / (PI * x);
+                const double window = distance / half;
+                const double value =
+                    window <= -1 || window >= 1 ? 0.0 : sinc * BesselI0(beta * std::sqrt(1 - window * window));
+                filter[tap] = static_cast<float>(value);
+                sum += value;
+            }
+            // Unit gain for a constant signal.
+            for (std::size_t tap = 0; tap < length; tap++) {
+                filter[tap] = static_cast<float>(filter[tap] / sum);
+            }
+        }
+    }
+
+    /**
+     * Retrieve how many frames Process() writes for a number of input frames.
+     */
+    [[nodiscard]] std::size_t GetOutputFrames(std::size_t inFrames) const {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(inFrames) * up + down - 1) / down);
+    }
+
+    /**
+     * Retrieve the number of input frames each output frame is computed from.
+     */
+    [[nodiscard]] std::size_t GetLength() const { return length; }
+
+    /**
+     * Resample interleaved frames. Frames before and after the input count as silence.
+     *
+     * @return The number of frames written, up to GetOutputFrames().
+     */
+    std::size_t Process(std::span<const float> in, std::span<float> out, unsigned int channels = 1) const {
+        if (channels == 0) {
+            return 0;
+        }
+        const std::size_t inFrames = in.size() / channels;
+        const std::size_t outFrames = std::min(GetOutputFrames(inFrames), out.size() / channels);
+
+        // One channel at a time, with silence around it so every dot product stays in range.
+        std::vector<float> padded(inFrames + length * 2, 0.0f);
+        for (unsigned int channel = 0; channel < channels; channel++) {
+            for (std::size_t frame = 0; frame < inFrames; frame++) {
+                padded[length + frame] = in[frame * channels + channel];
+            }
+            for (std::size_t frame = 0; frame < outFrames; frame++) {
+                const std::uint64_t position = static_cast<std::uint64_t>(frame) * down;
+                const auto base = static_cast<std::size_t>(position / up);
+                const auto remainder = static_cast<unsigned int>(position % up);
+                // The filter's middle taps sit on the input frames before and after the output frame.
+                const float* window = &padded[length + base - (length / 2 - 1)];
+
+                float value;
+                if (phases == up) {
+                    value = Dot(window, &filters[remainder * length]);
+                } else {
+                    const double exact = static_cast<double>(remainder) * phases / up;
+                    const auto phase = static_cast<unsigned int>(exact);
+                    const auto weight = static_cast<float>(exact - phase);
+                    const float before = Dot(window, &filters[phase * length]);
+                    const float after = Dot(window, &filters[(phase + 1) * length]);
+                    value = before + (after - before) * weight;
+                }
+                out[frame * channels + channel] = value;
+            }
+        }
+        return outFrames;
+    }
+protected:
+    /**
+     * The modified Bessel function of the first kind, of order zero, for the Kaiser window.
+     */
+    static double BesselI0(double x) {
+        double sum = 1;
+        double term = 1;
+        for (int k = 1; k < 50 && term > sum * 1e-12; k++) {
+            term *= (x / (2 * k)) * (x / (2 * k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    [[nodiscard]] float Dot(const float* window, const float* filter) const {
+        simd::floatv sum = simd::Set(0.0f);
+        for (std::size_t tap = 0; tap < length; tap += simd::width) {
+            sum = simd::Add(sum, simd::Mul(simd::Load(window + tap), simd::Load(filter + tap)));
+        }
+        return simd::Sum(sum);
+    }
+
+    unsigned int up;
+    unsigned int down;
+    unsigned int phases;
+    std::size_t length;
+    /** (phases + 1) filters of `length` taps */
+    std::vector<float> filters;
+};
+} // namespace samples
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_SAMPLEKERNELS_HPP_
@@ -0,0 +1,172 @@
+#ifndef RAYLIB_CPP_INCLUDE_SKYLINEPACKER_HPP_
+#define RAYLIB_CPP_INCLUDE_SKYLINEPACKER_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Packs rectangles into an area, one at a time, with the bottom-left skyline heuristic.
+ *
+ * The packer only remembers the top edge of what it has placed, as a list of horizontal segments, and puts each
+ * rectangle where its top ends up lowest. That wastes little space on rectangles of similar heights, like glyphs,
+ * and packing takes time proportional to the number of segments.
+ *
+ * @code
+ * raylib::SkylinePacker packer(512, 512);
+ * ::Rectangle rec;
+ * if (packer.Pack(12, 18, rec)) {
+ *     atlas.Draw(glyph, rec);
+ * }
+ * @endcode
+ */
+class SkylinePacker {
+public:
+    SkylinePacker(int width = 0, int height = 0) { Reset(width, height); }
+
+    GETTER(int, Width, width)
+    GETTER(int, Height, height)
+
+    /**
+     * Forget every packed rectangle.
+     */
+    void Reset() { Reset(width, height); }
+
+    /**
+     * Forget every packed rectangle, and change the size of the area.
+     */
+    void Reset(int newWidth, int newHeight) {
+        width = newWidth;
+        height = newHeight;
+        usedArea = 0;
+        skyline.clear();
+        skyline.push_back({0, 0, width});
+    }
+
+    /**
+     * Find room for a rectangle.
+     *
+     * @param rec Set to where the rectangle goes, when there is room.
+     *
+     * @return Whether there was room for the rectangle.
+     */
+    bool Pack(int rectWidth, int rectHeight, ::Rectangle& rec) {
+        if (rectWidth <= 0 || rectHeight <= 0) {
+            rec = {0, 0, static_cast<float>(rectWidth), static_cast<float>(rectHeight)};
+            return rectWidth >= 0 && rectHeight >= 0;
+        }
+
+        std::size_t best = skyline.size();
+        int bestTop = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        int bestY = 0;
+        for (std::size_t i = 0; i < skyline.size(); i++) {
+            const int y = Fit(i, rectWidth, rectHeight);
+            // Lowest top first, then the narrowest segment, to keep wide segments for wide rectangles.
+            if (y >= 0 && (y + rectHeight < bestTop || (y + rectHeight == bestTop && skyline[i].width < bestWidth))) {
+                best = i;
+                bestTop = y + rectHeight;
+                bestWidth = skyline[i].width;
+                bestY = y;
+            }
+        }
+        if (best == skyline.size()) {
+            return false;
+        }
+
+        const int x = skyline[best].x;
+        Place(best, x, bestY + rectHeight, rectWidth);
+        usedArea += static_cast<long long>(rectWidth) * rectHeight;
+        rec = {
+            static_cast<float>(x),
+            static_cast<float>(bestY),
+            static_cast<float>(rectWidth),
+            static_cast<float>(rectHeight)};
+        return true;
+    }
+
+    /**
+     * Retrieve the fraction of the area covered by packed rectangles.
+     */
+    [[nodiscard]] float GetOccupancy() const {
+        return width > 0 && height > 0
+                   ? static_cast<float>(static_cast<double>(usedArea) / (static_cast<double>(width) * height))
+                   : 0.0f;
+    }
+protected:
+    /**
+     * A horizontal segment of the top edge.
+     */
+    struct Segment {
+        int x;
+        int y;
+        int width;
+    };
+
+    /**
+     * Retrieve how low a rectangle can go with its left edge on a segment, or -1 if it doesn't fit there.
+     */
+    [[nodiscard]] int Fit(std::size_t index, int rectWidth, int rectHeight) const {
+        const int x = skyline[index].x;
+        if (x + rectWidth > width) {
+            return -1;
+        }
+        int y = 0;
+        int remaining = rectWidth;
+        for (std::size_t i = index; remaining > 0; i++) {
+            y = std::max(y, skyline[i].y);
+            if (y + rectHeight > height) {
+                return -1;
+            }
+            remaining -= skyline[i].width;
+        }
+        return y;
+    }
+
+    /**
+     * Raise the skyline to `top` from `x` for `rectWidth`, starting at the segment at `index`.
+     */
+    void Place(std::size_t index, int x, int top, int rectWidth) {
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(index), {x, top, rectWidth});
+
+        // Cut the segments that are now under the new one.
+        const int right = x + rectWidth;
+        std::size_t i = index + 1;
+        while (i < skyline.size() && skyline[i].x < right) {
+            const int end = skyline[i].x + skyline[i].width;
+            if (end <= right) {
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            } else {
+                skyline[i].width = end - right;
+                skyline[i].x = right;
+                break;
+            }
+        }
+
+        // Merge neighbours of the same height.
+        for (i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                i++;
+            }
+        }
+    }
+
+    int width;
+    int height;
+    long long usedArea;
+    /** The top edge, left to right, covering the whole width */
+    std::vector<Segment> skyline;
+};
+} // namespace raylib
+
+using RSkylinePacker = raylib::SkylinePacker;
+
+#endif // RAYLIB_CPP_INCLUDE_SKYLINEPACKER_HPP_
@@ -0,0 +1,498 @@
+#ifndef RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
+#define RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./Rectangle.hpp"
+#include "./ThreadPool.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Broadphase for many moving rectangles: a uniform grid of square cells, hashed into a fixed number of buckets, so
+ * the world needs no bounds.
+ *
+ * Each proxy is linked into every cell its rectangle touches. Moving a proxy within the same cells only stores the
+ * new rectangle, and moving it to other cells relinks it without any allocation once the hash has grown. Queries and
+ * pairs report each proxy once, and use the same tests as Rectangle::CheckCollision(), so rectangles that only touch
+ * do not overlap. Circles go in as their bounding rectangles, with CheckCollisionCircles() as the narrow phase.
+ *
+ * The cell size should be about the size of a typical proxy. Proxies spanning more than MaxCells cells are kept in
+ * a separate list and tested against everything instead.
+ *
+ * @code
+ * raylib::SpatialHash hash(32.0f);
+ * raylib::SpatialHash::Handle player = hash.Add({x, y, 24, 24});
+ * hash.Move(player, {x + dx, y + dy, 24, 24});
+ * for (auto [a, b] : hash.GetPairs()) {
+ *     // ...
+ * }
+ * @endcode
+ */
+class SpatialHash {
+public:
+    /** Identifies a proxy until it is removed, after which Add() may reuse it */
+    using Handle = std::uint32_t;
+    /** Two overlapping proxies, the lower handle first */
+    using Pair = std::pair<Handle, Handle>;
+
+    /** Proxies spanning more cells than this are tested against everything */
+    static constexpr std::int64_t MaxCells = 64;
+    static constexpr Handle Invalid = std::numeric_limits<Handle>::max();
+
+    /**
+     * @param cellSize Width and height of a grid cell, in world units.
+     * @param capacity Number of proxies to reserve room for.
+     */
+    explicit SpatialHash(float cellSize = 64.0f, std::size_t capacity = 0) : cellSize(cellSize) {
+        if (!(cellSize > 0.0f) || !std::isfinite(cellSize)) {
+            throw RaylibException("Spatial hash cell size must be positive");
+        }
+        inverse = 1.0f / cellSize;
+        proxies.reserve(capacity);
+        Rehash(std::max<std::size_t>(capacity * 2, 64));
+    }
+
+    GETTER(float, CellSize, cellSize)
+
+    /**
+     * Retrieve the number of proxies.
+     */
+    [[nodiscard]] std::size_t GetCount() const { return count; }
+
+    [[nodiscard]] bool IsEmpty() const { return count == 0; }
+
+    /**
+     * Check whether a handle refers to a proxy that has not been removed.
+     */
+    [[nodiscard]] bool IsValid(Handle handle) const { return handle < proxies.size() && proxies[handle].alive; }
+
+    /**
+     * Add a proxy.
+     *
+     * @return The handle of the new proxy.
+     */
+    Handle Add(const ::Rectangle& rect) {
+        Handle handle;
+        if (freeProxies.empty()) {
+            if (proxies.size() >= Invalid) {
+                throw RaylibException("Spatial hash is full");
+            }
+            handle = static_cast<Handle>(proxies.size());
+            proxies.emplace_back();
+        } else {
+            handle = freeProxies.back();
+            freeProxies.pop_back();
+        }
+        Proxy& proxy = proxies[handle];
+        proxy.rect = rect;
+        proxy.range = GetRange(rect);
+        proxy.alive = true;
+        Link(handle);
+        count++;
+        return handle;
+    }
+
+    /**
+     * Remove a proxy. Its handle may be given to the next proxy added.
+     */
+    void Remove(Handle handle) {
+        Check(handle);
+        Unlink(handle);
+        proxies[handle].alive = false;
+        freeProxies.push_back(handle);
+        count--;
+    }
+
+    /**
+     * Remove every proxy, keeping the memory.
+     */
+    void Clear() {
+        proxies.clear();
+        freeProxies.clear();
+        entries.clear();
+        freeEntries.clear();
+        large.clear();
+        std::fill(buckets.begin(), buckets.end(), none);
+        count = 0;
+    }
+
+    /**
+     * Move a proxy to a new rectangle.
+     */
+    void Move(Handle handle, const ::Rectangle& rect) {
+        Check(handle);
+        Proxy& proxy = proxies[handle];
+        const Range range = GetRange(rect);
+        if (range == proxy.range) {
+            proxy.rect = rect;
+            return;
+        }
+        Unlink(handle);
+        proxy.rect = rect;
+        proxy.range = range;
+        Link(handle);
+    }
+
+    /**
+     * Retrieve the rectangle of a proxy.
+     */
+    [[nodiscard]] Rectangle Get(Handle handle) const {
+        Check(handle);
+        return proxies[handle].rect;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy overlapping a region.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(const ::Rectangle& region, F&& fn) const {
+        Search(GetRange(region), [&region](const Rectangle& rect) { return rect.CheckCollision(region); }, fn);
+    }
+
+    /**
+     * Find the proxies overlapping a region.
+     */
+    [[nodiscard]] std::vector<Handle> Query(const ::Rectangle& region) const {
+        std::vector<Handle> found;
+        Query(region, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy containing a point.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(::Vector2 point, F&& fn) const {
+        Search(GetRange({point.x, point.y, 0.0f, 0.0f}), [point](const Rectangle& rect) {
+            return rect.CheckCollision(point);
+        }, fn);
+    }
+
+    /**
+     * Find the proxies containing a point.
+     */
+    [[nodiscard]] std::vector<Handle> Query(::Vector2 point) const {
+        std::vector<Handle> found;
+        Query(point, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(handle)` for every proxy overlapping a circle.
+     */
+    template<typename F>
+        requires std::is_invocable_v<F&, Handle>
+    void Query(::Vector2 center, float radius, F&& fn) const {
+        const Range range{
+            GetCell(center.x - radius),
+            GetCell(center.y - radius),
+            GetCell(center.x + radius),
+            GetCell(center.y + radius)};
+        Search(range, [center, radius](const Rectangle& rect) {
+            return rect.CheckCollision(center, radius);
+        }, fn);
+    }
+
+    /**
+     * Find the proxies overlapping a circle.
+     */
+    [[nodiscard]] std::vector<Handle> Query(::Vector2 center, float radius) const {
+        std::vector<Handle> found;
+        Query(center, radius, [&found](Handle handle) { found.push_back(handle); });
+        return found;
+    }
+
+    /**
+     * Call `fn(a, b)` once for every pair of overlapping proxies, with `a < b`.
+     */
+    template<typename F>
+    void ForEachPair(F&& fn) const {
+        PairsInBuckets(0, buckets.size(), fn);
+        PairsWithLarge(fn);
+    }
+
+    /**
+     * Find every pair of overlapping proxies.
+     */
+    [[nodiscard]] std::vector<Pair> GetPairs() const {
+        std::vector<Pair> pairs;
+        ForEachPair([&pairs](Handle a, Handle b) { pairs.emplace_back(a, b); });
+        return pairs;
+    }
+
+    /**
+     * Find every pair of overlapping proxies, splitting the buckets into chunks on a thread pool. The pairs come in
+     * the same order as from the serial overload.
+     */
+    [[nodiscard]] std::vector<Pair> GetPairs(ThreadPool& pool, std::size_t grain = 4096) const {
+        std::vector<Pair> pairs;
+        pool.ParallelCollect(0, buckets.size(), grain, pairs, [this](std::size_t begin, std::size_t end, auto& out) {
+            PairsInBuckets(begin, end, [&out](Handle a, Handle b) { out.emplace_back(a, b); });
+        });
+        PairsWithLarge([&pairs](Handle a, Handle b) { pairs.emplace_back(a, b); });
+        return pairs;
+    }
+protected:
+    static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * The cells a rectangle touches, inclusive.
+     */
+    struct Range {
+        std::int32_t minX, minY, maxX, maxY;
+
+        [[nodiscard]] std::int64_t GetCells() const {
+            return (std::int64_t{maxX} - minX + 1) * (std::int64_t{maxY} - minY + 1);
+        }
+
+        bool operator==(const Range&) const = default;
+    };
+
+    struct Proxy {
+        Rectangle rect;
+        Range range{};
+        /** The first of the proxy's cell entries, or its place in the large list */
+        std::uint32_t first{none};
+        bool alive{false};
+        bool large{false};
+    };
+
+    /**
+     * A proxy in one cell, linked into its bucket and to the proxy's other cells.
+     */
+    struct Entry {
+        std::int32_t x, y;
+        Handle proxy;
+        std::uint32_t next, previous, sibling;
+    };
+
+    float cellSize;
+    float inverse;
+    std::size_t count{0};
+    std::vector<Proxy> proxies;
+    std::vector<Handle> freeProxies;
+    std::vector<Entry> entries;
+    std::vector<std::uint32_t> freeEntries;
+    std::vector<std::uint32_t> buckets;
+    std::vector<Handle> large;
+
+    void Check(Handle handle) const {
+        if (!IsValid(handle)) {
+            throw RaylibException("Invalid spatial hash handle");
+        }
+    }
+
+    /**
+     * The cell a coordinate falls in, clamped so that cell ranges never overflow. NaN goes to the lowest cell.
+     */
+    [[nodiscard]] std::int32_t GetCell(float value) const {
+        constexpr float limit = 1 << 30;
+        const float cell = std::floor(value * inverse);
+        return static_cast<std::int32_t>(cell >= limit ? limit : (cell > -limit ? cell : -limit));
+    }
+
+    [[nodiscard]] Range GetRange(const ::Rectangle& rect) const {
+        const std::int32_t minX = GetCell(rect.x);
+        const std::int32_t minY = GetCell(rect.y);
+        const std::int32_t maxX = GetCell(rect.x + rect.width);
+        const std::int32_t maxY = GetCell(rect.y + rect.height);
+        return {minX, minY, std::max(minX, maxX), std::max(minY, maxY)};
+    }
+
+    [[nodiscard]] std::size_t GetBucket(std::int32_t x, std::int32_t y) const {
+        std::uint32_t hash = static_cast<std::uint32_t>(x) * 0x9E3779B1u ^ static_cast<std::uint32_t>(y) * 0x85EBCA77u;
+        hash ^= hash >> 15;
+        return hash & (buckets.size() - 1);
+    }
+
+    /**
+     * Resize the bucket array to a power of two, and link every entry again.
+     */
+    void Rehash(std::size_t size) {
+        std::size_t capacity = 1;
+        while (capacity < size) {
+            capacity *= 2;
+        }
+        buckets.assign(capacity, none);
+        for (std::uint32_t i = 0; i < entries.size(); i++) {
+            Entry& entry = entries[i];
+            if (entry.proxy == Invalid) {
+                continue;
+            }
+            std::uint32_t& head = buckets[GetBucket(entry.x, entry.y)];
+            entry.next = head;
+            entry.previous = none;
+            if (head != none) {
+                entries[head].previous = i;
+            }
+            head = i;
+        }
+    }
+
+    void Link(Handle handle) {
+        Proxy& proxy = proxies[handle];
+        const Range& range = proxy.range;
+        proxy.large = range.GetCells() > MaxCells;
+        if (proxy.large) {
+            proxy.first = static_cast<std::uint32_t>(large.size());
+            large.push_back(handle);
+            return;
+        }
+        proxy.first = none;
+        for (std::int32_t y = range.minY; y <= range.maxY; y++) {
+            for (std::int32_t x = range.minX; x <= range.maxX; x++) {
+                std::uint32_t index;
+                if (freeEntries.empty()) {
+                    index = static_cast<std::uint32_t>(entries.size());
+                    entries.emplace_back();
+                } else {
+                    index = freeEntries.back();
+                    freeEntries.pop_back();
+                }
+                std::uint32_t& head = buckets[GetBucket(x, y)];
+                entries[index] = {x, y, handle, head, none, proxy.first};
+                if (head != none) {
+                    entries[head].previous = index;
+                }
+                head = index;
+                proxy.first = index;
+            }
+        }
+        if (entries.size() - freeEntries.size() > buckets.size()) {
+            Rehash(buckets.size() * 2);
+        }
+    }
+
+    void Unlink(Handle handle) {
+        Proxy& proxy = proxies[handle];
+        if (proxy.large) {
+            const Handle moved = large.back();
+            large[proxy.first] = moved;
+            proxies[moved].first = proxy.first;
+            large.pop_back();
+            return;
+        }
+        for (std::uint32_t index = proxy.first; index != none;) {
+            Entry& entry = entries[index];
+            if (entry.previous != none) {
+                entries[entry.previous].next = entry.next;
+            } else {
+                buckets[GetBucket(entry.x, entry.y)] = entry.next;
+            }
+            if (entry.next != none) {
+                entries[entry.next].previous = entry.previous;
+            }
+            entry.proxy = Invalid;
+            freeEntries.push_back(index);
+            index = entry.sibling;
+        }
+        proxy.first = none;
+    }
+
+    /**
+     * Call `fn(handle)` for the proxies in a range of cells that pass a test, then for the large ones that do.
+     */
+    template<typename Test, typename F>
+    void Search(const Range& range, Test&& test, F& fn) const {
+        SearchGrid(range, test, fn);
+        for (Handle handle : large) {
+            if (test(proxies[handle].rect)) {
+                fn(handle);
+            }
+        }
+    }
+
+    /**
+     * Call `fn(handle)` for the proxies of the grid in a range of cells that pass a test. A proxy is reported from
+     * the first cell it shares with the range, so only once. Ranges with more cells than there are buckets scan
+     * every proxy instead.
+     */
+    template<typename Test, typename F>
+    void SearchGrid(const Range& range, Test& test, F& fn) const {
+        if (range.GetCells() > static_cast<std::int64_t>(buckets.size())) {
+            for (Handle handle = 0; handle < proxies.size(); handle++) {
+                const Proxy& proxy = proxies[handle];
+                if (proxy.alive && !proxy.large && test(proxy.rect)) {
+                    fn(handle);
+                }
+            }
+            return;
+        }
+        for (std::int32_t y = range.minY; y <= range.maxY; y++) {
+            for (std::int32_t x = range.minX; x <= range.maxX; x++) {
+                for (std::uint32_t index = buckets[GetBucket(x, y)]; index != none;) {
+                    const Entry& entry = entries[index];
+                    index = entry.next;
+                    if (entry.x != x || entry.y != y) {
+                        continue;
+                    }
+                    const Proxy& proxy = proxies[entry.proxy];
+                    if (x == std::max(range.minX, proxy.range.minX) && y == std::max(range.minY, proxy.range.minY) &&
+                        test(proxy.rect)) {
+                        fn(entry.proxy);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Report the overlapping pairs sharing a cell in some buckets, each from the first cell both proxies touch.
+     */
+    template<typename F>
+    void PairsInBuckets(std::size_t begin, std::size_t end, F&& fn) const {
+        for (std::size_t bucket = begin; bucket < end; bucket++) {
+            for (std::uint32_t i = buckets[bucket]; i != none; i = entries[i].next) {
+                const Entry& first = entries[i];
+                const Proxy& a = proxies[first.proxy];
+                for (std::uint32_t j = first.next; j != none; j = entries[j].next) {
+                    const Entry& second = entries[j];
+                    if (second.x != first.x || second.y != first.y) {
+                        continue;
+                    }
+                    const Proxy& b = proxies[second.proxy];
+                    if (first.x == std::max(a.range.minX, b.range.minX) &&
+                        first.y == std::max(a.range.minY, b.range.minY) && a.rect.CheckCollision(b.rect)) {
+                        fn(std::min(first.proxy, second.proxy), std::max(first.proxy, second.proxy));
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Report the overlapping pairs with a large proxy: against each other, then against the grid.
+     */
+    template<typename F>
+    void PairsWithLarge(F&& fn) const {
+        for (std::size_t i = 0; i < large.size(); i++) {
+            const Proxy& a = proxies[large[i]];
+            for (std::size_t j = i + 1; j < large.size(); j++) {
+                if (a.rect.CheckCollision(proxies[large[j]].rect)) {
+                    fn(std::min(large[i], large[j]), std::max(large[i], large[j]));
+                }
+            }
+            auto overlaps = [&a](const Rectangle& rect) { return rect.CheckCollision(a.rect); };
+            auto report = [&fn, handle = large[i]](Handle other) {
+                fn(std::min(handle, other), std::max(handle, other));
+            };
+            SearchGrid(a.range, overlaps, report);
+        }
+    }
+};
+} // namespace raylib
+
+using RSpatialHash = raylib::SpatialHash;
+
+#endif // RAYLIB_CPP_INCLUDE_SPATIALHASH_HPP_
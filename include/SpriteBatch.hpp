@@ -0,0 +1,398 @@
+#ifndef RAYLIB_CPP_INCLUDE_SPRITEBATCH_HPP_
+#define RAYLIB_CPP_INCLUDE_SPRITEBATCH_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+#include <rlgl.h>
+
+#if !defined(RL_DEFAULT_BATCH_BUFFER_ELEMENTS)
+#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS 2048
+#endif
+
+namespace raylib {
+/**
+ * Collects textured quads for a frame, sorts them by layer and texture, and submits them to rlgl in long runs.
+ *
+ * Drawing each sprite with DrawTexture*() switches textures and checks rlgl's batch limit for every quad. A
+ * SpriteBatch builds all vertices into one contiguous buffer instead, so each texture of each layer costs one
+ * texture switch, and rlgl's batch is checked once per run of quads that fits into it.
+ *
+ * Layers are drawn from lowest to highest. Within a layer, sprites are grouped by texture, and sprites sharing a
+ * texture keep the order they were drawn in.
+ *
+ * In Mode::Record, End() keeps the sorted vertices and batches for inspection instead of drawing them, so the
+ * batch works without a graphics context.
+ *
+ * @code
+ * raylib::SpriteBatch batch;
+ * BeginDrawing();
+ * batch.Begin();
+ * batch.Draw(background, {0, 0}, WHITE, -1);
+ * for (const Bunny& bunny : bunnies) {
+ *     batch.Draw(texBunny, bunny.position, bunny.color);
+ * }
+ * batch.End();
+ * EndDrawing();
+ * @endcode
+ */
+class SpriteBatch {
+public:
+    enum class Mode {
+        /** End() draws the sprites with rlgl */
+        Render,
+        /** End() keeps the sorted sprites, and draws nothing */
+        Record,
+    };
+
+    /**
+     * One corner of a quad. Quads are stored as top-left, bottom-left, bottom-right and top-right corners.
+     */
+    struct Vertex {
+        float x, y;
+        float u, v;
+        ::Color color;
+    };
+
+    /**
+     * A run of quads sharing a texture and layer.
+     */
+    struct Batch {
+        unsigned int textureId;
+        int layer;
+        /** Index of the first quad */
+        std::size_t first;
+        /** Number of quads */
+        std::size_t count;
+    };
+
+    /**
+     * @param capacity Number of sprites to reserve room for.
+     */
+    explicit SpriteBatch(Mode mode = Mode::Render, std::size_t capacity = 1024) : mode(mode) { Reserve(capacity); }
+
+    GETTERSETTER(Mode, Mode, mode)
+
+    /**
+     * Reserve room for the given number of sprites per frame.
+     */
+    void Reserve(std::size_t capacity) {
+        keys.reserve(capacity);
+        vertices.reserve(capacity * 4);
+        sorted.reserve(capacity * 4);
+    }
+
+    /**
+     * Start collecting a new set of sprites, dropping the previous ones.
+     */
+    void Begin() {
+        keys.clear();
+        vertices.clear();
+        sorted.clear();
+        batches.clear();
+    }
+
+    /**
+     * Add a texture at the given position, like DrawTextureV(). Textures that aren't loaded are skipped.
+     */
+    void Draw(const ::Texture2D& texture, ::Vector2 position, ::Color tint = {255, 255, 255, 255}, int layer = 0) {
+        if (!IsDrawable(texture)) {
+            return;
+        }
+        const float width = static_cast<float>(texture.width);
+        const float height = static_cast<float>(texture.height);
+        Push(texture, layer, tint,
+            {position.x, position.y},
+            {position.x, position.y + height},
+            {position.x + width, position.y + height},
+            {position.x + width, position.y},
+            0.0f, 0.0f, 1.0f, 1.0f);
+    }
+
+    /**
+     * Add the texture at each of the given positions, with the matching tint. Textures that aren't loaded are skipped.
+     *
+     * Every sprite has the texture's size, like DrawTextureV(), so there is nothing to flip. Use the overload taking
+     * source and destination rectangles to scale or flip sprites.
+     *
+     * @throws raylib::RaylibException Throws if the number of positions and tints differ.
+     */
+    void Draw(
+        const ::Texture2D& texture,
+        std::span<const ::Vector2> positions,
+        std::span<const ::Color> tints,
+        int layer = 0) {
+        if (positions.size() != tints.size()) {
+            throw RaylibException("SpriteBatch::Draw() needs one tint per position");
+        }
+        if (!IsDrawable(texture)) {
+            return;
+        }
+        const float width = static_cast<float>(texture.width);
+        const float height = static_cast<float>(texture.height);
+        const std::size_t first = keys.size();
+        keys.resize(first + positions.size(), MakeKey(layer, texture.id));
+        vertices.resize((first + positions.size()) * 4);
+        Vertex* quad = &vertices[first * 4];
+        for (std::size_t i = 0; i < positions.size(); i++, quad += 4) {
+            const ::Vector2 position = positions[i];
+            quad[0] = {position.x, position.y, 0.0f, 0.0f, tints[i]};
+            quad[1] = {position.x, position.y + height, 0.0f, 1.0f, tints[i]};
+            quad[2] = {position.x + width, position.y + height, 1.0f, 1.0f, tints[i]};
+            quad[3] = {position.x + width, position.y, 1.0f, 0.0f, tints[i]};
+        }
+    }
+
+    /**
+     * Add a part of a texture at the given position, like DrawTextureRec().
+     */
+    void Draw(
+        const ::Texture2D& texture,
+        ::Rectangle source,
+        ::Vector2 position,
+        ::Color tint = {255, 255, 255, 255},
+        int layer = 0) {
+        Draw(texture, source, {position.x, position.y, std::fabs(source.width), std::fabs(source.height)},
+            {0, 0}, 0.0f, tint, layer);
+    }
+
+    /**
+     * Add a part of a texture, scaled into `dest` and rotated in degrees around `origin`, like DrawTexturePro().
+     * A negative source width or height flips the texture, and a negative destination size counts as positive.
+     */
+    void Draw(
+        const ::Texture2D& texture,
+        ::Rectangle source,
+        ::Rectangle dest,
+        ::Vector2 origin,
+        float rotation,
+        ::Color tint = {255, 255, 255, 255},
+        int layer = 0) {
+        if (!IsDrawable(texture)) {
+            return;
+        }
+        dest.width = std::fabs(dest.width);
+        dest.height = std::fabs(dest.height);
+
+        const float width = static_cast<float>(texture.width);
+        const float height = static_cast<float>(texture.height);
+        const bool flipX = source.width < 0;
+        if (flipX) {
+            source.width = -source.width;
+        }
+        if (source.height < 0) {
+            source.y -= source.height;
+        }
+        float left = source.x / width;
+        float right = (source.x + source.width) / width;
+        if (flipX) {
+            std::swap(left, right);
+        }
+        const float top = source.y / height;
+        const float bottom = (source.y + source.height) / height;
+
+        ::Vector2 topLeft, topRight, bottomLeft, bottomRight;
+        if (rotation == 0.0f) {
+            const float x = dest.x - origin.x;
+            const float y = dest.y - origin.y;
+            topLeft = {x, y};
+            topRight = {x + dest.width, y};
+            bottomLeft = {x, y + dest.height};
+            bottomRight = {x + dest.width, y + dest.height};
+        } else {
+            const float radians = rotation * DEG2RAD;
+            const float sinRotation = std::sin(radians);
+            const float cosRotation = std::cos(radians);
+            const float dx = -origin.x;
+            const float dy = -origin.y;
+            auto corner = [&](float cx, float cy) {
+                return ::Vector2{
+                    dest.x + cx * cosRotation - cy * sinRotation,
+                    dest.y + cx * sinRotation + cy * cosRotation};
+            };
+            topLeft = corner(dx, dy);
+            topRight = corner(dx + dest.width, dy);
+            bottomLeft = corner(dx, dy + dest.height);
+            bottomRight = corner(dx + dest.width, dy + dest.height);
+        }
+        Push(texture, layer, tint, topLeft, bottomLeft, bottomRight, topRight, left, top, right, bottom);
+    }
+
+    /**
+     * Sort the sprites added since Begin(), and draw them, or keep them in Mode::Record. Call it once per Begin().
+     */
+    void End() {
+        Sort();
+        if (mode == Mode::Render) {
+            Submit();
+        }
+    }
+
+    /**
+     * Retrieve the number of sprites added since Begin().
+     */
+    [[nodiscard]] std::size_t GetSpriteCount() const { return keys.size(); }
+
+    /**
+     * Retrieve the sorted vertices, four per sprite, after End().
+     */
+    [[nodiscard]] std::span<const Vertex> GetVertices() const { return sorted; }
+
+    /**
+     * Retrieve the runs of sprites sharing a texture and layer, in drawing order, after End().
+     */
+    [[nodiscard]] std::span<const Batch> GetBatches() const { return batches; }
+protected:
+    void Push(
+        const ::Texture2D& texture,
+        int layer,
+        ::Color tint,
+        ::Vector2 topLeft,
+        ::Vector2 bottomLeft,
+        ::Vector2 bottomRight,
+        ::Vector2 topRight,
+        float left,
+        float top,
+        float right,
+        float bottom) {
+        keys.push_back(MakeKey(layer, texture.id));
+        vertices.resize(vertices.size() + 4);
+        Vertex* quad = &vertices[vertices.size() - 4];
+        quad[0] = {topLeft.x, topLeft.y, left, top, tint};
+        quad[1] = {bottomLeft.x, bottomLeft.y, left, bottom, tint};
+        quad[2] = {bottomRight.x, bottomRight.y, right, bottom, tint};
+        quad[3] = {topRight.x, topRight.y, right, top, tint};
+    }
+
+    /**
+     * Skip textures that failed to load, as DrawTexturePro() does.
+     */
+    static bool IsDrawable(const ::Texture2D& texture) {
+        return texture.id != 0 && texture.width > 0 && texture.height > 0;
+    }
+
+    /**
+     * Layer in the high bits, texture in the low bits. Flipping the layer's sign bit keeps negative layers below
+     * positive ones as unsigned numbers.
+     */
+    static std::uint64_t MakeKey(int layer, unsigned int textureId) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(layer) ^ 0x80000000u) << 32) | textureId;
+    }
+
+    static Batch MakeBatch(std::uint64_t key, std::size_t first, std::size_t count) {
+        return {static_cast<unsigned int>(key & 0xFFFFFFFFu),
+            static_cast<int>(static_cast<std::uint32_t>(key >> 32) ^ 0x80000000u), first, count};
+    }
+
+    /**
+     * Gather the vertices into layer and texture order, and find the runs. Frames only use a handful of textures
+     * and layers, so this is a stable counting sort over the distinct keys, and sprites that were drawn in order
+     * already skip it.
+     */
+    void Sort() {
+        sorted.clear();
+        batches.clear();
+        if (std::is_sorted(keys.begin(), keys.end())) {
+            std::swap(sorted, vertices);
+            for (std::size_t i = 0; i < keys.size(); i++) {
+                if (i == 0 || keys[i] != keys[i - 1]) {
+                    batches.push_back(MakeBatch(keys[i], i, 0));
+                }
+                batches.back().count++;
+            }
+            return;
+        }
+
+        // Find the distinct keys, then the bucket of every sprite. Neighbouring sprites mostly share a key.
+        std::vector<std::uint64_t> distinct;
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            if (i == 0 || keys[i] != keys[i - 1]) {
+                const auto found = std::lower_bound(distinct.begin(), distinct.end(), keys[i]);
+                if (found == distinct.end() || *found != keys[i]) {
+                    distinct.insert(found, keys[i]);
+                }
+            }
+        }
+        buckets.resize(keys.size());
+        std::uint32_t bucket = 0;
+        for (std::size_t i = 0; i < keys.size(); i++) {
+            if (i == 0 || keys[i] != keys[i - 1]) {
+                bucket = static_cast<std::uint32_t>(
+                    std::lower_bound(distinct.begin(), distinct.end(), keys[i]) - distinct.begin());
+            }
+            buckets[i] = bucket;
+        }
+
+        for (std::uint64_t key : distinct) {
+            batches.push_back(MakeBatch(key, 0, 0));
+        }
+        for (std::uint32_t bucket : buckets) {
+            batches[bucket].count++;
+        }
+        std::size_t first = 0;
+        for (Batch& batch : batches) {
+            batch.first = first;
+            first += batch.count;
+        }
+
+        sorted.resize(vertices.size());
+        std::vector<std::size_t> next(batches.size());
+        for (std::size_t i = 0; i < batches.size(); i++) {
+            next[i] = batches[i].first;
+        }
+        for (std::size_t i = 0; i < buckets.size(); i++) {
+            std::copy_n(&vertices[i * 4], 4, &sorted[next[buckets[i]]++ * 4]);
+        }
+        vertices.clear();
+    }
+
+    /**
+     * Send the sorted quads to rlgl, checking its batch limit once per run that fits into the batch buffer.
+     */
+    void Submit() const {
+        constexpr std::size_t chunk = RL_DEFAULT_BATCH_BUFFER_ELEMENTS;
+        for (const Batch& batch : batches) {
+            rlSetTexture(batch.textureId);
+            for (std::size_t first = batch.first; first < batch.first + batch.count; first += chunk) {
+                const std::size_t count = std::min(chunk, batch.first + batch.count - first);
+                rlCheckRenderBatchLimit(static_cast<int>(count * 4));
+                rlBegin(RL_QUADS);
+                rlNormal3f(0.0f, 0.0f, 1.0f);
+                for (const Vertex* quad = &sorted[first * 4]; quad != &sorted[first * 4] + count * 4; quad += 4) {
+                    rlColor4ub(quad->color.r, quad->color.g, quad->color.b, quad->color.a);
+                    for (int corner = 0; corner < 4; corner++) {
+                        rlTexCoord2f(quad[corner].u, quad[corner].v);
+                        rlVertex2f(quad[corner].x, quad[corner].y);
+                    }
+                }
+                rlEnd();
+            }
+        }
+        rlSetTexture(0);
+    }
+
+    Mode mode;
+    /** Sort key of each sprite, in submission order */
+    std::vector<std::uint64_t> keys;
+    /** Index into the batches of each sprite, while sorting */
+    std::vector<std::uint32_t> buckets;
+    /** Submission order */
+    std::vector<Vertex> vertices;
+    /** Drawing order */
+    std::vector<Vertex> sorted;
+    std::vector<Batch> batches;
+};
+} // namespace raylib
+
+using RSpriteBatch = raylib::SpriteBatch;
+
+#endif // RAYLIB_CPP_INCLUDE_SPRITEBATCH_HPP_
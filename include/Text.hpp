@@ -4,6 +4,7 @@
 #include <string>
 
 #include "./RaylibException.hpp"
+#include "./TextLayout.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
@@ -117,6 +118,13 @@ public:
         ::DrawTextPro(font, text.c_str(), position, origin, rotation, fontSize, spacing, color);
     }
 
+    /**
+     * Draw text with values in class, with the layout from a cache.
+     */
+    void Draw(TextLayoutCache& cache, const ::Vector2& position) const {
+        cache.Draw(font, text, position, fontSize, spacing, color);
+    }
+
     /**
      * Measure string width for default font
      */
@@ -127,6 +135,13 @@ public:
      */
     [[nodiscard]] Vector2 MeasureEx() const { return ::MeasureTextEx(font, text.c_str(), fontSize, spacing); }
 
+    /**
+     * Measure string size for Font, with the layout from a cache.
+     */
+    [[nodiscard]] Vector2 MeasureEx(TextLayoutCache& cache) const {
+        return cache.Measure(font, text, fontSize, spacing);
+    }
+
     Text& operator=(const Text& other) {
         if (this == &other) {
             return *this;
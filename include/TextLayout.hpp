@@ -0,0 +1,424 @@
+#ifndef RAYLIB_CPP_INCLUDE_TEXTLAYOUT_HPP_
+#define RAYLIB_CPP_INCLUDE_TEXTLAYOUT_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "./GlyphLookup.hpp"
+#include "./SpriteBatch.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Text laid out with a font: the glyph quads, relative to the text's top-left corner, and the text's size.
+ *
+ * The glyphs are placed like ::DrawTextEx() places them, and the size is what ::MeasureTextEx() returns, so
+ * drawing a layout gives the same quads as drawing the text, without decoding it or looking up glyphs again.
+ */
+struct TextLayout {
+    /**
+     * One visible glyph.
+     */
+    struct Glyph {
+        /** Part of the font texture, including the glyph padding */
+        ::Rectangle source;
+        /** Where to draw it, relative to the text position */
+        ::Rectangle dest;
+    };
+
+    std::vector<Glyph> glyphs;
+    ::Vector2 size{0.0f, 0.0f};
+    ::Texture2D texture{};
+
+    /**
+     * Lay out text, placing glyphs like ::DrawTextEx() and measuring like ::MeasureTextEx().
+     *
+     * @param lineSpacing Extra space between lines, as set with ::SetTextLineSpacing(). raylib's default is 2.
+     */
+    static TextLayout Build(
+        const ::Font& font,
+        const GlyphLookup& lookup,
+        std::string_view text,
+        float fontSize,
+        float spacing,
+        int lineSpacing = 2) {
+        TextLayout layout;
+        layout.texture = font.texture;
+        if (font.texture.id == 0 || text.empty() || font.glyphs == nullptr || font.baseSize == 0) {
+            return layout;
+        }
+
+        const float scale = fontSize / static_cast<float>(font.baseSize);
+        const float padding = static_cast<float>(font.glyphPadding);
+        // ::DrawTextEx() keeps the line offset as an int.
+        int drawY = 0;
+        float drawX = 0.0f;
+        // ::MeasureTextEx() sums unscaled advances, and counts codepoints for the spacing.
+        float lineWidth = 0.0f;
+        float maxWidth = 0.0f;
+        float height = fontSize;
+        int lineCodepoints = 0;
+        int maxCodepoints = 0;
+
+        // ::GetCodepointNext() reads up to four bytes, so decode from a terminated copy.
+        const std::string terminated(text);
+        const std::size_t length = std::strlen(terminated.c_str());
+        layout.glyphs.reserve(length);
+        for (std::size_t i = 0; i < length;) {
+            int byteCount = 0;
+            const int codepoint = ::GetCodepointNext(terminated.c_str() + i, &byteCount);
+            i += static_cast<std::size_t>(byteCount);
+            const int index = lookup.GetIndex(codepoint);
+            const ::GlyphInfo& glyph = font.glyphs[index];
+            const ::Rectangle& rec = font.recs[index];
+
+            lineCodepoints++;
+            if (codepoint == '\n') {
+                drawY += static_cast<int>(fontSize + static_cast<float>(lineSpacing));
+                drawX = 0.0f;
+                maxWidth = std::max(maxWidth, lineWidth);
+                lineWidth = 0.0f;
+                lineCodepoints = 0;
+                height += fontSize + static_cast<float>(lineSpacing);
+            } else {
+                if (codepoint != ' ' && codepoint != '\t') {
+                    layout.glyphs.push_back({
+                        {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding},
+                        {drawX + static_cast<float>(glyph.offsetX) * scale - padding * scale,
+                         static_cast<float>(drawY) + static_cast<float>(glyph.offsetY) * scale - padding * scale,
+                         (rec.width + 2.0f * padding) * scale,
+                         (rec.height + 2.0f * padding) * scale}});
+                }
+                drawX += (glyph.advanceX == 0 ? rec.width : static_cast<float>(glyph.advanceX)) * scale + spacing;
+                lineWidth += glyph.advanceX > 0 ? static_cast<float>(glyph.advanceX)
+                                                : rec.width + static_cast<float>(glyph.offsetX);
+            }
+            maxCodepoints = std::max(maxCodepoints, lineCodepoints);
+        }
+        maxWidth = std::max(maxWidth, lineWidth);
+        layout.size = {maxWidth * scale + static_cast<float>(maxCodepoints - 1) * spacing, height};
+        return layout;
+    }
+
+    /**
+     * Draw the glyphs at a position, like ::DrawTextEx().
+     */
+    void Draw(::Vector2 position, ::Color tint = {255, 255, 255, 255}) const {
+        for (const Glyph& glyph : glyphs) {
+            ::DrawTexturePro(
+                texture,
+                glyph.source,
+                {position.x + glyph.dest.x, position.y + glyph.dest.y, glyph.dest.width, glyph.dest.height},
+                {0.0f, 0.0f},
+                0.0f,
+                tint);
+        }
+    }
+
+    /**
+     * Add the glyphs to a sprite batch.
+     */
+    void Draw(SpriteBatch& batch, ::Vector2 position, ::Color tint = {255, 255, 255, 255}, int layer = 0) const {
+        for (const Glyph& glyph : glyphs) {
+            batch.Draw(
+                texture,
+                glyph.source,
+                {position.x + glyph.dest.x, position.y + glyph.dest.y, glyph.dest.width, glyph.dest.height},
+                {0.0f, 0.0f},
+                0.0f,
+                tint,
+                layer);
+        }
+    }
+
+    /**
+     * Retrieve the memory used by the layout, in bytes.
+     */
+    [[nodiscard]] std::size_t GetMemoryUsage() const { return sizeof(TextLayout) + glyphs.capacity() * sizeof(Glyph); }
+};
+
+/**
+ * Least recently used cache of text layouts, keyed by font, text, size and spacing.
+ *
+ * Text that stays the same between frames, like HUD labels, is decoded and laid out once. The cache also keeps a
+ * GlyphLookup for every font it sees, so laying out new text doesn't search the glyphs linearly either. Layouts
+ * are evicted, least recently used first, once they take more than the memory budget.
+ *
+ * Fonts are told apart by their glyph and texture data. Call Forget() before unloading a font whose memory could
+ * be reused by another one. The cache is not thread-safe.
+ *
+ * @code
+ * raylib::TextLayoutCache& cache = raylib::TextLayoutCache::GetDefault();
+ * cache.Draw(font, "Score", {10, 10}, 20, 1, WHITE);
+ * ::Vector2 size = cache.Measure(font, "Score", 20, 1);
+ * @endcode
+ */
+class TextLayoutCache {
+public:
+    /**
+     * @param budget Memory for layouts, in bytes.
+     */
+    explicit TextLayoutCache(std::size_t budget = 1024 * 1024) : budget(budget) { }
+
+    TextLayoutCache(const TextLayoutCache&) = delete;
+    TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+    /**
+     * Retrieve the layout of a text, laying it out when it isn't cached. The reference stays valid until the next
+     * call that adds to the cache.
+     */
+    const TextLayout& Get(const ::Font& font, std::string_view text, float fontSize, float spacing) {
+        return GetOrBuild(font, nullptr, text, fontSize, spacing);
+    }
+
+    /**
+     * Retrieve the layout of a text, laying it out with the font's own glyph lookup when it isn't cached.
+     */
+    const TextLayout&
+    Get(const ::Font& font, const GlyphLookup& lookup, std::string_view text, float fontSize, float spacing) {
+        return GetOrBuild(font, &lookup, text, fontSize, spacing);
+    }
+
+    /**
+     * Measure text, like ::MeasureTextEx().
+     */
+    ::Vector2 Measure(const ::Font& font, std::string_view text, float fontSize, float spacing) {
+        return Get(font, text, fontSize, spacing).size;
+    }
+
+    /**
+     * Draw text, like ::DrawTextEx().
+     */
+    void Draw(
+        const ::Font& font,
+        std::string_view text,
+        ::Vector2 position,
+        float fontSize,
+        float spacing,
+        ::Color tint = {255, 255, 255, 255}) {
+        Get(font, text, fontSize, spacing).Draw(position, tint);
+    }
+
+    /**
+     * Retrieve the glyph lookup for a font, building it the first time the font is seen.
+     */
+    const GlyphLookup& GetLookup(const ::Font& font) {
+        const FontId id = FontKey(font);
+        auto found = lookups.find(id);
+        if (found == lookups.end()) {
+            found = lookups.emplace(id, GlyphLookup(font)).first;
+        }
+        return found->second;
+    }
+
+    /**
+     * Drop the layouts and the glyph lookup of a font.
+     */
+    void Forget(const ::Font& font) {
+        const FontId id = FontKey(font);
+        lookups.erase(id);
+        for (auto entry = order.begin(); entry != order.end();) {
+            if (entry->key.font == id) {
+                Remove(entry++);
+            } else {
+                ++entry;
+            }
+        }
+    }
+
+    /**
+     * Drop all layouts and glyph lookups.
+     */
+    void Clear() {
+        entries.clear();
+        order.clear();
+        lookups.clear();
+        usage = 0;
+    }
+
+    /**
+     * Set the memory for layouts, in bytes, evicting layouts when they take more.
+     */
+    void SetBudget(std::size_t bytes) {
+        budget = bytes;
+        Evict();
+    }
+
+    [[nodiscard]] std::size_t GetBudget() const { return budget; }
+
+    /**
+     * Set the extra space between lines, to match ::SetTextLineSpacing(). Drops the cached layouts.
+     */
+    void SetLineSpacing(int spacing) {
+        if (spacing != lineSpacing) {
+            lineSpacing = spacing;
+            entries.clear();
+            order.clear();
+            usage = 0;
+        }
+    }
+
+    [[nodiscard]] int GetLineSpacing() const { return lineSpacing; }
+
+    /**
+     * Retrieve the memory used by the cached layouts, in bytes.
+     */
+    [[nodiscard]] std::size_t GetMemoryUsage() const { return usage; }
+
+    /**
+     * Retrieve the number of cached layouts.
+     */
+    [[nodiscard]] std::size_t GetCount() const { return order.size(); }
+
+    /**
+     * Retrieve how many Get() calls found a cached layout.
+     */
+    [[nodiscard]] std::size_t GetHits() const { return hits; }
+
+    /**
+     * Retrieve how many Get() calls had to lay out the text.
+     */
+    [[nodiscard]] std::size_t GetMisses() const { return misses; }
+
+    /**
+     * The shared cache.
+     */
+    static TextLayoutCache& GetDefault() {
+        static TextLayoutCache cache;
+        return cache;
+    }
+private:
+    struct FontId {
+        const void* glyphs;
+        const void* recs;
+        unsigned int textureId;
+        int baseSize;
+        int glyphCount;
+
+        bool operator==(const FontId&) const = default;
+    };
+
+    struct Key {
+        FontId font;
+        float fontSize;
+        float spacing;
+        std::string text;
+    };
+
+    /**
+     * A key that refers to its text, so finding a cached layout doesn't copy the text.
+     */
+    struct KeyView {
+        FontId font;
+        float fontSize;
+        float spacing;
+        std::string_view text;
+
+        KeyView(FontId font, float fontSize, float spacing, std::string_view text)
+            : font(font), fontSize(fontSize), spacing(spacing), text(text) { }
+        explicit KeyView(const Key& key) : KeyView(key.font, key.fontSize, key.spacing, key.text) { }
+    };
+
+    static std::size_t Combine(std::size_t seed, std::size_t value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+    }
+
+    struct FontHash {
+        std::size_t operator()(const FontId& id) const {
+            std::size_t seed = std::hash<const void*>()(id.glyphs);
+            seed = Combine(seed, std::hash<const void*>()(id.recs));
+            seed = Combine(seed, id.textureId);
+            seed = Combine(seed, static_cast<std::size_t>(id.baseSize));
+            return Combine(seed, static_cast<std::size_t>(id.glyphCount));
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const KeyView& key) const {
+            std::size_t seed = FontHash()(key.font);
+            seed = Combine(seed, std::hash<float>()(key.fontSize));
+            seed = Combine(seed, std::hash<float>()(key.spacing));
+            return Combine(seed, std::hash<std::string_view>()(key.text));
+        }
+    };
+
+    struct KeyEqual {
+        bool operator()(const KeyView& a, const KeyView& b) const {
+            return a.font == b.font && a.fontSize == b.fontSize && a.spacing == b.spacing && a.text == b.text;
+        }
+    };
+
+    struct Entry {
+        Key key;
+        TextLayout layout;
+        std::size_t bytes{0};
+    };
+
+    static FontId FontKey(const ::Font& font) {
+        return {font.glyphs, font.recs, font.texture.id, font.baseSize, font.glyphCount};
+    }
+
+    const TextLayout&
+    GetOrBuild(const ::Font& font, const GlyphLookup* lookup, std::string_view text, float fontSize, float spacing) {
+        const KeyView view{FontKey(font), fontSize, spacing, text};
+        const auto found = entries.find(view);
+        if (found != entries.end()) {
+            hits++;
+            order.splice(order.begin(), order, found->second);
+            return found->second->layout;
+        }
+
+        misses++;
+        const GlyphLookup& glyphs = lookup != nullptr ? *lookup : GetLookup(font);
+        order.push_front({
+            {view.font, fontSize, spacing, std::string(text)},
+            TextLayout::Build(font, glyphs, text, fontSize, spacing, lineSpacing)});
+        Entry& entry = order.front();
+        entry.bytes = entry.layout.GetMemoryUsage() + entry.key.text.capacity() + sizeof(Entry) + sizeof(KeyView) * 2;
+        usage += entry.bytes;
+        // The list nodes don't move, so the map's key can refer to the entry's text.
+        entries.emplace(KeyView(entry.key), order.begin());
+        Evict();
+        return entry.layout;
+    }
+
+    void Remove(std::list<Entry>::iterator entry) {
+        usage -= entry->bytes;
+        entries.erase(KeyView(entry->key));
+        order.erase(entry);
+    }
+
+    /**
+     * Drop the least recently used layouts until the rest fit the budget, keeping at least the newest one.
+     */
+    void Evict() {
+        while (usage > budget && order.size() > 1) {
+            Remove(std::prev(order.end()));
+        }
+    }
+
+    std::size_t budget;
+    std::size_t usage{0};
+    std::size_t hits{0};
+    std::size_t misses{0};
+    int lineSpacing{2};
+    /** Most recently used first */
+    std::list<Entry> order;
+    std::unordered_map<KeyView, std::list<Entry>::iterator, KeyHash, KeyEqual> entries;
+    std::unordered_map<FontId, GlyphLookup, FontHash> lookups;
+};
+} // namespace raylib
+
+using RTextLayout = raylib::TextLayout;
+using RTextLayoutCache = raylib::TextLayoutCache;
+
+#endif // RAYLIB_CPP_INCLUDE_TEXTLAYOUT_HPP_
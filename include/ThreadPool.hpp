@@ -0,0 +1,500 @@
+#ifndef RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
+#define RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace raylib {
+/**
+ * Counts unfinished jobs, so that other jobs can depend on them, or a thread can wait for them.
+ *
+ * ThreadPool::Submit() increments the count of the given counter, and the job decrements it when it has run. Jobs
+ * submitted with a counter as their dependency are queued once its count drops to zero. A counter must outlive
+ * the jobs that signal it, and can be reused once it is done.
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /**
+     * Waits for a job that is still signalling the counter.
+     */
+    ~JobCounter() { std::lock_guard<std::mutex> lock(mutex); }
+
+    /**
+     * Retrieve the number of jobs that have not finished yet.
+     */
+    [[nodiscard]] std::size_t GetCount() const { return count.load(std::memory_order_acquire); }
+
+    /**
+     * Retrieve whether all jobs signalling the counter have finished.
+     */
+    [[nodiscard]] bool IsDone() const { return GetCount() == 0; }
+private:
+    friend class ThreadPool;
+
+    void Add() {
+        std::lock_guard<std::mutex> lock(mutex);
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Decrement the count, and run the continuations when it reaches zero.
+     */
+    void Done() {
+        std::vector<std::function<void()>> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                ready.swap(continuations);
+            }
+        }
+        for (auto& continuation : ready) {
+            continuation();
+        }
+    }
+
+    /**
+     * Run `continuation` once the count reaches zero, or right away when it already is zero.
+     */
+    void Then(std::function<void()> continuation) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (count.load(std::memory_order_relaxed) > 0) {
+                continuations.push_back(std::move(continuation));
+                return;
+            }
+        }
+        continuation();
+    }
+
+    // Guards the continuations, and is held while the count drops, so the destructor can't run in the middle.
+    mutable std::mutex mutex;
+    std::atomic<std::size_t> count{0};
+    std::vector<std::function<void()>> continuations;
+};
+
+/**
+ * Work-stealing thread pool.
+ *
+ * Every worker owns a task queue. Workers pop their own queue from the back, and steal from the front of the
+ * other queues when theirs runs dry, which keeps uneven workloads balanced. The thread calling ParallelFor()
+ * also runs tasks while it waits, so a pool with zero workers runs everything serially on the caller.
+ *
+ * Jobs can be chained with a JobCounter, and jobs that must run on the main thread, like anything touching the
+ * graphics context, go to a separate queue run by RunMainThreadTasks(). Tasks must not throw.
+ *
+ * @code
+ * raylib::JobCounter decoded, uploaded;
+ * pool.Submit([&] { image.Load("texture.png"); }, decoded);
+ * pool.SubmitMainThread([&] { texture.Load(image); }, decoded, uploaded);
+ * pool.Wait(uploaded);
+ * @endcode
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * Start the given number of background worker threads. The constructing thread becomes the main thread.
+     */
+    explicit ThreadPool(unsigned int workerCount = DefaultWorkerCount())
+        : mainThread(std::this_thread::get_id()) {
+        // One queue per worker, plus one for tasks submitted from outside the pool.
+        for (unsigned int i = 0; i <= workerCount; i++) {
+            queues.emplace_back(std::make_unique<Queue>());
+        }
+        for (unsigned int i = 0; i < workerCount; i++) {
+            workers.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Finishes all queued tasks, and joins the worker threads. Without workers, the destructing thread runs the
+     * queued tasks itself. Main thread tasks that haven't run are dropped, and jobs still waiting for a dependency
+     * must not become ready afterwards.
+     */
+    ~ThreadPool() {
+        while (workers.empty() && RunPending()) {
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Retrieve the number of background worker threads.
+     */
+    [[nodiscard]] unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    /**
+     * Retrieve how many threads run tasks during ParallelFor(), counting the caller.
+     */
+    [[nodiscard]] unsigned int GetConcurrency() const { return GetWorkerCount() + 1; }
+
+    /**
+     * Queue a task. Tasks submitted from a worker go to that worker's own queue.
+     */
+    void Submit(Task task) {
+        Push(CurrentQueue(), std::move(task));
+        wake.notify_one();
+    }
+
+    /**
+     * Queue a task that decrements `counter` when it has run.
+     */
+    void Submit(Task task, JobCounter& counter) {
+        counter.Add();
+        Submit(Signalling(std::move(task), counter));
+    }
+
+    /**
+     * Queue a task once every job signalling `dependency` has finished. The task decrements `counter` when it has
+     * run. To depend on several jobs, have them all signal the same counter.
+     */
+    void Submit(Task task, JobCounter& dependency, JobCounter& counter) {
+        counter.Add();
+        dependency.Then([this, task = Signalling(std::move(task), counter)] { Submit(task); });
+    }
+
+    /**
+     * Queue a task for the main thread, which runs it in RunMainThreadTasks() or Wait().
+     */
+    void SubmitMainThread(Task task) {
+        std::lock_guard<std::mutex> lock(mainQueue.mutex);
+        mainQueue.tasks.push_back(std::move(task));
+    }
+
+    /**
+     * Queue a task for the main thread, that decrements `counter` when it has run.
+     */
+    void SubmitMainThread(Task task, JobCounter& counter) {
+        counter.Add();
+        SubmitMainThread(Signalling(std::move(task), counter));
+    }
+
+    /**
+     * Queue a task for the main thread once every job signalling `dependency` has finished. The task decrements
+     * `counter` when it has run.
+     */
+    void SubmitMainThread(Task task, JobCounter& dependency, JobCounter& counter) {
+        counter.Add();
+        dependency.Then([this, task = Signalling(std::move(task), counter)] { SubmitMainThread(task); });
+    }
+
+    /**
+     * Run queued main thread tasks, in the order they were queued. Call it once per frame from the main thread.
+     *
+     * @param budget Seconds to spend. At least one task runs per call, so that progress is made.
+     *
+     * @return The number of tasks run.
+     */
+    std::size_t RunMainThreadTasks(float budget = 0.002f) {
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed = [start] {
+            return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        std::size_t count = 0;
+        while ((count == 0 || elapsed() < budget) && RunMainThreadTask()) {
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * Retrieve the number of tasks waiting for the main thread.
+     */
+    [[nodiscard]] std::size_t GetMainThreadTaskCount() const {
+        std::lock_guard<std::mutex> lock(mainQueue.mutex);
+        return mainQueue.tasks.size();
+    }
+
+    /**
+     * Retrieve whether the calling thread is the pool's main thread.
+     */
+    [[nodiscard]] bool IsMainThread() const { return std::this_thread::get_id() == mainThread; }
+
+    /**
+     * Block until every job signalling `counter` has finished. The calling thread runs pool tasks meanwhile, and
+     * main thread tasks too when it is the main thread.
+     */
+    void Wait(const JobCounter& counter) {
+        const bool main = IsMainThread();
+        while (!counter.IsDone()) {
+            if (!RunPending() && !(main && RunMainThreadTask())) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * Run one queued task on the calling thread, if there is one.
+     *
+     * @return True when a task was run.
+     */
+    bool RunPending() {
+        Task task;
+        if (!Pop(CurrentQueue(), task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    /**
+     * Split [begin, end) into chunks of at most `grain` indices, and call fn(chunkBegin, chunkEnd) for each
+     * chunk in parallel. Blocks until every chunk is done.
+     *
+     * @throws Rethrows the first exception thrown by `fn`, after all chunks have finished.
+     */
+    template<typename F>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& fn) {
+        if (end <= begin) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t count = (end - begin + grain - 1) / grain;
+        if (count == 1 || workers.empty()) {
+            fn(begin, end);
+            return;
+        }
+
+        struct State {
+            std::atomic<std::size_t> remaining;
+            std::mutex mutex;
+            std::exception_ptr error;
+        } state{{count}, {}, {}};
+
+        auto runChunk = [&state, &fn, begin, end, grain](std::size_t chunk) {
+            const std::size_t first = begin + chunk * grain;
+            try {
+                fn(first, std::min(first + grain, end));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (!state.error) {
+                    state.error = std::current_exception();
+                }
+            }
+            state.remaining.fetch_sub(1, std::memory_order_acq_rel);
+        };
+
+        // Deal the chunks out over the worker queues, so each worker starts with its own share.
+        for (std::size_t chunk = 1; chunk < count; chunk++) {
+            Push(chunk % workers.size(), [&runChunk, chunk] { runChunk(chunk); });
+        }
+        wake.notify_all();
+
+        runChunk(0);
+        while (state.remaining.load(std::memory_order_acquire) > 0) {
+            if (!RunPending()) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (state.error) {
+            std::rethrow_exception(state.error);
+        }
+    }
+
+    /**
+     * Like ParallelFor(), where fn(chunkBegin, chunkEnd, results) appends each chunk's results to a vector of its
+     * own. The vectors are then appended to `out` in the order of the chunks, so the results come in the same order
+     * as from one serial call over the whole range.
+     *
+     * @throws Rethrows the first exception thrown by `fn`, after all chunks have finished.
+     */
+    template<typename T, typename F>
+    void ParallelCollect(std::size_t begin, std::size_t end, std::size_t grain, std::vector<T>& out, F&& fn) {
+        if (end <= begin) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        if (workers.empty() || end - begin <= grain) {
+            fn(begin, end, out);
+            return;
+        }
+
+        std::vector<std::vector<T>> chunks((end - begin + grain - 1) / grain);
+        ParallelFor(begin, end, grain, [&](std::size_t first, std::size_t last) {
+            for (std::size_t chunk = first; chunk < last; chunk += grain) {
+                fn(chunk, std::min(last, chunk + grain), chunks[(chunk - begin) / grain]);
+            }
+        });
+        std::size_t total = out.size();
+        for (const std::vector<T>& chunk : chunks) {
+            total += chunk.size();
+        }
+        out.reserve(total);
+        for (const std::vector<T>& chunk : chunks) {
+            out.insert(out.end(), chunk.begin(), chunk.end());
+        }
+    }
+
+    /**
+     * Queue fn(chunkBegin, chunkEnd) for every chunk of at most `grain` indices in [begin, end), and return right
+     * away. Each chunk decrements `counter` when it is done, so other jobs can depend on the whole loop.
+     */
+    template<typename F>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& fn, JobCounter& counter) {
+        grain = std::max<std::size_t>(grain, 1);
+        auto shared = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+        for (std::size_t first = begin; first < end; first += std::min(grain, end - first)) {
+            const std::size_t last = first + std::min(grain, end - first);
+            Submit([shared, first, last] { (*shared)(first, last); }, counter);
+        }
+    }
+
+    /**
+     * The shared pool, with one worker less than the hardware has threads.
+     */
+    static ThreadPool& GetDefault() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * One worker less than the number of hardware threads, since the calling thread helps out.
+     */
+    static unsigned int DefaultWorkerCount() {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+private:
+    struct Queue {
+        mutable std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    static Task Signalling(Task task, JobCounter& counter) {
+        return [task = std::move(task), &counter] {
+            task();
+            counter.Done();
+        };
+    }
+
+    bool RunMainThreadTask() {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(mainQueue.mutex);
+            if (mainQueue.tasks.empty()) {
+                return false;
+            }
+            task = std::move(mainQueue.tasks.front());
+            mainQueue.tasks.pop_front();
+        }
+        task();
+        return true;
+    }
+
+    struct ThreadInfo {
+        const ThreadPool* pool{nullptr};
+        std::size_t index{0};
+    };
+
+    static ThreadInfo& CurrentThread() {
+        thread_local ThreadInfo info;
+        return info;
+    }
+
+    /**
+     * The queue owned by the calling thread: its worker queue, or the shared one for outside threads.
+     */
+    std::size_t CurrentQueue() const {
+        const ThreadInfo& info = CurrentThread();
+        return info.pool == this ? info.index : workers.size();
+    }
+
+    void Push(std::size_t queue, Task task) {
+        // Counted before it can be popped, so a thief never decrements the count below zero.
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            queued++;
+        }
+        try {
+            std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+            queues[queue]->tasks.push_back(std::move(task));
+        } catch (...) {
+            queued.fetch_sub(1, std::memory_order_acq_rel);
+            throw;
+        }
+    }
+
+    /**
+     * Take the newest task from the own queue, or steal the oldest one from another queue.
+     */
+    bool Pop(std::size_t own, Task& task) {
+        if (queued.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        for (std::size_t i = 0; i < queues.size(); i++) {
+            const std::size_t index = (own + i) % queues.size();
+            Queue& queue = *queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            queued.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+        return false;
+    }
+
+    void WorkerLoop(std::size_t index) {
+        CurrentThread() = {this, index};
+        while (true) {
+            if (RunPending()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+            if (stopping && queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    Queue mainQueue;
+    std::thread::id mainThread;
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<std::size_t> queued{0};
+    bool stopping{false};
+};
+} // namespace raylib
+
+using RJobCounter = raylib::JobCounter;
+using RThreadPool = raylib::ThreadPool;
+
+#endif // RAYLIB_CPP_INCLUDE_THREADPOOL_HPP_
@@ -17,12 +17,12 @@ namespace raylib {
  */
 class Vector3 : public ::Vector3 {
 public:
-    Vector3(const ::Vector3& vec) : ::Vector3{vec.x, vec.y, vec.z} {}
+    constexpr Vector3(const ::Vector3& vec) : ::Vector3{vec.x, vec.y, vec.z} {}
 
-    Vector3(float x, float y, float z) : ::Vector3{x, y, z} {}
-    Vector3(float x, float y) : ::Vector3{x, y, 0} {}
-    Vector3(float x) : ::Vector3{x, 0, 0} {}
-    Vector3() {}
+    constexpr Vector3(float x, float y, float z) : ::Vector3{x, y, z} {}
+    constexpr Vector3(float x, float y) : ::Vector3{x, y, 0} {}
+    constexpr Vector3(float x) : ::Vector3{x, 0, 0} {}
+    constexpr Vector3() : ::Vector3{0, 0, 0} {}
 
     Vector3(::Color color) { set(ColorToHSV(color)); }
 
@@ -30,14 +30,14 @@ public:
     GETTERSETTER(float, Y, y)
     GETTERSETTER(float, Z, z)
 
-    Vector3& operator=(const ::Vector3& vector3) {
+    constexpr Vector3& operator=(const ::Vector3& vector3) {
         set(vector3);
         return *this;
     }
 
-    bool operator==(const ::Vector3& other) const { return x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator==(const ::Vector3& other) const { return x == other.x && y == other.y && z == other.z; }
 
-    bool operator!=(const ::Vector3& other) const { return !(*this == other); }
+    constexpr bool operator!=(const ::Vector3& other) const { return !(*this == other); }
 
     [[nodiscard]] std::string ToString() const { return TextFormat("Vector3(%f, %f, %f)", x, y, z); }
 
@@ -47,15 +47,17 @@ public:
     /**
      * Add two vectors
      */
-    [[nodiscard]] Vector3 Add(const ::Vector3& vector3) const { return Vector3Add(*this, vector3); }
+    [[nodiscard]] constexpr Vector3 Add(const ::Vector3& vector3) const {
+        return {x + vector3.x, y + vector3.y, z + vector3.z};
+    }
 
     /**
      * Add two vectors
      */
-    Vector3 operator+(const ::Vector3& vector3) const { return Vector3Add(*this, vector3); }
+    constexpr Vector3 operator+(const ::Vector3& vector3) const { return Add(vector3); }
 
-    Vector3& operator+=(const ::Vector3& vector3) {
-        set(Vector3Add(*this, vector3));
+    constexpr Vector3& operator+=(const ::Vector3& vector3) {
+        set(Add(vector3));
 
         return *this;
     }
@@ -63,15 +65,17 @@ public:
     /**
      * Subtract two vectors.
      */
-    [[nodiscard]] Vector3 Subtract(const ::Vector3& vector3) const { return Vector3Subtract(*this, vector3); }
+    [[nodiscard]] constexpr Vector3 Subtract(const ::Vector3& vector3) const {
+        return {x - vector3.x, y - vector3.y, z - vector3.z};
+    }
 
     /**
      * Subtract two vectors.
      */
-    Vector3 operator-(const ::Vector3& vector3) const { return Vector3Subtract(*this, vector3); }
+    constexpr Vector3 operator-(const ::Vector3& vector3) const { return Subtract(vector3); }
 
-    Vector3& operator-=(const ::Vector3& vector3) {
-        set(Vector3Subtract(*this, vector3));
+    constexpr Vector3& operator-=(const ::Vector3& vector3) {
+        set(Subtract(vector3));
 
         return *this;
     }
@@ -79,28 +83,30 @@ public:
     /**
      * Negate provided vector (invert direction)
      */
-    [[nodiscard]] Vector3 Negate() const { return Vector3Negate(*this); }
+    [[nodiscard]] constexpr Vector3 Negate() const { return {-x, -y, -z}; }
 
     /**
      * Negate provided vector (invert direction)
      */
-    Vector3 operator-() const { return Vector3Negate(*this); }
+    constexpr Vector3 operator-() const { return Negate(); }
 
     /**
      * Multiply vector by vector
      */
-    [[nodiscard]] Vector3 Multiply(const ::Vector3& vector3) const { return Vector3Multiply(*this, vector3); }
+    [[nodiscard]] constexpr Vector3 Multiply(const ::Vector3& vector3) const {
+        return {x * vector3.x, y * vector3.y, z * vector3.z};
+    }
 
     /**
      * Multiply vector by vector
      */
-    Vector3 operator*(const ::Vector3& vector3) const { return Vector3Multiply(*this, vector3); }
+    constexpr Vector3 operator*(const ::Vector3& vector3) const { return Multiply(vector3); }
 
     /**
      * Multiply vector by vector
      */
-    Vector3& operator*=(const ::Vector3& vector3) {
-        set(Vector3Multiply(*this, vector3));
+    constexpr Vector3& operator*=(const ::Vector3& vector3) {
+        set(Multiply(vector3));
 
         return *this;
     }
@@ -108,18 +114,18 @@ public:
     /**
      * Multiply vector by scalar
      */
-    [[nodiscard]] Vector3 Scale(const float scaler) const { return Vector3Scale(*this, scaler); }
+    [[nodiscard]] constexpr Vector3 Scale(const float scaler) const { return {x * scaler, y * scaler, z * scaler}; }
 
     /**
      * Multiply vector by scalar
      */
-    Vector3 operator*(const float scaler) const { return Vector3Scale(*this, scaler); }
+    constexpr Vector3 operator*(const float scaler) const { return Scale(scaler); }
 
     /**
      * Multiply vector by scalar
      */
-    Vector3& operator*=(const float scaler) {
-        set(Vector3Scale(*this, scaler));
+    constexpr Vector3& operator*=(const float scaler) {
+        set(Scale(scaler));
 
         return *this;
     }
@@ -127,17 +133,19 @@ public:
     /**
      * Divide vector by vector
      */
-    [[nodiscard]] Vector3 Divide(const ::Vector3& vector3) const { return Vector3Divide(*this, vector3); }
+    [[nodiscard]] constexpr Vector3 Divide(const ::Vector3& vector3) const {
+        return {x / vector3.x, y / vector3.y, z / vector3.z};
+    }
 
     /**
      * Divide vector by vector
      */
-    Vector3 operator/(const ::Vector3& vector3) const { return Vector3Divide(*this, vector3); }
+    constexpr Vector3 operator/(const ::Vector3& vector3) const { return Divide(vector3); }
 
     /**
      * Divide vector by vector
      */
-    Vector3& operator/=(const ::Vector3& vector3) {
+    constexpr Vector3& operator/=(const ::Vector3& vector3) {
         x /= vector3.x;
         y /= vector3.y;
         z /= vector3.z;
@@ -148,17 +156,17 @@ public:
     /**
      * Divide a vector by a value.
      */
-    [[nodiscard]] Vector3 Divide(const float div) const { return ::Vector3{x / div, y / div, z / div}; }
+    [[nodiscard]] constexpr Vector3 Divide(const float div) const { return {x / div, y / div, z / div}; }
 
     /**
      * Divide a vector by a value.
      */
-    Vector3 operator/(const float div) const { return Divide(div); }
+    constexpr Vector3 operator/(const float div) const { return Divide(div); }
 
     /**
      * Divide a vector by a value.
      */
-    Vector3& operator/=(const float div) {
+    constexpr Vector3& operator/=(const float div) {
         x /= div;
         y /= div;
         z /= div;
@@ -174,17 +182,23 @@ public:
     /**
      * Calculate vector square length
      */
-    [[nodiscard]] float LengthSqr() const { return Vector3LengthSqr(*this); }
+    [[nodiscard]] constexpr float LengthSqr() const { return x * x + y * y + z * z; }
 
     [[nodiscard]] Vector3 Normalize() const { return Vector3Normalize(*this); }
 
-    [[nodiscard]] float DotProduct(const ::Vector3& vector3) const { return Vector3DotProduct(*this, vector3); }
+    [[nodiscard]] constexpr float DotProduct(const ::Vector3& vector3) const {
+        return (x * vector3.x + y * vector3.y + z * vector3.z);
+    }
 
     [[nodiscard]] float Distance(const ::Vector3& vector3) const { return Vector3Distance(*this, vector3); }
 
-    [[nodiscard]] Vector3 Lerp(const ::Vector3& vector3, const float amount) const { return Vector3Lerp(*this, vector3, amount); }
+    [[nodiscard]] constexpr Vector3 Lerp(const ::Vector3& vector3, const float amount) const {
+        return {x + amount * (vector3.x - x), y + amount * (vector3.y - y), z + amount * (vector3.z - z)};
+    }
 
-    [[nodiscard]] Vector3 CrossProduct(const ::Vector3& vector3) const { return Vector3CrossProduct(*this, vector3); }
+    [[nodiscard]] constexpr Vector3 CrossProduct(const ::Vector3& vector3) const {
+        return {y * vector3.z - z * vector3.y, z * vector3.x - x * vector3.z, x * vector3.y - y * vector3.x};
+    }
 
     [[nodiscard]] Vector3 Perpendicular() const { return Vector3Perpendicular(*this); }
 
@@ -194,13 +208,24 @@ public:
 
     void OrthoNormalize(::Vector3* vector3) { Vector3OrthoNormalize(this, vector3); }
 
-    [[nodiscard]] Vector3 Transform(const ::Matrix& matrix) const { return Vector3Transform(*this, matrix); }
+    [[nodiscard]] constexpr Vector3 Transform(const ::Matrix& matrix) const {
+        return {
+            matrix.m0 * x + matrix.m4 * y + matrix.m8 * z + matrix.m12,
+            matrix.m1 * x + matrix.m5 * y + matrix.m9 * z + matrix.m13,
+            matrix.m2 * x + matrix.m6 * y + matrix.m10 * z + matrix.m14};
+    }
 
     [[nodiscard]] Vector3 RotateByQuaternion(const ::Quaternion& quaternion) const {
         return Vector3RotateByQuaternion(*this, quaternion);
     }
 
-    [[nodiscard]] Vector3 Reflect(const ::Vector3& normal) const { return Vector3Reflect(*this, normal); }
+    [[nodiscard]] constexpr Vector3 Reflect(const ::Vector3& normal) const {
+        const float dotProduct = DotProduct(normal);
+        return {
+            x - (2.0f * normal.x) * dotProduct,
+            y - (2.0f * normal.y) * dotProduct,
+            z - (2.0f * normal.z) * dotProduct};
+    }
 
     [[nodiscard]] Vector3 Min(const ::Vector3& vector3) const { return Vector3Min(*this, vector3); }
 
@@ -210,9 +235,9 @@ public:
         return Vector3Barycenter(*this, a, b, c);
     }
 
-    static Vector3 Zero() { return Vector3Zero(); }
+    static constexpr Vector3 Zero() { return {0.0f, 0.0f, 0.0f}; }
 
-    static Vector3 One() { return Vector3One(); }
+    static constexpr Vector3 One() { return {1.0f, 1.0f, 1.0f}; }
 #endif
 
     void DrawLine3D(const ::Vector3& endPos, ::Color color) const { ::DrawLine3D(*this, endPos, color); }
@@ -262,7 +287,7 @@ public:
         return CheckCollisionSpheres(*this, radius1, center2, radius2);
     }
 protected:
-    void set(const ::Vector3& vec) {
+    constexpr void set(const ::Vector3& vec) {
         x = vec.x;
         y = vec.y;
         z = vec.z;
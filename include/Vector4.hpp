@@ -18,14 +18,14 @@ namespace raylib {
  */
 class Vector4 : public ::Vector4 {
 public:
-    Vector4(const ::Vector4& vec) : ::Vector4{vec.x, vec.y, vec.z, vec.w} {}
+    constexpr Vector4(const ::Vector4& vec) : ::Vector4{vec.x, vec.y, vec.z, vec.w} {}
 
-    Vector4(float x, float y, float z, float w) : ::Vector4{x, y, z, w} {}
-    Vector4(float x, float y, float z) : ::Vector4{x, y, z, 0} {}
-    Vector4(float x, float y) : ::Vector4{x, y, 0, 0} {}
-    Vector4(float x) : ::Vector4{x, 0, 0, 0} {}
-    Vector4() : ::Vector4{0, 0, 0, 0} {}
-    Vector4(::Rectangle rectangle) : ::Vector4{rectangle.x, rectangle.y, rectangle.width, rectangle.height} {}
+    constexpr Vector4(float x, float y, float z, float w) : ::Vector4{x, y, z, w} {}
+    constexpr Vector4(float x, float y, float z) : ::Vector4{x, y, z, 0} {}
+    constexpr Vector4(float x, float y) : ::Vector4{x, y, 0, 0} {}
+    constexpr Vector4(float x) : ::Vector4{x, 0, 0, 0} {}
+    constexpr Vector4() : ::Vector4{0, 0, 0, 0} {}
+    constexpr Vector4(::Rectangle rectangle) : ::Vector4{rectangle.x, rectangle.y, rectangle.width, rectangle.height} {}
 
     Vector4(::Color color) { set(ColorNormalize(color)); }
 
@@ -34,31 +34,49 @@ public:
     GETTERSETTER(float, Z, z)
     GETTERSETTER(float, W, w)
 
-    Vector4& operator=(const ::Vector4& vector4) {
+    constexpr Vector4& operator=(const ::Vector4& vector4) {
         set(vector4);
         return *this;
     }
 
-    bool operator==(const ::Vector4& other) const {
+    constexpr bool operator==(const ::Vector4& other) const {
         return x == other.x && y == other.y && z == other.z && w == other.w;
     }
 
-    bool operator!=(const ::Vector4& other) const { return !(*this == other); }
+    constexpr bool operator!=(const ::Vector4& other) const { return !(*this == other); }
 
-    [[nodiscard]] ::Rectangle ToRectangle() const { return {x, y, z, w}; }
+    [[nodiscard]] constexpr ::Rectangle ToRectangle() const { return {x, y, z, w}; }
 
-    operator ::Rectangle() const { return {x, y, z, w}; }
+    constexpr operator ::Rectangle() const { return {x, y, z, w}; }
 
     [[nodiscard]] std::string ToString() const { return TextFormat("Vector4(%f, %f, %f, %f)", x, y, z, w); }
 
     operator std::string() const { return ToString(); }
 
 #ifndef RAYLIB_CPP_NO_MATH
-    [[nodiscard]] Vector4 Multiply(const ::Vector4& vector4) const { return QuaternionMultiply(*this, vector4); }
+    /**
+     * Calculate two quaternion multiplication
+     */
+    [[nodiscard]] constexpr Vector4 Multiply(const ::Vector4& vector4) const {
+        return {
+            x * vector4.w + w * vector4.x + y * vector4.z - z * vector4.y,
+            y * vector4.w + w * vector4.y + z * vector4.x - x * vector4.z,
+            z * vector4.w + w * vector4.z + x * vector4.y - y * vector4.x,
+            w * vector4.w - x * vector4.x - y * vector4.y - z * vector4.z};
+    }
 
-    Vector4 operator*(const ::Vector4& vector4) const { return QuaternionMultiply(*this, vector4); }
+    constexpr Vector4 operator*(const ::Vector4& vector4) const { return Multiply(vector4); }
 
-    [[nodiscard]] Vector4 Lerp(const ::Vector4& vector4, float amount) const { return QuaternionLerp(*this, vector4, amount); }
+    /**
+     * Calculate linear interpolation between two quaternions
+     */
+    [[nodiscard]] constexpr Vector4 Lerp(const ::Vector4& vector4, float amount) const {
+        return {
+            x + amount * (vector4.x - x),
+            y + amount * (vector4.y - y),
+            z + amount * (vector4.z - z),
+            w + amount * (vector4.w - w)};
+    }
 
     [[nodiscard]] Vector4 Nlerp(const ::Vector4& vector4, float amount) const { return QuaternionNlerp(*this, vector4, amount); }
 
@@ -85,9 +103,18 @@ public:
         return { outAxis, outAngle };
     }
 
-    [[nodiscard]] Vector4 Transform(const ::Matrix& matrix) const { return ::QuaternionTransform(*this, matrix); }
+    /**
+     * Transform a quaternion given a transformation matrix
+     */
+    [[nodiscard]] constexpr Vector4 Transform(const ::Matrix& matrix) const {
+        return {
+            matrix.m0 * x + matrix.m4 * y + matrix.m8 * z + matrix.m12 * w,
+            matrix.m1 * x + matrix.m5 * y + matrix.m9 * z + matrix.m13 * w,
+            matrix.m2 * x + matrix.m6 * y + matrix.m10 * z + matrix.m14 * w,
+            matrix.m3 * x + matrix.m7 * y + matrix.m11 * z + matrix.m15 * w};
+    }
 
-    static Vector4 Identity() { return ::QuaternionIdentity(); }
+    static constexpr Vector4 Identity() { return {0.0f, 0.0f, 0.0f, 1.0f}; }
 
     static Vector4 FromVector3ToVector3(const ::Vector3& from, const ::Vector3& to) {
         return ::QuaternionFromVector3ToVector3(from, to);
@@ -114,7 +141,7 @@ public:
 
     operator Color() const { return ColorFromNormalized(); }
 protected:
-    void set(const ::Vector4& vec4) {
+    constexpr void set(const ::Vector4& vec4) {
         x = vec4.x;
         y = vec4.y;
         z = vec4.z;
@@ -0,0 +1,375 @@
+#ifndef RAYLIB_CPP_INCLUDE_VECTOREXPRESSION_HPP_
+#define RAYLIB_CPP_INCLUDE_VECTOREXPRESSION_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "./RaylibException.hpp"
+#include "./Vector2.hpp"
+#include "./Vector3.hpp"
+#include "./Vector4.hpp"
+#include "./raylib-cpp-simd.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Opt-in lazy vector arithmetic.
+ *
+ * Wrapping operands in expr::Lazy() makes +, -, * and / build an expression instead of computing each step into a
+ * temporary. Nothing is computed until the expression is evaluated: Evaluate() for single vectors, or Assign() for
+ * arrays, which runs the whole expression in one pass over the arrays, with SIMD when no operand is a single vector.
+ *
+ * @code
+ * std::vector<raylib::Vector3> positions, velocities;
+ * raylib::expr::Assign(positions, raylib::expr::Lazy(positions) + raylib::expr::Lazy(velocities) * dt - gravity);
+ *
+ * raylib::Vector3 r = raylib::expr::Evaluate(raylib::expr::Lazy(a) + b * 2.0f - c);
+ * @endcode
+ */
+namespace expr {
+namespace detail {
+/**
+ * The raylib-cpp vector type of a raylib or raylib-cpp vector, like raylib::Vector3 for ::Vector3.
+ */
+template<typename V>
+struct VectorType { };
+template<typename V>
+    requires std::is_base_of_v<::Vector2, V>
+struct VectorType<V> {
+    using type = raylib::Vector2;
+    static constexpr std::size_t components = 2;
+};
+template<typename V>
+    requires std::is_base_of_v<::Vector3, V>
+struct VectorType<V> {
+    using type = raylib::Vector3;
+    static constexpr std::size_t components = 3;
+};
+template<typename V>
+    requires std::is_base_of_v<::Vector4, V>
+struct VectorType<V> {
+    using type = raylib::Vector4;
+    static constexpr std::size_t components = 4;
+};
+
+template<typename V>
+concept Vector = requires { typename VectorType<std::remove_cvref_t<V>>::type; } &&
+                 sizeof(std::remove_cvref_t<V>) == sizeof(float) * VectorType<std::remove_cvref_t<V>>::components;
+
+template<typename V>
+using VectorOf = typename VectorType<V>::type;
+
+template<typename V>
+constexpr V Splat(float value) {
+    if constexpr (VectorType<V>::components == 2) {
+        return V{value, value};
+    } else if constexpr (VectorType<V>::components == 3) {
+        return V{value, value, value};
+    } else {
+        return V{value, value, value, value};
+    }
+}
+
+template<typename V, typename Op>
+constexpr V Zip(const V& a, const V& b) {
+    if constexpr (VectorType<V>::components == 2) {
+        return V{Op::Apply(a.x, b.x), Op::Apply(a.y, b.y)};
+    } else if constexpr (VectorType<V>::components == 3) {
+        return V{Op::Apply(a.x, b.x), Op::Apply(a.y, b.y), Op::Apply(a.z, b.z)};
+    } else {
+        return V{Op::Apply(a.x, b.x), Op::Apply(a.y, b.y), Op::Apply(a.z, b.z), Op::Apply(a.w, b.w)};
+    }
+}
+
+struct AddOp {
+    static constexpr float Apply(float a, float b) { return a + b; }
+    static simd::floatv Apply(simd::floatv a, simd::floatv b) { return simd::Add(a, b); }
+};
+struct SubtractOp {
+    static constexpr float Apply(float a, float b) { return a - b; }
+    static simd::floatv Apply(simd::floatv a, simd::floatv b) { return simd::Sub(a, b); }
+};
+struct MultiplyOp {
+    static constexpr float Apply(float a, float b) { return a * b; }
+    static simd::floatv Apply(simd::floatv a, simd::floatv b) { return simd::Mul(a, b); }
+};
+struct DivideOp {
+    static constexpr float Apply(float a, float b) { return a / b; }
+    static simd::floatv Apply(simd::floatv a, simd::floatv b) { return simd::Div(a, b); }
+};
+
+/**
+ * Size of a combined expression: 0 for single vectors, which broadcast to any array size.
+ */
+constexpr std::size_t CombineSizes(std::size_t a, std::size_t b) {
+    if (a != 0 && b != 0 && a != b) {
+        throw RaylibException("Vector expression array sizes do not match");
+    }
+    return a != 0 ? a : b;
+}
+} // namespace detail
+
+/**
+ * Base of every expression node.
+ *
+ * Nodes provide `Element(i)`, the value at array index i, and for expressions without single-vector operands
+ * (`broadcastsVector` false), `Component(j)` and `Packet(j)`, the floats at flat float index j of the arrays.
+ */
+struct Expression { };
+
+template<typename E>
+concept IsExpression = std::is_base_of_v<Expression, std::remove_cvref_t<E>>;
+
+/**
+ * A single vector, used for every array element.
+ */
+template<typename V>
+struct VectorLeaf : Expression {
+    using value_type = V;
+    static constexpr bool broadcastsVector = true;
+
+    V value;
+
+    constexpr explicit VectorLeaf(const V& value) : value(value) { }
+    [[nodiscard]] constexpr std::size_t size() const { return 0; }
+    [[nodiscard]] constexpr V Element(std::size_t) const { return value; }
+};
+
+/**
+ * A scalar, used for every component.
+ */
+template<typename V>
+struct ScalarLeaf : Expression {
+    using value_type = V;
+    static constexpr bool broadcastsVector = false;
+
+    float value;
+
+    constexpr explicit ScalarLeaf(float value) : value(value) { }
+    [[nodiscard]] constexpr std::size_t size() const { return 0; }
+    [[nodiscard]] constexpr V Element(std::size_t) const { return detail::Splat<V>(value); }
+    [[nodiscard]] constexpr float Component(std::size_t) const { return value; }
+    [[nodiscard]] simd::floatv Packet(std::size_t) const { return simd::Set(value); }
+};
+
+/**
+ * An array of vectors. The array must outlive the expression.
+ */
+template<typename V, typename Stored>
+struct SpanLeaf : Expression {
+    using value_type = V;
+    static constexpr bool broadcastsVector = false;
+
+    std::span<const Stored> values;
+
+    constexpr explicit SpanLeaf(std::span<const Stored> values) : values(values) { }
+    [[nodiscard]] constexpr std::size_t size() const { return values.size(); }
+    [[nodiscard]] constexpr V Element(std::size_t i) const { return V(values[i]); }
+    [[nodiscard]] float Component(std::size_t j) const { return Floats()[j]; }
+    [[nodiscard]] simd::floatv Packet(std::size_t j) const { return simd::Load(Floats() + j); }
+    [[nodiscard]] const float* Floats() const { return reinterpret_cast<const float*>(values.data()); }
+};
+
+/**
+ * A component-wise operation on two expressions.
+ */
+template<typename Op, typename L, typename R>
+struct BinaryNode : Expression {
+    using value_type = typename L::value_type;
+    static constexpr bool broadcastsVector = L::broadcastsVector || R::broadcastsVector;
+
+    L left;
+    R right;
+    std::size_t count;
+
+    constexpr BinaryNode(const L& left, const R& right)
+        : left(left),
+          right(right),
+          count(detail::CombineSizes(left.size(), right.size())) { }
+    [[nodiscard]] constexpr std::size_t size() const { return count; }
+    [[nodiscard]] constexpr value_type Element(std::size_t i) const {
+        return detail::Zip<value_type, Op>(left.Element(i), right.Element(i));
+    }
+    [[nodiscard]] constexpr float Component(std::size_t j) const {
+        return Op::Apply(left.Component(j), right.Component(j));
+    }
+    [[nodiscard]] simd::floatv Packet(std::size_t j) const { return Op::Apply(left.Packet(j), right.Packet(j)); }
+};
+
+/**
+ * Negation of an expression.
+ */
+template<typename E>
+struct NegateNode : Expression {
+    using value_type = typename E::value_type;
+    static constexpr bool broadcastsVector = E::broadcastsVector;
+
+    E operand;
+
+    constexpr explicit NegateNode(const E& operand) : operand(operand) { }
+    [[nodiscard]] constexpr std::size_t size() const { return operand.size(); }
+    [[nodiscard]] constexpr value_type Element(std::size_t i) const {
+        return detail::Zip<value_type, detail::SubtractOp>(value_type{}, operand.Element(i));
+    }
+    [[nodiscard]] constexpr float Component(std::size_t j) const { return -operand.Component(j); }
+    [[nodiscard]] simd::floatv Packet(std::size_t j) const { return simd::Sub(simd::Set(0.0f), operand.Packet(j)); }
+};
+
+/**
+ * Start a lazy expression from a single vector.
+ */
+template<detail::Vector V>
+constexpr auto Lazy(const V& value) {
+    using T = detail::VectorOf<V>;
+    return VectorLeaf<T>(T(value));
+}
+
+/**
+ * Start a lazy expression from a contiguous array of vectors, like a std::vector or std::span. The array must outlive
+ * the expression.
+ */
+template<std::ranges::contiguous_range R>
+    requires detail::Vector<std::ranges::range_value_t<R>>
+constexpr auto Lazy(const R& values) {
+    using Stored = std::remove_cv_t<std::ranges::range_value_t<R>>;
+    return SpanLeaf<detail::VectorOf<Stored>, Stored>(
+        std::span<const Stored>(std::ranges::data(values), std::ranges::size(values)));
+}
+
+namespace detail {
+template<typename E>
+constexpr auto Operand(const E& value) {
+    if constexpr (IsExpression<E>) {
+        return value;
+    } else {
+        return Lazy(value);
+    }
+}
+
+template<typename L, typename R>
+concept Operands = (IsExpression<L> || IsExpression<R>) && (IsExpression<L> || Vector<L>) &&
+                   (IsExpression<R> || Vector<R>);
+} // namespace detail
+
+template<typename L, typename R>
+    requires detail::Operands<L, R>
+constexpr auto operator+(const L& left, const R& right) {
+    using A = decltype(detail::Operand(left));
+    using B = decltype(detail::Operand(right));
+    static_assert(std::is_same_v<typename A::value_type, typename B::value_type>, "Vector types do not match");
+    return BinaryNode<detail::AddOp, A, B>(detail::Operand(left), detail::Operand(right));
+}
+
+template<typename L, typename R>
+    requires detail::Operands<L, R>
+constexpr auto operator-(const L& left, const R& right) {
+    using A = decltype(detail::Operand(left));
+    using B = decltype(detail::Operand(right));
+    static_assert(std::is_same_v<typename A::value_type, typename B::value_type>, "Vector types do not match");
+    return BinaryNode<detail::SubtractOp, A, B>(detail::Operand(left), detail::Operand(right));
+}
+
+/**
+ * Component-wise multiplication.
+ */
+template<typename L, typename R>
+    requires detail::Operands<L, R>
+constexpr auto operator*(const L& left, const R& right) {
+    using A = decltype(detail::Operand(left));
+    using B = decltype(detail::Operand(right));
+    static_assert(std::is_same_v<typename A::value_type, typename B::value_type>, "Vector types do not match");
+    return BinaryNode<detail::MultiplyOp, A, B>(detail::Operand(left), detail::Operand(right));
+}
+
+/**
+ * Component-wise division.
+ */
+template<typename L, typename R>
+    requires detail::Operands<L, R>
+constexpr auto operator/(const L& left, const R& right) {
+    using A = decltype(detail::Operand(left));
+    using B = decltype(detail::Operand(right));
+    static_assert(std::is_same_v<typename A::value_type, typename B::value_type>, "Vector types do not match");
+    return BinaryNode<detail::DivideOp, A, B>(detail::Operand(left), detail::Operand(right));
+}
+
+template<IsExpression E>
+constexpr auto operator*(const E& left, float right) {
+    return BinaryNode<detail::MultiplyOp, E, ScalarLeaf<typename E::value_type>>(
+        left,
+        ScalarLeaf<typename E::value_type>(right));
+}
+
+template<IsExpression E>
+constexpr auto operator*(float left, const E& right) {
+    return BinaryNode<detail::MultiplyOp, ScalarLeaf<typename E::value_type>, E>(
+        ScalarLeaf<typename E::value_type>(left),
+        right);
+}
+
+template<IsExpression E>
+constexpr auto operator/(const E& left, float right) {
+    return BinaryNode<detail::DivideOp, E, ScalarLeaf<typename E::value_type>>(
+        left,
+        ScalarLeaf<typename E::value_type>(right));
+}
+
+template<IsExpression E>
+constexpr auto operator-(const E& operand) {
+    return NegateNode<E>(operand);
+}
+
+/**
+ * Compute an expression of single vectors.
+ *
+ * @throws raylib::RaylibException Thrown if the expression has array operands.
+ */
+template<IsExpression E>
+constexpr typename E::value_type Evaluate(const E& expression) {
+    if (expression.size() != 0) {
+        throw RaylibException("Evaluate() takes single vector expressions, use Assign() for arrays");
+    }
+    return expression.Element(0);
+}
+
+/**
+ * Compute an expression into an array, in one pass. The output may be one of the expression's arrays. Single-vector
+ * expressions fill the whole output.
+ *
+ * @throws raylib::RaylibException Thrown if the output size does not match the expression's arrays.
+ */
+template<std::ranges::contiguous_range R, IsExpression E>
+    requires detail::Vector<std::ranges::range_value_t<R>> &&
+             std::is_same_v<detail::VectorOf<std::ranges::range_value_t<R>>, typename E::value_type>
+void Assign(R&& output, const E& expression) {
+    using V = typename E::value_type;
+    const std::span<std::ranges::range_value_t<R>> out(std::ranges::data(output), std::ranges::size(output));
+    if (expression.size() != 0 && expression.size() != out.size()) {
+        throw RaylibException("Vector expression and output sizes do not match");
+    }
+
+    if constexpr (E::broadcastsVector) {
+        for (std::size_t i = 0; i < out.size(); i++) {
+            out[i] = expression.Element(i);
+        }
+    } else {
+        // Every operand is an array or a scalar, so the arrays can be processed as flat floats.
+        auto* floats = reinterpret_cast<float*>(out.data());
+        const std::size_t count = out.size() * detail::VectorType<V>::components;
+        std::size_t j = 0;
+        for (; j + simd::width <= count; j += simd::width) {
+            simd::Store(floats + j, expression.Packet(j));
+        }
+        for (; j < count; j++) {
+            floats[j] = expression.Component(j);
+        }
+    }
+}
+} // namespace expr
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_VECTOREXPRESSION_HPP_
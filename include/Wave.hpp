@@ -1,9 +1,17 @@
 #ifndef RAYLIB_CPP_INCLUDE_WAVE_HPP_
 #define RAYLIB_CPP_INCLUDE_WAVE_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <span>
 #include <string>
+#include <vector>
 
+#include "./Allocator.hpp"
+#include "./FileData.hpp"
 #include "./RaylibException.hpp"
+#include "./SampleKernels.hpp"
 #include "./raylib-cpp-utils.hpp"
 #include "./raylib.hpp"
 
@@ -41,7 +49,14 @@ public:
         Load(fileType, fileData, dataSize);
     }
 
-    Wave(const Wave& other) { set(other.Copy()); }
+    /**
+     * Load wave from file data, like a mapped raylib::FileData.
+     *
+     * @throws raylib::RaylibException Throws if the Wave failed to load.
+     */
+    Wave(const std::string& fileType, const FileData& fileData) { Load(fileType, fileData); }
+
+    Wave(const Wave& other) { set(other.PooledCopy()); }
 
     Wave(Wave&& other) noexcept {
         set(other);
@@ -75,7 +90,7 @@ public:
         }
 
         Unload();
-        set(other.Copy());
+        set(other.PooledCopy());
 
         return *this;
     }
@@ -106,7 +121,7 @@ public:
      * Crop a wave to defined samples range
      */
     Wave& Crop(int initSample, int finalSample) {
-        ::WaveCrop(this, initSample, finalSample);
+        ReplaceBuffer(data, [&] { ::WaveCrop(this, initSample, finalSample); });
         return *this;
     }
 
@@ -114,7 +129,67 @@ public:
      * Convert wave data to desired format
      */
     Wave& Format(int SampleRate, int SampleSize, int Channels = 2) {
-        ::WaveFormat(this, SampleRate, SampleSize, Channels);
+        ReplaceBuffer(data, [&] { ::WaveFormat(this, SampleRate, SampleSize, Channels); });
+        return *this;
+    }
+
+    /**
+     * Convert wave data to desired format, like Format(), with the SIMD kernels and the polyphase resampler from
+     * raylib::samples instead of raylib's conversion.
+     *
+     * @throws raylib::RaylibException Throws if the converted samples couldn't be allocated.
+     */
+    Wave& Convert(int SampleRate, int SampleSize, int Channels = 2) {
+        if (data == nullptr || SampleRate <= 0 || Channels <= 0 || !samples::IsSupported(sampleSize) ||
+            !samples::IsSupported(static_cast<unsigned int>(SampleSize))) {
+            return Format(SampleRate, SampleSize, Channels);
+        }
+        const auto outRate = static_cast<unsigned int>(SampleRate);
+        const auto outSize = static_cast<unsigned int>(SampleSize);
+        const auto outChannels = static_cast<unsigned int>(Channels);
+
+        const bool direct = outRate == sampleRate && outChannels == channels;
+        std::size_t outFrames = frameCount;
+        std::vector<float> floats;
+        if (!direct) {
+            floats.resize(static_cast<std::size_t>(frameCount) * channels);
+            LoadSamples(floats);
+            // Resample as few channels as possible.
+            if (outChannels < channels) {
+                floats = MixChannels(floats, channels, outChannels);
+            }
+            const unsigned int resampledChannels = std::min(channels, outChannels);
+            if (outRate != sampleRate) {
+                const samples::Resampler resampler(sampleRate, outRate);
+                outFrames = resampler.GetOutputFrames(frameCount);
+                std::vector<float> resampled(outFrames * resampledChannels);
+                resampler.Process(floats, resampled, resampledChannels);
+                floats.swap(resampled);
+            }
+            if (outChannels > channels) {
+                floats = MixChannels(floats, channels, outChannels);
+            }
+        }
+
+        void* result = AllocateBuffer(outFrames * outChannels * outSize / 8);
+        if (result == nullptr) {
+            throw RaylibException("Failed to allocate the converted Wave");
+        }
+        if (direct) {
+            samples::ConvertSamples(data, sampleSize, result, outSize, static_cast<std::size_t>(frameCount) * channels);
+        } else {
+            samples::ConvertSamples(floats.data(), 32, result, outSize, floats.size());
+        }
+
+        const ::Wave previous = *this;
+        frameCount = static_cast<unsigned int>(outFrames);
+        sampleRate = outRate;
+        sampleSize = outSize;
+        channels = outChannels;
+        data = result;
+        if (!ReleaseBuffer(previous.data)) {
+            ::UnloadWave(previous);
+        }
         return *this;
     }
 
@@ -123,6 +198,20 @@ public:
      */
     float* LoadSamples() { return ::LoadWaveSamples(*this); }
 
+    /**
+     * Convert the samples to floats, into a span of frameCount * channels floats.
+     *
+     * @throws raylib::RaylibException Throws if the span isn't frameCount * channels floats long.
+     */
+    void LoadSamples(std::span<float> out) const {
+        if (out.size() != static_cast<std::size_t>(frameCount) * channels) {
+            throw RaylibException("The span for the Wave's samples is not frameCount * channels long");
+        }
+        if (data != nullptr && samples::IsSupported(sampleSize)) {
+            samples::ConvertSamples(data, sampleSize, out.data(), 32, out.size());
+        }
+    }
+
     /**
      * Unload samples data loaded with LoadWaveSamples()
      */
@@ -150,7 +239,9 @@ public:
     void Unload() {
         // Protect against calling UnloadWave() twice.
         if (data != nullptr) {
-            ::UnloadWave(*this);
+            if (!ReleaseBuffer(data)) {
+                ::UnloadWave(*this);
+            }
             data = nullptr;
         }
     }
@@ -189,6 +280,15 @@ public:
         }
     }
 
+    /**
+     * Load wave from file data, like a mapped raylib::FileData, fileType refers to extension: i.e. "wav"
+     *
+     * @throws raylib::RaylibException Throws if the Wave failed to load.
+     */
+    void Load(const std::string& fileType, const FileData& fileData) {
+        Load(fileType, fileData.GetData(), fileData.GetBytesRead());
+    }
+
     /**
      * Retrieve whether or not the Wave data has been loaded.
      *
@@ -196,6 +296,28 @@ public:
      */
     [[nodiscard]] bool IsValid() const { return ::IsWaveValid(*this); }
 protected:
+    static std::vector<float>
+    MixChannels(std::span<const float> in, unsigned int inChannels, unsigned int outChannels) {
+        std::vector<float> out(in.size() / inChannels * outChannels);
+        samples::MixChannels(in, inChannels, out, outChannels);
+        return out;
+    }
+
+    /**
+     * Copy the wave into a buffer from the buffer allocator, for a wave this wrapper owns.
+     */
+    [[nodiscard]] ::Wave PooledCopy() const {
+        if (GetBufferAllocator() == nullptr || data == nullptr) {
+            return ::WaveCopy(*this);
+        }
+        const std::size_t size = static_cast<std::size_t>(frameCount) * channels * sampleSize / 8;
+        ::Wave copy{frameCount, sampleRate, sampleSize, channels, AllocateBuffer(size)};
+        if (copy.data != nullptr) {
+            std::memcpy(copy.data, data, size);
+        }
+        return copy;
+    }
+
     void set(const ::Wave& wave) {
         frameCount = wave.frameCount;
         sampleRate = wave.sampleRate;
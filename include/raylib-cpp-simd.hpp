@@ -0,0 +1,539 @@
+/**
+ * SIMD utilities for raylib-cpp.
+ *
+ * Selects the widest float vector type available at compile time: AVX2 (8 lanes), SSE2 (4 lanes),
+ * NEON on AArch64 (4 lanes), or a plain float (1 lane) fallback. Define RAYLIB_CPP_NO_SIMD to force
+ * the scalar fallback.
+ *
+ * The vector backends also provide integer registers for byte-wise pixel work, and define
+ * RAYLIB_CPP_SIMD_INT. The scalar fallback has no integer ops. Every backend, including the scalar
+ * one, can load and store `width` 8-bit and 16-bit audio samples as floats.
+ *
+ * Comparisons return lane masks, which combine with And(), Or() and AndNot(), meaning `a and not b`, and turn
+ * into one bit per lane with MoveMask().
+ *
+ * What Min() and Max() return for a NaN lane depends on the instruction set. MinNumber() and MaxNumber() return
+ * the other operand, like std::fmin() and std::fmax().
+ */
+#ifndef RAYLIB_CPP_INCLUDE_RAYLIB_CPP_SIMD_HPP_
+#define RAYLIB_CPP_INCLUDE_RAYLIB_CPP_SIMD_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#ifndef RAYLIB_CPP_NO_SIMD
+#if defined(__AVX2__)
+#define RAYLIB_CPP_SIMD_AVX2
+#define RAYLIB_CPP_SIMD_SSE2
+#define RAYLIB_CPP_SIMD_INT
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAYLIB_CPP_SIMD_SSE2
+#define RAYLIB_CPP_SIMD_INT
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define RAYLIB_CPP_SIMD_NEON
+#define RAYLIB_CPP_SIMD_INT
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace raylib {
+/**
+ * Thin wrappers over the selected float vector type, used by the batch kernels.
+ */
+namespace simd {
+#if defined(RAYLIB_CPP_SIMD_AVX2)
+using floatv = __m256;
+constexpr std::size_t width = 8;
+constexpr const char* name = "AVX2";
+
+inline floatv Load(const float* p) { return _mm256_loadu_ps(p); }
+inline void Store(float* p, floatv v) { _mm256_storeu_ps(p, v); }
+inline floatv Set(float value) { return _mm256_set1_ps(value); }
+inline floatv Add(floatv a, floatv b) { return _mm256_add_ps(a, b); }
+inline floatv Sub(floatv a, floatv b) { return _mm256_sub_ps(a, b); }
+inline floatv Mul(floatv a, floatv b) { return _mm256_mul_ps(a, b); }
+inline floatv Div(floatv a, floatv b) { return _mm256_div_ps(a, b); }
+inline floatv Min(floatv a, floatv b) { return _mm256_min_ps(a, b); }
+inline floatv Max(floatv a, floatv b) { return _mm256_max_ps(a, b); }
+inline floatv MinNumber(floatv a, floatv b) {
+    return _mm256_blendv_ps(_mm256_min_ps(a, b), a, _mm256_cmp_ps(b, b, _CMP_UNORD_Q));
+}
+inline floatv MaxNumber(floatv a, floatv b) {
+    return _mm256_blendv_ps(_mm256_max_ps(a, b), a, _mm256_cmp_ps(b, b, _CMP_UNORD_Q));
+}
+inline floatv Sqrt(floatv a) { return _mm256_sqrt_ps(a); }
+inline floatv Greater(floatv a, floatv b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline floatv NotEqual(floatv a, floatv b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+inline floatv Select(floatv mask, floatv a, floatv b) { return _mm256_blendv_ps(b, a, mask); }
+inline floatv And(floatv a, floatv b) { return _mm256_and_ps(a, b); }
+inline floatv Or(floatv a, floatv b) { return _mm256_or_ps(a, b); }
+inline floatv AndNot(floatv a, floatv b) { return _mm256_andnot_ps(b, a); }
+inline unsigned int MoveMask(floatv mask) { return static_cast<unsigned int>(_mm256_movemask_ps(mask)); }
+
+using intv = __m256i;
+constexpr std::size_t intBytes = 32;
+
+inline intv LoadInt(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+inline void StoreInt(void* p, intv v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+inline intv SetInt(std::uint32_t value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+inline intv BitAnd(intv a, intv b) { return _mm256_and_si256(a, b); }
+inline intv BitXor(intv a, intv b) { return _mm256_xor_si256(a, b); }
+inline intv BitSelect(intv mask, intv a, intv b) { return _mm256_blendv_epi8(b, a, mask); }
+inline intv Equal32(intv a, intv b) { return _mm256_cmpeq_epi32(a, b); }
+inline intv Greater32(intv a, intv b) { return _mm256_cmpgt_epi32(a, b); }
+template<int Bits>
+inline intv ShiftRight32(intv v) { return _mm256_srli_epi32(v, Bits); }
+inline intv Equal8(intv a, intv b) { return _mm256_cmpeq_epi8(a, b); }
+inline intv Min8(intv a, intv b) { return _mm256_min_epu8(a, b); }
+inline intv AddSaturate8(intv a, intv b) { return _mm256_adds_epu8(a, b); }
+inline intv SubSaturate8(intv a, intv b) { return _mm256_subs_epu8(a, b); }
+
+/**
+ * Widen 8 RGBA pixels into floats, 2 pixels per register.
+ */
+inline void PixelsToFloats(intv v, floatv (&out)[4]) {
+    const __m128i lo = _mm256_castsi256_si128(v);
+    const __m128i hi = _mm256_extracti128_si256(v, 1);
+    out[0] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(lo));
+    out[1] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+    out[2] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(hi));
+    out[3] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+}
+
+/**
+ * Truncate floats in [0, 255] back into 8 RGBA pixels, the reverse of PixelsToFloats().
+ */
+inline intv FloatsToPixels(const floatv (&in)[4]) {
+    const __m256i lo = _mm256_packs_epi32(_mm256_cvttps_epi32(in[0]), _mm256_cvttps_epi32(in[1]));
+    const __m256i hi = _mm256_packs_epi32(_mm256_cvttps_epi32(in[2]), _mm256_cvttps_epi32(in[3]));
+    // Packing works within 128-bit halves, so restore the pixel order afterwards.
+    return _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+/**
+ * Copy each pixel's alpha lane into its other three lanes.
+ */
+inline floatv BroadcastAlpha(floatv v) { return _mm256_permute_ps(v, 0xFF); }
+inline floatv SetRGBA(float r, float g, float b, float a) { return _mm256_setr_ps(r, g, b, a, r, g, b, a); }
+
+/**
+ * Add the lanes together.
+ */
+inline float Sum(floatv v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+}
+
+/**
+ * Load 8 16-bit samples as floats.
+ */
+inline floatv LoadShorts(const std::int16_t* p) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+}
+
+/**
+ * Round floats in the 16-bit range, and store them as 8 16-bit samples.
+ */
+inline void StoreShorts(std::int16_t* p, floatv v) {
+    const __m256i values = _mm256_cvtps_epi32(v);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(p),
+        _mm_packs_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1)));
+}
+
+/**
+ * Load 8 unsigned 8-bit samples as floats.
+ */
+inline floatv LoadBytes(const std::uint8_t* p) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+
+/**
+ * Round floats in [0, 255], and store them as 8 unsigned 8-bit samples.
+ */
+inline void StoreBytes(std::uint8_t* p, floatv v) {
+    const __m256i values = _mm256_cvtps_epi32(v);
+    const __m128i shorts = _mm_packs_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(shorts, shorts));
+}
+
+/**
+ * Split two registers of interleaved pairs into the first and the second of each pair.
+ */
+inline void Deinterleave2(floatv a, floatv b, floatv& first, floatv& second) {
+    // Shuffles work within 128-bit halves, so restore the order of the 64-bit blocks afterwards.
+    first = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, 0x88)), 0xD8));
+    second = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, 0xDD)), 0xD8));
+}
+
+/**
+ * Interleave two registers into pairs, the reverse of Deinterleave2().
+ */
+inline void Interleave2(floatv first, floatv second, floatv& a, floatv& b) {
+    const __m256 lo = _mm256_unpacklo_ps(first, second);
+    const __m256 hi = _mm256_unpackhi_ps(first, second);
+    a = _mm256_permute2f128_ps(lo, hi, 0x20);
+    b = _mm256_permute2f128_ps(lo, hi, 0x31);
+}
+#elif defined(RAYLIB_CPP_SIMD_SSE2)
+using floatv = __m128;
+constexpr std::size_t width = 4;
+constexpr const char* name = "SSE2";
+
+inline floatv Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, floatv v) { _mm_storeu_ps(p, v); }
+inline floatv Set(float value) { return _mm_set1_ps(value); }
+inline floatv Add(floatv a, floatv b) { return _mm_add_ps(a, b); }
+inline floatv Sub(floatv a, floatv b) { return _mm_sub_ps(a, b); }
+inline floatv Mul(floatv a, floatv b) { return _mm_mul_ps(a, b); }
+inline floatv Div(floatv a, floatv b) { return _mm_div_ps(a, b); }
+inline floatv Min(floatv a, floatv b) { return _mm_min_ps(a, b); }
+inline floatv Max(floatv a, floatv b) { return _mm_max_ps(a, b); }
+// minps and maxps return the second operand when either is NaN, so only a NaN second operand needs replacing.
+inline floatv MinNumber(floatv a, floatv b) {
+    const __m128 nan = _mm_cmpunord_ps(b, b);
+    return _mm_or_ps(_mm_and_ps(nan, a), _mm_andnot_ps(nan, _mm_min_ps(a, b)));
+}
+inline floatv MaxNumber(floatv a, floatv b) {
+    const __m128 nan = _mm_cmpunord_ps(b, b);
+    return _mm_or_ps(_mm_and_ps(nan, a), _mm_andnot_ps(nan, _mm_max_ps(a, b)));
+}
+inline floatv Sqrt(floatv a) { return _mm_sqrt_ps(a); }
+inline floatv Greater(floatv a, floatv b) { return _mm_cmpgt_ps(a, b); }
+inline floatv NotEqual(floatv a, floatv b) { return _mm_cmpneq_ps(a, b); }
+inline floatv Select(floatv mask, floatv a, floatv b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+inline floatv And(floatv a, floatv b) { return _mm_and_ps(a, b); }
+inline floatv Or(floatv a, floatv b) { return _mm_or_ps(a, b); }
+inline floatv AndNot(floatv a, floatv b) { return _mm_andnot_ps(b, a); }
+inline unsigned int MoveMask(floatv mask) { return static_cast<unsigned int>(_mm_movemask_ps(mask)); }
+
+using intv = __m128i;
+constexpr std::size_t intBytes = 16;
+
+inline intv LoadInt(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+inline void StoreInt(void* p, intv v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+inline intv SetInt(std::uint32_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+inline intv BitAnd(intv a, intv b) { return _mm_and_si128(a, b); }
+inline intv BitXor(intv a, intv b) { return _mm_xor_si128(a, b); }
+inline intv BitSelect(intv mask, intv a, intv b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+inline intv Equal32(intv a, intv b) { return _mm_cmpeq_epi32(a, b); }
+inline intv Greater32(intv a, intv b) { return _mm_cmpgt_epi32(a, b); }
+template<int Bits>
+inline intv ShiftRight32(intv v) { return _mm_srli_epi32(v, Bits); }
+inline intv Equal8(intv a, intv b) { return _mm_cmpeq_epi8(a, b); }
+inline intv Min8(intv a, intv b) { return _mm_min_epu8(a, b); }
+inline intv AddSaturate8(intv a, intv b) { return _mm_adds_epu8(a, b); }
+inline intv SubSaturate8(intv a, intv b) { return _mm_subs_epu8(a, b); }
+
+/**
+ * Widen 4 RGBA pixels into floats, 1 pixel per register.
+ */
+inline void PixelsToFloats(intv v, floatv (&out)[4]) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_unpacklo_epi8(v, zero);
+    const __m128i hi = _mm_unpackhi_epi8(v, zero);
+    out[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    out[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    out[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    out[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+}
+
+/**
+ * Truncate floats in [0, 255] back into 4 RGBA pixels, the reverse of PixelsToFloats().
+ */
+inline intv FloatsToPixels(const floatv (&in)[4]) {
+    const __m128i lo = _mm_packs_epi32(_mm_cvttps_epi32(in[0]), _mm_cvttps_epi32(in[1]));
+    const __m128i hi = _mm_packs_epi32(_mm_cvttps_epi32(in[2]), _mm_cvttps_epi32(in[3]));
+    return _mm_packus_epi16(lo, hi);
+}
+
+/**
+ * Copy each pixel's alpha lane into its other three lanes.
+ */
+inline floatv BroadcastAlpha(floatv v) { return _mm_shuffle_ps(v, v, 0xFF); }
+inline floatv SetRGBA(float r, float g, float b, float a) { return _mm_setr_ps(r, g, b, a); }
+
+/**
+ * Add the lanes together.
+ */
+inline float Sum(floatv v) {
+    const __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+}
+
+/**
+ * Load 4 16-bit samples as floats.
+ */
+inline floatv LoadShorts(const std::int16_t* p) {
+    const __m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+    // Each sample in the top half of a 32-bit lane, shifted down to extend its sign.
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16));
+}
+
+/**
+ * Round floats in the 16-bit range, and store them as 4 16-bit samples.
+ */
+inline void StoreShorts(std::int16_t* p, floatv v) {
+    const __m128i values = _mm_cvtps_epi32(v);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(values, values));
+}
+
+/**
+ * Load 4 unsigned 8-bit samples as floats.
+ */
+inline floatv LoadBytes(const std::uint8_t* p) {
+    int bytes;
+    std::memcpy(&bytes, p, sizeof(bytes));
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero));
+}
+
+/**
+ * Round floats in [0, 255], and store them as 4 unsigned 8-bit samples.
+ */
+inline void StoreBytes(std::uint8_t* p, floatv v) {
+    const __m128i values = _mm_cvtps_epi32(v);
+    const __m128i shorts = _mm_packs_epi32(values, values);
+    const int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(shorts, shorts));
+    std::memcpy(p, &bytes, sizeof(bytes));
+}
+
+/**
+ * Split two registers of interleaved pairs into the first and the second of each pair.
+ */
+inline void Deinterleave2(floatv a, floatv b, floatv& first, floatv& second) {
+    first = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    second = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+/**
+ * Interleave two registers into pairs, the reverse of Deinterleave2().
+ */
+inline void Interleave2(floatv first, floatv second, floatv& a, floatv& b) {
+    a = _mm_unpacklo_ps(first, second);
+    b = _mm_unpackhi_ps(first, second);
+}
+#elif defined(RAYLIB_CPP_SIMD_NEON)
+using floatv = float32x4_t;
+constexpr std::size_t width = 4;
+constexpr const char* name = "NEON";
+
+inline floatv Load(const float* p) { return vld1q_f32(p); }
+inline void Store(float* p, floatv v) { vst1q_f32(p, v); }
+inline floatv Set(float value) { return vdupq_n_f32(value); }
+inline floatv Add(floatv a, floatv b) { return vaddq_f32(a, b); }
+inline floatv Sub(floatv a, floatv b) { return vsubq_f32(a, b); }
+inline floatv Mul(floatv a, floatv b) { return vmulq_f32(a, b); }
+inline floatv Div(floatv a, floatv b) { return vdivq_f32(a, b); }
+inline floatv Min(floatv a, floatv b) { return vminq_f32(a, b); }
+inline floatv Max(floatv a, floatv b) { return vmaxq_f32(a, b); }
+inline floatv MinNumber(floatv a, floatv b) { return vminnmq_f32(a, b); }
+inline floatv MaxNumber(floatv a, floatv b) { return vmaxnmq_f32(a, b); }
+inline floatv Sqrt(floatv a) { return vsqrtq_f32(a); }
+inline floatv Greater(floatv a, floatv b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+inline floatv NotEqual(floatv a, floatv b) { return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a, b))); }
+inline floatv Select(floatv mask, floatv a, floatv b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+inline floatv And(floatv a, floatv b) {
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+inline floatv Or(floatv a, floatv b) {
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+inline floatv AndNot(floatv a, floatv b) {
+    return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+inline unsigned int MoveMask(floatv mask) {
+    static const std::int32_t shifts[4] = {0, 1, 2, 3};
+    const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(mask), 31);
+    return vaddvq_u32(vshlq_u32(bits, vld1q_s32(shifts)));
+}
+
+using intv = uint8x16_t;
+constexpr std::size_t intBytes = 16;
+
+inline intv LoadInt(const void* p) { return vld1q_u8(static_cast<const std::uint8_t*>(p)); }
+inline void StoreInt(void* p, intv v) { vst1q_u8(static_cast<std::uint8_t*>(p), v); }
+inline intv SetInt(std::uint32_t value) { return vreinterpretq_u8_u32(vdupq_n_u32(value)); }
+inline intv BitAnd(intv a, intv b) { return vandq_u8(a, b); }
+inline intv BitXor(intv a, intv b) { return veorq_u8(a, b); }
+inline intv BitSelect(intv mask, intv a, intv b) { return vbslq_u8(mask, a, b); }
+inline intv Equal32(intv a, intv b) {
+    return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)));
+}
+inline intv Greater32(intv a, intv b) {
+    return vreinterpretq_u8_u32(vcgtq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b)));
+}
+template<int Bits>
+inline intv ShiftRight32(intv v) { return vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(v), Bits)); }
+inline intv Equal8(intv a, intv b) { return vceqq_u8(a, b); }
+inline intv Min8(intv a, intv b) { return vminq_u8(a, b); }
+inline intv AddSaturate8(intv a, intv b) { return vqaddq_u8(a, b); }
+inline intv SubSaturate8(intv a, intv b) { return vqsubq_u8(a, b); }
+
+/**
+ * Widen 4 RGBA pixels into floats, 1 pixel per register.
+ */
+inline void PixelsToFloats(intv v, floatv (&out)[4]) {
+    const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+    const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+    out[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+    out[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+    out[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+    out[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+}
+
+/**
+ * Truncate floats in [0, 255] back into 4 RGBA pixels, the reverse of PixelsToFloats().
+ */
+inline intv FloatsToPixels(const floatv (&in)[4]) {
+    const uint16x8_t lo = vcombine_u16(vmovn_u32(vcvtq_u32_f32(in[0])), vmovn_u32(vcvtq_u32_f32(in[1])));
+    const uint16x8_t hi = vcombine_u16(vmovn_u32(vcvtq_u32_f32(in[2])), vmovn_u32(vcvtq_u32_f32(in[3])));
+    return vcombine_u8(vmovn_u16(lo), vmovn_u16(hi));
+}
+
+/**
+ * Copy each pixel's alpha lane into its other three lanes.
+ */
+inline floatv BroadcastAlpha(floatv v) { return vdupq_laneq_f32(v, 3); }
+inline floatv SetRGBA(float r, float g, float b, float a) {
+    const float rgba[4] = {r, g, b, a};
+    return vld1q_f32(rgba);
+}
+
+/**
+ * Add the lanes together.
+ */
+inline float Sum(floatv v) { return vaddvq_f32(v); }
+
+/**
+ * Load 4 16-bit samples as floats.
+ */
+inline floatv LoadShorts(const std::int16_t* p) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(p))); }
+
+/**
+ * Round floats in the 16-bit range, and store them as 4 16-bit samples.
+ */
+inline void StoreShorts(std::int16_t* p, floatv v) { vst1_s16(p, vqmovn_s32(vcvtnq_s32_f32(v))); }
+
+/**
+ * Load 4 unsigned 8-bit samples as floats.
+ */
+inline floatv LoadBytes(const std::uint8_t* p) {
+    std::uint32_t bytes;
+    std::memcpy(&bytes, p, sizeof(bytes));
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(bytes))))));
+}
+
+/**
+ * Round floats in [0, 255], and store them as 4 unsigned 8-bit samples.
+ */
+inline void StoreBytes(std::uint8_t* p, floatv v) {
+    const uint16x4_t shorts = vqmovun_s32(vcvtnq_s32_f32(v));
+    const std::uint32_t bytes = vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(shorts, shorts))), 0);
+    std::memcpy(p, &bytes, sizeof(bytes));
+}
+
+/**
+ * Split two registers of interleaved pairs into the first and the second of each pair.
+ */
+inline void Deinterleave2(floatv a, floatv b, floatv& first, floatv& second) {
+    first = vuzp1q_f32(a, b);
+    second = vuzp2q_f32(a, b);
+}
+
+/**
+ * Interleave two registers into pairs, the reverse of Deinterleave2().
+ */
+inline void Interleave2(floatv first, floatv second, floatv& a, floatv& b) {
+    a = vzip1q_f32(first, second);
+    b = vzip2q_f32(first, second);
+}
+#else
+/**
+ * Scalar fallback: a single lane.
+ */
+struct floatv {
+    float value;
+    bool mask;
+};
+constexpr std::size_t width = 1;
+constexpr const char* name = "Scalar";
+
+inline floatv Load(const float* p) { return {*p, false}; }
+inline void Store(float* p, floatv v) { *p = v.value; }
+inline floatv Set(float value) { return {value, false}; }
+inline floatv Add(floatv a, floatv b) { return {a.value + b.value, false}; }
+inline floatv Sub(floatv a, floatv b) { return {a.value - b.value, false}; }
+inline floatv Mul(floatv a, floatv b) { return {a.value * b.value, false}; }
+inline floatv Div(floatv a, floatv b) { return {a.value / b.value, false}; }
+inline floatv Min(floatv a, floatv b) { return {a.value < b.value ? a.value : b.value, false}; }
+inline floatv Max(floatv a, floatv b) { return {a.value > b.value ? a.value : b.value, false}; }
+inline floatv MinNumber(floatv a, floatv b) { return {std::fmin(a.value, b.value), false}; }
+inline floatv MaxNumber(floatv a, floatv b) { return {std::fmax(a.value, b.value), false}; }
+inline floatv Sqrt(floatv a) { return {std::sqrt(a.value), false}; }
+inline floatv Greater(floatv a, floatv b) { return {0.0f, a.value > b.value}; }
+inline floatv NotEqual(floatv a, floatv b) { return {0.0f, a.value != b.value}; }
+inline floatv Select(floatv mask, floatv a, floatv b) { return mask.mask ? a : b; }
+inline floatv And(floatv a, floatv b) { return {0.0f, a.mask && b.mask}; }
+inline floatv Or(floatv a, floatv b) { return {0.0f, a.mask || b.mask}; }
+inline floatv AndNot(floatv a, floatv b) { return {0.0f, a.mask && !b.mask}; }
+inline unsigned int MoveMask(floatv mask) { return mask.mask ? 1u : 0u; }
+inline float Sum(floatv v) { return v.value; }
+inline floatv LoadShorts(const std::int16_t* p) { return {static_cast<float>(*p), false}; }
+inline void StoreShorts(std::int16_t* p, floatv v) { *p = static_cast<std::int16_t>(std::lrint(v.value)); }
+inline floatv LoadBytes(const std::uint8_t* p) { return {static_cast<float>(*p), false}; }
+inline void StoreBytes(std::uint8_t* p, floatv v) { *p = static_cast<std::uint8_t>(std::lrint(v.value)); }
+inline void Deinterleave2(floatv a, floatv b, floatv& first, floatv& second) {
+    first = a;
+    second = b;
+}
+inline void Interleave2(floatv first, floatv second, floatv& a, floatv& b) {
+    a = first;
+    b = second;
+}
+#endif
+
+/**
+ * One register per component of `width` items. A plain array, since std::array would drop the vector type's
+ * alignment attributes.
+ */
+template<std::size_t N>
+struct Registers {
+    floatv v[N];
+
+    const floatv& operator[](std::size_t i) const { return v[i]; }
+    floatv& operator[](std::size_t i) { return v[i]; }
+};
+
+/**
+ * Transpose up to `width` items into one register per component, with `components(item)` returning an item's N
+ * floats. Unused lanes repeat the last item, so they never see values the used lanes wouldn't.
+ */
+template<std::size_t N, typename T, typename F>
+Registers<N> Gather(const T* items, std::size_t count, F components) {
+    alignas(32) float values[N][width];
+    for (std::size_t lane = 0; lane < width; lane++) {
+        std::array<float, N> item = components(items[std::min(lane, count - 1)]);
+        for (std::size_t k = 0; k < N; k++) {
+            values[k][lane] = item[k];
+        }
+    }
+    Registers<N> result;
+    for (std::size_t k = 0; k < N; k++) {
+        result[k] = Load(values[k]);
+    }
+    return result;
+}
+} // namespace simd
+} // namespace raylib
+
+#endif // RAYLIB_CPP_INCLUDE_RAYLIB_CPP_SIMD_HPP_
@@ -31,41 +31,66 @@
 #ifndef RAYLIB_CPP_INCLUDE_RAYLIB_CPP_HPP_
 #define RAYLIB_CPP_INCLUDE_RAYLIB_CPP_HPP_
 
+#include "./AABBTree.hpp"
+#include "./Allocator.hpp"
+#include "./AssetArchive.hpp"
+#include "./AssetLoader.hpp"
 #include "./AudioDevice.hpp"
+#include "./AudioRingBuffer.hpp"
 #include "./AudioStream.hpp"
 #include "./AutomationEventList.hpp"
+#include "./BatchMath.hpp"
 #include "./BoundingBox.hpp"
 #include "./Camera2D.hpp"
 #include "./Camera3D.hpp"
 #include "./Color.hpp"
+#include "./CullingKernels.hpp"
+#include "./DynamicFont.hpp"
 #include "./FileData.hpp"
 #include "./FileText.hpp"
 #include "./Font.hpp"
+#include "./Frustum.hpp"
 #include "./Functions.hpp"
 #include "./Gamepad.hpp"
+#include "./GlyphLookup.hpp"
 #include "./Image.hpp"
+#include "./ImageView.hpp"
 #include "./Keyboard.hpp"
 #include "./Material.hpp"
 #include "./Matrix.hpp"
+#include "./MatrixKernels.hpp"
 #include "./Mesh.hpp"
+#include "./MeshBVH.hpp"
 #include "./Model.hpp"
 #include "./ModelAnimation.hpp"
 #include "./Mouse.hpp"
 #include "./Music.hpp"
+#include "./MusicStreamer.hpp"
+#include "./ParallelImage.hpp"
+#include "./Particles.hpp"
+#include "./PixelKernels.hpp"
 #include "./Ray.hpp"
 #include "./RayCollision.hpp"
+#include "./RayKernels.hpp"
 #include "./RaylibException.hpp"
 #include "./Rectangle.hpp"
 #include "./RenderTexture.hpp"
+#include "./SampleKernels.hpp"
 #include "./Shader.hpp"
+#include "./SkylinePacker.hpp"
 #include "./Sound.hpp"
+#include "./SpatialHash.hpp"
+#include "./SpriteBatch.hpp"
 #include "./Text.hpp"
+#include "./TextLayout.hpp"
+#include "./ThreadPool.hpp"
 #include "./Texture.hpp"
 #include "./TextureUnmanaged.hpp"
 #include "./Touch.hpp"
 #include "./Vector2.hpp"
 #include "./Vector3.hpp"
 #include "./Vector4.hpp"
+#include "./VectorExpression.hpp"
 #include "./VrStereoConfig.hpp"
 #include "./Wave.hpp"
 #include "./Window.hpp"
@@ -0,0 +1,1464 @@
+/**
+ * raylib-cpp benchmarks
+ *
+ * Runs without a window, and checks that every fast path gives the same bytes as the path it replaces.
+ *
+ * - Microbenchmarks of the wrapper hot paths: Vector and Matrix operators, Color conversions, collision checks,
+ *   rays against a mesh with and without a raylib::MeshBVH, batches of rays one at a time and with raylib::rays, the
+ *   string helpers from Functions.hpp, glyph lookups and text measurement with and without a
+ *   raylib::TextLayoutCache, and packing glyphs for a raylib::DynamicFont, in nanoseconds per call.
+ * - `a + b * 2 - c / 4` over arrays of Vector3: the operator chain, a chain of raylib::batch passes, and one fused
+ *   raylib::expr expression, in nanoseconds per vector.
+ * - Image transforms, and Wave format conversions by raylib against the SIMD kernels and polyphase resampler from
+ *   raylib::samples, in milliseconds.
+ * - Recording sprites into a raylib::SpriteBatch, sorted by texture and layer, in milliseconds per frame.
+ * - Updating a million bunnies stored in a std::list, a std::vector and raylib::Particles, in milliseconds.
+ * - Adding, moving and pairing 1000 to a million moving rectangles in a raylib::SpatialHash, and 1000 to 100000
+ *   moving boxes in a raylib::AABBTree, against testing every pair with CheckCollisionRecs() and
+ *   CheckCollisionBoxes() where that finishes, in milliseconds per frame.
+ * - Culling 100000 boxes and spheres against a camera frustum one at a time, with raylib::culling and on a
+ *   raylib::ThreadPool, in milliseconds per frame.
+ * - The serial Image methods against the tile-parallel ones from raylib::parallel, for an increasing number
+ *   of threads.
+ * - raylib::ThreadPool scaling for a parallel loop, a graph of dependent jobs and empty jobs, for an increasing number
+ *   of threads.
+ * - raylib's generic color functions against the R8G8B8A8 SIMD kernels from raylib::pixels, on 1080p and 4K.
+ * - Loading many small images as loose files against loading them from a raylib::AssetArchive.
+ *
+ * Usage: raylib_cpp_bench [--filter group] [--csv results.csv] [--baseline previous.csv] [imageSize]
+ *
+ * --filter   Only run the groups whose name contains the given text: math, expr, color, collision, text, image,
+ *            sprites, particles, broadphase, culling, wave, parallel, jobs, pixels or archive.
+ * --csv      Write the results as "group,name,value,unit" lines, to compare between commits.
+ * --baseline Compare the results against a CSV file written by an earlier run. Lower values are better.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <list>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "raylib-cpp.hpp"
+
+namespace {
+struct Result {
+    std::string group;
+    std::string name;
+    double value;
+    std::string unit;
+};
+
+std::vector<Result> results;
+
+void Record(const std::string& group, const std::string& name, double value, const std::string& unit) {
+    results.push_back({group, name, value, unit});
+}
+
+/**
+ * Keep the compiler from optimizing away a value that's never used.
+ */
+template<typename T>
+void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Best time of a few runs, each on a fresh copy of the source, in milliseconds.
+ */
+template<typename T, typename F>
+double Time(const T& source, F&& fn, T& result) {
+    double best = 0.0;
+    for (int run = 0; run < 3; run++) {
+        T copy(source);
+        const auto start = std::chrono::steady_clock::now();
+        fn(copy);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = run == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        result = std::move(copy);
+    }
+    return best;
+}
+
+/**
+ * Time `fn(i)`, in nanoseconds per call. The batch size doubles until a batch takes 5ms, then the best of five batches
+ * is kept.
+ */
+template<typename F>
+double NanosecondsPerCall(F&& fn) {
+    auto batch = [&fn](size_t iterations) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            fn(i);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    size_t iterations = 1;
+    double elapsed = batch(iterations);
+    while (elapsed < 5e6 && iterations < (size_t{1} << 30)) {
+        iterations *= 2;
+        elapsed = batch(iterations);
+    }
+    double best = elapsed / static_cast<double>(iterations);
+    for (int run = 0; run < 4; run++) {
+        best = std::min(best, batch(iterations) / static_cast<double>(iterations));
+    }
+    return best;
+}
+
+template<typename F>
+void Micro(const char* group, const char* name, F&& fn) {
+    const double ns = NanosecondsPerCall(std::forward<F>(fn));
+    std::printf("%-12s %-36s %12.2f\n", group, name, ns);
+    Record(group, name, ns, "ns");
+}
+
+bool Identical(const raylib::Image& a, const raylib::Image& b) {
+    return a.width == b.width && a.height == b.height && a.format == b.format &&
+           std::memcmp(a.data, b.data, static_cast<size_t>(a.GetPixelDataSize())) == 0;
+}
+
+/**
+ * Inputs for the microbenchmarks, indexed with `i & mask` so that every call sees different values.
+ */
+struct Inputs {
+    static constexpr size_t mask = 1023;
+
+    std::vector<raylib::Vector2> vector2s;
+    std::vector<raylib::Vector3> vector3s;
+    std::vector<raylib::Matrix> matrices;
+    std::vector<raylib::Color> colors;
+    std::vector<raylib::Rectangle> rectangles;
+
+    Inputs() {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> real(-100.0f, 100.0f);
+        std::uniform_int_distribution<int> byte(0, 255);
+        for (size_t i = 0; i <= mask; i++) {
+            vector2s.emplace_back(real(random), real(random));
+            vector3s.emplace_back(real(random), real(random), real(random));
+            matrices.push_back(raylib::Matrix::RotateXYZ(raylib::Vector3(real(random), real(random), real(random))) *
+                               raylib::Matrix::Translate(real(random), real(random), real(random)));
+            colors.emplace_back(
+                static_cast<unsigned char>(byte(random)),
+                static_cast<unsigned char>(byte(random)),
+                static_cast<unsigned char>(byte(random)),
+                static_cast<unsigned char>(byte(random)));
+            rectangles.emplace_back(real(random), real(random), std::abs(real(random)), std::abs(real(random)));
+        }
+    }
+};
+
+void BenchMath(const Inputs& in) {
+    const size_t mask = Inputs::mask;
+    Micro("math", "Vector2 operator+", [&](size_t i) {
+        DoNotOptimize(in.vector2s[i & mask] + in.vector2s[(i + 1) & mask]);
+    });
+    Micro("math", "Vector2 Normalize", [&](size_t i) { DoNotOptimize(in.vector2s[i & mask].Normalize()); });
+    Micro("math", "Vector2 Length", [&](size_t i) { DoNotOptimize(in.vector2s[i & mask].Length()); });
+    Micro("math", "Vector3 operator*", [&](size_t i) { DoNotOptimize(in.vector3s[i & mask] * 0.5f); });
+    Micro("math", "Vector3 CrossProduct", [&](size_t i) {
+        DoNotOptimize(in.vector3s[i & mask].CrossProduct(in.vector3s[(i + 1) & mask]));
+    });
+    Micro("math", "Vector3 Normalize", [&](size_t i) { DoNotOptimize(in.vector3s[i & mask].Normalize()); });
+    Micro("math", "Vector3 Transform", [&](size_t i) {
+        DoNotOptimize(in.vector3s[i & mask].Transform(in.matrices[(i + 1) & mask]));
+    });
+    Micro("math", "Matrix operator*", [&](size_t i) {
+        DoNotOptimize(in.matrices[i & mask] * in.matrices[(i + 1) & mask]);
+    });
+    Micro("math", "MatrixMultiply raymath", [&](size_t i) {
+        DoNotOptimize(::MatrixMultiply(in.matrices[i & mask], in.matrices[(i + 1) & mask]));
+    });
+    Micro("math", "Matrix Invert", [&](size_t i) { DoNotOptimize(in.matrices[i & mask].Invert()); });
+    Micro("math", "MatrixInvert raymath", [&](size_t i) { DoNotOptimize(::MatrixInvert(in.matrices[i & mask])); });
+    Micro("math", "Matrix Transpose", [&](size_t i) { DoNotOptimize(in.matrices[i & mask].Transpose()); });
+    Micro("math", "MatrixTranspose raymath", [&](size_t i) {
+        DoNotOptimize(::MatrixTranspose(in.matrices[i & mask]));
+    });
+
+    // Instance transforms, per matrix.
+    std::vector<::Matrix> transforms(in.vector3s.size());
+    const double translate = NanosecondsPerCall([&](size_t) {
+        raylib::batch::Translate(in.vector3s, in.matrices[0], transforms);
+        DoNotOptimize(transforms.data());
+    }) / static_cast<double>(transforms.size());
+    std::printf("%-12s %-36s %12.2f\n", "math", "batch::Translate per matrix", translate);
+    Record("math", "batch::Translate per matrix", translate, "ns");
+}
+
+void BenchExpression() {
+    for (size_t count : {size_t{1024}, size_t{1} << 20}) {
+        std::vector<raylib::Vector3> a(count, raylib::Vector3(1.0f, 2.0f, 3.0f));
+        std::vector<raylib::Vector3> b(count, raylib::Vector3(-4.0f, 5.0f, 0.5f));
+        std::vector<raylib::Vector3> c(count, raylib::Vector3(8.0f, -2.0f, 6.0f));
+        std::vector<raylib::Vector3> out(count);
+        std::vector<raylib::Vector3> temp(count);
+        const std::string suffix = " " + std::to_string(count);
+        auto perVector = [count](double ns) { return ns / static_cast<double>(count); };
+
+        const double chain = perVector(NanosecondsPerCall([&](size_t) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = a[i] + b[i] * 2.0f - c[i] / 4.0f;
+            }
+            DoNotOptimize(out.data());
+        }));
+        const double batch = perVector(NanosecondsPerCall([&](size_t) {
+            raylib::batch::Scale(b, 2.0f, out);
+            raylib::batch::Add(a, out, out);
+            raylib::batch::Scale(c, -0.25f, temp);
+            raylib::batch::Add(out, temp, out);
+            DoNotOptimize(out.data());
+        }));
+        const double fused = perVector(NanosecondsPerCall([&](size_t) {
+            namespace ex = raylib::expr;
+            ex::Assign(out, ex::Lazy(a) + ex::Lazy(b) * 2.0f - ex::Lazy(c) / 4.0f);
+            DoNotOptimize(out.data());
+        }));
+
+        std::printf("%-12s %-36s %12.2f\n", "expr", ("operator chain" + suffix).c_str(), chain);
+        std::printf("%-12s %-36s %12.2f\n", "expr", ("batch passes" + suffix).c_str(), batch);
+        std::printf("%-12s %-36s %12.2f %8.2f\n", "expr", ("expression" + suffix).c_str(), fused, chain / fused);
+        Record("expr", "operator chain" + suffix, chain, "ns");
+        Record("expr", "batch passes" + suffix, batch, "ns");
+        Record("expr", "expression" + suffix, fused, "ns");
+    }
+}
+
+void BenchColor(const Inputs& in) {
+    const size_t mask = Inputs::mask;
+    Micro("color", "Color ToInt", [&](size_t i) { DoNotOptimize(in.colors[i & mask].ToInt()); });
+    Micro("color", "Color Normalize", [&](size_t i) { DoNotOptimize(in.colors[i & mask].Normalize()); });
+    Micro("color", "Color ToHSV", [&](size_t i) { DoNotOptimize(in.colors[i & mask].ToHSV()); });
+    Micro("color", "Color FromHSV", [&](size_t i) {
+        DoNotOptimize(raylib::Color::FromHSV(static_cast<float>(i % 360), 0.5f, 0.75f));
+    });
+    Micro("color", "Color Fade", [&](size_t i) { DoNotOptimize(in.colors[i & mask].Fade(0.5f)); });
+    Micro("color", "Color Tint", [&](size_t i) {
+        DoNotOptimize(in.colors[i & mask].Tint(in.colors[(i + 1) & mask]));
+    });
+}
+
+void BenchCollision(const Inputs& in) {
+    const size_t mask = Inputs::mask;
+    Micro("collision", "Rectangle CheckCollision rectangle", [&](size_t i) {
+        DoNotOptimize(in.rectangles[i & mask].CheckCollision(in.rectangles[(i + 1) & mask]));
+    });
+    Micro("collision", "Rectangle GetCollision", [&](size_t i) {
+        DoNotOptimize(in.rectangles[i & mask].GetCollision(in.rectangles[(i + 1) & mask]));
+    });
+    Micro("collision", "Rectangle CheckCollision circle", [&](size_t i) {
+        DoNotOptimize(in.rectangles[i & mask].CheckCollision(in.vector2s[i & mask], 10.0f));
+    });
+    Micro("collision", "Vector2 CheckCollision triangle", [&](size_t i) {
+        DoNotOptimize(in.vector2s[i & mask].CheckCollision(
+            in.vector2s[(i + 1) & mask],
+            in.vector2s[(i + 2) & mask],
+            in.vector2s[(i + 3) & mask]));
+    });
+    Micro("collision", "Ray GetCollision sphere", [&](size_t i) {
+        raylib::Ray ray(in.vector3s[i & mask], in.vector3s[(i + 1) & mask].Normalize());
+        DoNotOptimize(ray.GetCollision(in.vector3s[(i + 2) & mask], 20.0f));
+    });
+    Micro("collision", "Ray GetCollision box", [&](size_t i) {
+        raylib::Ray ray(in.vector3s[i & mask], in.vector3s[(i + 1) & mask].Normalize());
+        const raylib::Vector3 min = in.vector3s[(i + 2) & mask];
+        DoNotOptimize(ray.GetCollision(::BoundingBox{min, min + raylib::Vector3(20.0f, 20.0f, 20.0f)}));
+    });
+}
+
+/**
+ * Rays against a 50000 triangle heightfield: raylib's test of every triangle against a raylib::MeshBVH.
+ */
+bool BenchMeshBVH() {
+    constexpr int side = 160;
+    std::vector<float> vertices;
+    std::vector<unsigned short> indices;
+    for (int z = 0; z < side; z++) {
+        for (int x = 0; x < side; x++) {
+            vertices.push_back(static_cast<float>(x));
+            vertices.push_back(std::sin(static_cast<float>(x) * 0.3f) * std::cos(static_cast<float>(z) * 0.2f) * 8);
+            vertices.push_back(static_cast<float>(z));
+        }
+    }
+    for (int z = 0; z + 1 < side; z++) {
+        for (int x = 0; x + 1 < side; x++) {
+            const int corner = z * side + x;
+            for (int offset : {0, side, 1, 1, side, side + 1}) {
+                indices.push_back(static_cast<unsigned short>(corner + offset));
+            }
+        }
+    }
+    ::Mesh mesh{};
+    mesh.vertexCount = side * side;
+    mesh.triangleCount = static_cast<int>(indices.size() / 3);
+    mesh.vertices = vertices.data();
+    mesh.indices = indices.data();
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> position(0.0f, static_cast<float>(side));
+    std::uniform_real_distribution<float> slope(-0.5f, 0.5f);
+    std::vector<raylib::Ray> rays;
+    for (size_t i = 0; i < 1024; i++) {
+        rays.emplace_back(
+            ::Vector3{position(random), 20.0f, position(random)},
+            ::Vector3{slope(random), -1.0f, slope(random)});
+    }
+    const raylib::Matrix identity = raylib::Matrix::Identity();
+    const raylib::MeshBVH bvh(mesh);
+
+    Micro("collision", "MeshBVH Build 50k triangles", [&](size_t) { DoNotOptimize(raylib::MeshBVH(mesh)); });
+    Micro("collision", "Ray GetCollision mesh", [&](size_t i) {
+        DoNotOptimize(rays[i & 1023].GetCollision(mesh, identity));
+    });
+    Micro("collision", "Ray GetCollision MeshBVH", [&](size_t i) { DoNotOptimize(rays[i & 1023].GetCollision(bvh)); });
+    Micro("collision", "MeshBVH CheckCollision", [&](size_t i) {
+        DoNotOptimize(bvh.CheckCollision(rays[i & 1023], 20.0f));
+    });
+
+    for (const raylib::Ray& ray : rays) {
+        const ::RayCollision expected = ray.GetCollision(mesh, identity);
+        const ::RayCollision hit = ray.GetCollision(bvh);
+        // raylib may round its own copy of the triangle test differently, so distances get a little slack.
+        if (hit.hit != expected.hit || std::abs(hit.distance - expected.distance) > 1e-5f * expected.distance) {
+            std::printf("MeshBVH  MISMATCH\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Batches of rays: one box per ray, like line of sight checks, and every ray against a few hundred spheres and
+ * triangles, like picking, one ray at a time against raylib::rays.
+ */
+bool BenchRayKernels() {
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> real(-50.0f, 50.0f);
+    constexpr size_t rayCount = 4096;
+    constexpr size_t shapeCount = 256;
+    std::vector<::Ray> rays;
+    std::vector<::BoundingBox> boxes;
+    for (size_t i = 0; i < rayCount; i++) {
+        const ::Vector3 eye{real(random), real(random), real(random)};
+        const ::Vector3 target{real(random), real(random), real(random)};
+        rays.push_back({eye, {target.x - eye.x, target.y - eye.y, target.z - eye.z}});
+        const ::Vector3 corner{real(random) * 0.5f, real(random) * 0.5f, real(random) * 0.5f};
+        boxes.push_back({corner, {corner.x + 20.0f, corner.y + 20.0f, corner.z + 20.0f}});
+    }
+    std::vector<raylib::rays::Sphere> spheres;
+    std::vector<raylib::rays::Triangle> triangles;
+    for (size_t i = 0; i < shapeCount; i++) {
+        const ::Vector3 center{real(random), real(random), real(random)};
+        spheres.push_back({center, 3.0f});
+        triangles.push_back(
+            {center,
+             {center.x + 6.0f, center.y, center.z + 1.0f},
+             {center.x, center.y + 6.0f, center.z - 1.0f}});
+    }
+    std::vector<::RayCollision> out(rayCount);
+    std::vector<::RayCollision> expected(rayCount);
+    std::vector<int> indices(rayCount);
+    raylib::ThreadPool pool;
+
+    Micro("collision", "Ray GetCollision box x4096", [&](size_t) {
+        for (size_t i = 0; i < rayCount; i++) {
+            expected[i] = ::GetRayCollisionBox(rays[i], boxes[i]);
+        }
+        DoNotOptimize(expected);
+    });
+    Micro("collision", "rays::GetCollisions box x4096", [&](size_t) {
+        raylib::rays::GetCollisions(rays, boxes, out);
+        DoNotOptimize(out);
+    });
+    for (size_t i = 0; i < rayCount; i++) {
+        if (out[i].hit != expected[i].hit || (out[i].hit && out[i].distance != expected[i].distance)) {
+            std::printf("rays::GetCollisions  MISMATCH\n");
+            return false;
+        }
+    }
+
+    Micro("collision", "Ray GetCollision sphere 4096x256", [&](size_t) {
+        for (size_t i = 0; i < rayCount; i++) {
+            ::RayCollision closest{};
+            for (const raylib::rays::Sphere& sphere : spheres) {
+                const ::RayCollision hit = ::GetRayCollisionSphere(rays[i], sphere.center, sphere.radius);
+                if (hit.hit && hit.distance >= 0 && (!closest.hit || hit.distance < closest.distance)) {
+                    closest = hit;
+                }
+            }
+            expected[i] = closest;
+        }
+        DoNotOptimize(expected);
+    });
+    Micro("collision", "rays::GetClosest sphere 4096x256", [&](size_t) {
+        raylib::rays::GetClosestCollisions(rays, spheres, out);
+        DoNotOptimize(out);
+    });
+    Micro("collision", "rays::GetClosest sphere pool", [&](size_t) {
+        raylib::rays::GetClosestCollisions(rays, spheres, out, {}, raylib::rays::noLimit, pool, 256);
+        DoNotOptimize(out);
+    });
+    for (size_t i = 0; i < rayCount; i++) {
+        if (out[i].hit != expected[i].hit || (out[i].hit && out[i].distance != expected[i].distance)) {
+            std::printf("rays::GetClosestCollisions  MISMATCH\n");
+            return false;
+        }
+    }
+
+    Micro("collision", "Ray GetCollision tri any 4096x256", [&](size_t) {
+        for (size_t i = 0; i < rayCount; i++) {
+            indices[i] = -1;
+            for (size_t j = 0; j < shapeCount; j++) {
+                const raylib::rays::Triangle& t = triangles[j];
+                const ::RayCollision hit = ::GetRayCollisionTriangle(rays[i], t.p1, t.p2, t.p3);
+                if (hit.hit && hit.distance < 1.0f) {
+                    indices[i] = static_cast<int>(j);
+                    break;
+                }
+            }
+        }
+        DoNotOptimize(indices);
+    });
+    Micro("collision", "rays::GetAny triangle 4096x256", [&](size_t) {
+        raylib::rays::GetAnyCollisions(rays, triangles, indices, 1.0f);
+        DoNotOptimize(indices);
+    });
+    return true;
+}
+
+bool BenchText() {
+    std::string line;
+    for (int i = 0; i < 64; i++) {
+        line += (i == 0 ? "" : ",") + std::to_string(i * 37);
+    }
+    const std::string text = "The quick brown fox jumps over the lazy dog. The lazy dog sleeps.";
+    const std::string directory = raylib::GetWorkingDirectory();
+
+    Micro("text", "TextSplit 64 fields", [&](size_t) { DoNotOptimize(raylib::TextSplit(line, ',')); });
+    Micro("text", "TextReplace", [&](size_t) { DoNotOptimize(raylib::TextReplace(text, "lazy", "energetic")); });
+    Micro("text", "TextToUpper", [&](size_t) { DoNotOptimize(raylib::TextToUpper(text)); });
+    Micro("text", "LoadDirectoryFiles", [&](size_t) { DoNotOptimize(raylib::LoadDirectoryFiles(directory)); });
+
+    // A font with the ASCII glyphs and 2000 CJK glyphs, like one loaded for a localized game.
+    std::vector<::GlyphInfo> glyphs;
+    std::vector<::Rectangle> recs;
+    for (int codepoint = 32; codepoint < 127; codepoint++) {
+        glyphs.push_back({codepoint, 0, 0, 10, {}});
+    }
+    for (int codepoint = 0x4E00; codepoint < 0x4E00 + 2000; codepoint++) {
+        glyphs.push_back({codepoint, 0, 0, 20, {}});
+    }
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        recs.push_back({static_cast<float>(i % 25) * 20, static_cast<float>(i / 25) * 20, 20, 20});
+    }
+    const ::Font font{
+        20,
+        static_cast<int>(glyphs.size()),
+        0,
+        {1, 512, 2048, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA},
+        recs.data(),
+        glyphs.data()};
+    std::string label = "Score: 12345 ";
+    for (int i = 0; i < 8; i++) {
+        const int codepoint = 0x4E00 + 1000 + i * 97;
+        label += static_cast<char>(0xE0 | (codepoint >> 12));
+        label += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        label += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    const raylib::GlyphLookup lookup(font);
+    raylib::TextLayoutCache cache;
+
+    Micro("text", "GetGlyphIndex CJK", [&](size_t i) {
+        DoNotOptimize(::GetGlyphIndex(font, 0x4E00 + static_cast<int>(i & 1023)));
+    });
+    Micro("text", "GlyphLookup CJK", [&](size_t i) {
+        DoNotOptimize(lookup.GetIndex(0x4E00 + static_cast<int>(i & 1023)));
+    });
+    Micro("text", "MeasureTextEx mixed", [&](size_t) { DoNotOptimize(::MeasureTextEx(font, label.c_str(), 20, 1)); });
+    Micro("text", "TextLayout Build mixed", [&](size_t) {
+        DoNotOptimize(raylib::TextLayout::Build(font, lookup, label, 20, 1));
+    });
+    Micro("text", "TextLayoutCache Measure", [&](size_t) { DoNotOptimize(cache.Measure(font, label, 20, 1)); });
+
+    // Packing glyph sized rectangles into a page, and finding glyphs a raylib::DynamicFont already rasterized.
+    raylib::SkylinePacker packer(1024, 1024);
+    Micro("text", "SkylinePacker Pack glyph", [&](size_t i) {
+        ::Rectangle rec;
+        const int width = 8 + static_cast<int>(i % 13);
+        if (!packer.Pack(width, 24, rec)) {
+            packer.Reset();
+        }
+        DoNotOptimize(rec);
+    });
+    raylib::DynamicFont dynamicFont(
+        [](int, raylib::DynamicFont::Bitmap& bitmap) {
+            bitmap.width = 16;
+            bitmap.height = 20;
+            bitmap.advanceX = 18;
+            bitmap.alpha.assign(16 * 20, 255);
+            return true;
+        },
+        20,
+        1024);
+    for (int codepoint = 0x4E00; codepoint < 0x4E00 + 1024; codepoint++) {
+        dynamicFont.GetGlyph(codepoint);
+    }
+    Micro("text", "DynamicFont GetGlyph CJK", [&](size_t i) {
+        DoNotOptimize(dynamicFont.GetGlyph(0x4E00 + static_cast<int>(i & 1023)));
+    });
+
+    const ::Vector2 expected = ::MeasureTextEx(font, label.c_str(), 20, 1);
+    const ::Vector2 cached = cache.Measure(font, label, 20, 1);
+    if (expected.x != cached.x || expected.y != cached.y) {
+        std::printf("TextLayoutCache  MISMATCH\n");
+        return false;
+    }
+    return true;
+}
+
+void BenchImage() {
+    raylib::Image source(::GenImageGradientRadial(1024, 1024, 0.2f, ORANGE, {20, 40, 200, 96}));
+    struct ImageOp {
+        const char* name;
+        std::function<void(raylib::Image&)> run;
+    };
+    const std::vector<ImageOp> ops = {
+        {"Resize 512", [](raylib::Image& i) { i.Resize(512, 512); }},
+        {"ResizeNN 512", [](raylib::Image& i) { i.ResizeNN(512, 512); }},
+        {"Crop 512", [](raylib::Image& i) { i.Crop(256, 256, 512, 512); }},
+        {"FlipVertical", [](raylib::Image& i) { i.FlipVertical(); }},
+        {"FlipHorizontal", [](raylib::Image& i) { i.FlipHorizontal(); }},
+        {"RotateCW", [](raylib::Image& i) { i.RotateCW(); }},
+        {"Format R8G8B8", [](raylib::Image& i) { i.Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8); }},
+        {"Format R32G32B32A32", [](raylib::Image& i) { i.Format(PIXELFORMAT_UNCOMPRESSED_R32G32B32A32); }},
+        {"Mipmaps", [](raylib::Image& i) { i.Mipmaps(); }},
+    };
+
+    std::printf("\nImage 1024x1024\n%-20s %12s\n", "operation", "ms");
+    for (const ImageOp& op : ops) {
+        raylib::Image result;
+        const double ms = Time(source, op.run, result);
+        std::printf("%-20s %12.2f\n", op.name, ms);
+        Record("image", op.name, ms, "ms");
+    }
+}
+
+void BenchSprites() {
+    // 100000 sprites recorded into a SpriteBatch per frame, which draws nothing without a graphics context.
+    const ::Texture2D textures[3] = {{1, 32, 32, 1, 7}, {2, 32, 32, 1, 7}, {3, 64, 64, 1, 7}};
+    constexpr size_t count = 100000;
+    std::vector<::Vector2> positions(count);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> coordinate(0.0f, 800.0f);
+    for (::Vector2& position : positions) {
+        position = {coordinate(random), coordinate(random)};
+    }
+    raylib::SpriteBatch batch(raylib::SpriteBatch::Mode::Record, count);
+
+    struct SpriteOp {
+        const char* name;
+        std::function<void()> run;
+    };
+    const std::vector<SpriteOp> ops = {
+        {"one texture",
+         [&] {
+             for (const ::Vector2& position : positions) {
+                 batch.Draw(textures[0], position, WHITE);
+             }
+         }},
+        {"three textures, sorted",
+         [&] {
+             for (size_t i = 0; i < count; i++) {
+                 batch.Draw(textures[i % 3], positions[i], WHITE);
+             }
+         }},
+        {"four layers, rotated",
+         [&] {
+             for (size_t i = 0; i < count; i++) {
+                 batch.Draw(textures[0], {0, 0, 32, 32}, {positions[i].x, positions[i].y, 32, 32}, {16, 16},
+                     static_cast<float>(i), WHITE, static_cast<int>(i % 4));
+             }
+         }},
+    };
+
+    std::printf("\nSpriteBatch, %zu sprites\n%-24s %12s %16s\n", count, "workload", "ms", "sprites per ms");
+    for (const SpriteOp& op : ops) {
+        const double ns = NanosecondsPerCall([&](size_t) {
+            batch.Begin();
+            op.run();
+            batch.End();
+            DoNotOptimize(batch.GetVertices().data());
+        });
+        const double ms = ns / 1e6;
+        std::printf("%-24s %12.2f %16.0f\n", op.name, ms, static_cast<double>(count) / ms);
+        Record("sprites", op.name, ms, "ms");
+    }
+}
+
+/**
+ * The layout the bunnymark example used: one object per bunny in a std::list, asking raylib for the screen size in
+ * every update.
+ */
+struct ListBunny {
+    ::Vector2 position;
+    ::Vector2 speed;
+    ::Color color;
+
+    void Update(const ::Texture2D& texture) {
+        position.x += speed.x;
+        position.y += speed.y;
+        const ::Rectangle bounds = ListBunny::Bounds(texture);
+        if ((position.x < bounds.x && speed.x < 0) || (position.x > bounds.x + bounds.width && speed.x > 0)) {
+            speed.x = -speed.x;
+        }
+        if ((position.y < bounds.y && speed.y < 0) || (position.y > bounds.y + bounds.height && speed.y > 0)) {
+            speed.y = -speed.y;
+        }
+    }
+
+    /**
+     * Positions that keep the bunny's center on the screen, below the 40 pixel header.
+     */
+    static ::Rectangle Bounds(const ::Texture2D& texture) {
+        const float halfWidth = static_cast<float>(texture.width) / 2;
+        const float halfHeight = static_cast<float>(texture.height) / 2;
+        return {-halfWidth, 40 - halfHeight, static_cast<float>(std::max(::GetScreenWidth(), 800)),
+            static_cast<float>(std::max(::GetScreenHeight(), 450)) - 40};
+    }
+};
+
+bool BenchParticles() {
+    // One million bunnies, updated for a few frames in each layout.
+    constexpr size_t count = 1000000;
+    constexpr int frames = 10;
+    const ::Texture2D texture{1, 32, 32, 1, 7};
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coordinate(0.0f, 400.0f);
+    std::uniform_real_distribution<float> speed(-250.0f / 60.0f, 250.0f / 60.0f);
+
+    std::list<ListBunny> list;
+    std::vector<ListBunny> array;
+    raylib::Particles particles(count);
+    for (size_t i = 0; i < count; i++) {
+        const ListBunny bunny{{coordinate(random), coordinate(random)}, {speed(random), speed(random)}, WHITE};
+        particles.Add(bunny.position, bunny.speed, bunny.color);
+        array.push_back(bunny);
+    }
+    // Allocate the list nodes in a random order, then link them in the original one, so walking the list jumps
+    // around the heap like a list that grew between other allocations.
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), random);
+    std::vector<std::list<ListBunny>::iterator> nodes(count);
+    for (size_t i : order) {
+        nodes[i] = list.insert(list.end(), array[i]);
+    }
+    std::list<ListBunny> linked;
+    for (size_t i = 0; i < count; i++) {
+        linked.splice(linked.end(), list, nodes[i]);
+    }
+    list.swap(linked);
+
+    auto best = [](auto&& fn) {
+        double result = 0.0;
+        for (int run = 0; run < 3; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            result = run == 0 ? elapsed.count() : std::min(result, elapsed.count());
+        }
+        return result / frames;
+    };
+
+    struct Layout {
+        std::string name;
+        double ms;
+    };
+    std::vector<Layout> layouts;
+    layouts.push_back({"std::list<Bunny>", best([&] {
+        for (int frame = 0; frame < frames; frame++) {
+            for (ListBunny& bunny : list) {
+                bunny.Update(texture);
+            }
+        }
+    })});
+    layouts.push_back({"std::vector<Bunny>", best([&] {
+        for (int frame = 0; frame < frames; frame++) {
+            for (ListBunny& bunny : array) {
+                bunny.Update(texture);
+            }
+        }
+    })});
+    const ::Rectangle bounds = ListBunny::Bounds(texture);
+    layouts.push_back({"Particles", best([&] {
+        for (int frame = 0; frame < frames; frame++) {
+            particles.Update(1.0f, bounds);
+        }
+    })});
+
+    // A copy, so the serial results stay comparable with the list and the array.
+    raylib::Particles threaded(particles);
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    raylib::ThreadPool pool(hardware - 1);
+    layouts.push_back({"Particles, " + std::to_string(hardware) + " threads", best([&] {
+        for (int frame = 0; frame < frames; frame++) {
+            threaded.Update(1.0f, bounds, pool);
+        }
+    })});
+
+    bool identical = true;
+    auto position = list.begin();
+    for (size_t i = 0; i < count; i++, ++position) {
+        identical = identical && array[i].position.x == position->position.x &&
+                    array[i].position.y == position->position.y &&
+                    particles.GetPositions()[i].x == array[i].position.x &&
+                    particles.GetPositions()[i].y == array[i].position.y;
+    }
+
+    std::printf("\n%zu particles, ms per update\n%-24s %12s %8s\n", count, "layout", "ms", "speedup");
+    for (const Layout& layout : layouts) {
+        std::printf("%-24s %12.2f %8.2f\n", layout.name.c_str(), layout.ms, layouts[0].ms / layout.ms);
+        Record("particles", layout.name, layout.ms, "ms");
+    }
+    if (!identical) {
+        std::printf("Particles  MISMATCH\n");
+    }
+    return identical;
+}
+
+bool BenchSpatialHash() {
+    // Boxes of 2 to 8 units moving through a world that grows with their number, so the density stays the same.
+    constexpr int frames = 4;
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    raylib::ThreadPool pool(hardware - 1);
+
+    auto elapsed = [](auto&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::printf("\nraylib::SpatialHash, moving boxes, ms per frame, %u threads for pairs\n", hardware);
+    std::printf(
+        "%-10s %10s %10s %10s %10s %12s %10s\n", "bodies", "add", "move", "pairs", "pool", "brute force", "pairs");
+    bool passed = true;
+    for (size_t count : {size_t{1000}, size_t{10000}, size_t{100000}, size_t{1000000}}) {
+        const float side = std::sqrt(static_cast<float>(count)) * 16.0f;
+        std::mt19937 random(5);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        std::uniform_real_distribution<float> size(2.0f, 8.0f);
+        std::uniform_real_distribution<float> speed(-2.0f, 2.0f);
+        std::vector<::Rectangle> bodies(count);
+        std::vector<::Vector2> velocities(count);
+        for (size_t i = 0; i < count; i++) {
+            bodies[i] = {coordinate(random), coordinate(random), size(random), size(random)};
+            velocities[i] = {speed(random), speed(random)};
+        }
+
+        raylib::SpatialHash hash(8.0f, count);
+        std::vector<raylib::SpatialHash::Handle> handles(count);
+        const double add = elapsed([&] {
+            for (size_t i = 0; i < count; i++) {
+                handles[i] = hash.Add(bodies[i]);
+            }
+        });
+
+        double move = 0.0;
+        double pairs = 0.0;
+        double pooled = 0.0;
+        std::vector<raylib::SpatialHash::Pair> found;
+        for (int frame = 0; frame < frames; frame++) {
+            move += elapsed([&] {
+                for (size_t i = 0; i < count; i++) {
+                    ::Rectangle& body = bodies[i];
+                    body.x = std::fmod(body.x + velocities[i].x + side, side);
+                    body.y = std::fmod(body.y + velocities[i].y + side, side);
+                    hash.Move(handles[i], body);
+                }
+            });
+            pairs += elapsed([&] { found = hash.GetPairs(); });
+            std::vector<raylib::SpatialHash::Pair> parallel;
+            pooled += elapsed([&] { parallel = hash.GetPairs(pool); });
+            passed = passed && parallel == found;
+        }
+
+        // Every pair against every other, only while that takes seconds rather than hours.
+        std::string brute = "-";
+        if (count <= 10000) {
+            std::vector<raylib::SpatialHash::Pair> expected;
+            const double ms = elapsed([&] {
+                for (size_t i = 0; i < count; i++) {
+                    for (size_t j = i + 1; j < count; j++) {
+                        if (::CheckCollisionRecs(bodies[i], bodies[j])) {
+                            expected.emplace_back(handles[i], handles[j]);
+                        }
+                    }
+                }
+            });
+            std::sort(found.begin(), found.end());
+            passed = passed && found == expected;
+            brute = std::to_string(ms).substr(0, std::to_string(ms).find('.') + 3);
+            Record("broadphase", "CheckCollisionRecs " + std::to_string(count), ms, "ms");
+        }
+
+        std::printf(
+            "%-10zu %10.2f %10.2f %10.2f %10.2f %12s %10zu%s\n",
+            count,
+            add,
+            move / frames,
+            pairs / frames,
+            pooled / frames,
+            brute.c_str(),
+            found.size(),
+            passed ? "" : "  MISMATCH");
+        const std::string suffix = " " + std::to_string(count);
+        Record("broadphase", "SpatialHash Add" + suffix, add, "ms");
+        Record("broadphase", "SpatialHash Move" + suffix, move / frames, "ms");
+        Record("broadphase", "SpatialHash GetPairs" + suffix, pairs / frames, "ms");
+        Record("broadphase", "SpatialHash GetPairs pool" + suffix, pooled / frames, "ms");
+    }
+    return passed;
+}
+
+bool BenchAABBTree() {
+    // Boxes of 1 to 4 units moving through a cube that grows with their number, so the density stays the same.
+    constexpr int frames = 4;
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    raylib::ThreadPool pool(hardware - 1);
+
+    auto elapsed = [](auto&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::printf("\nraylib::AABBTree, moving boxes, ms per frame, %u threads for pairs\n", hardware);
+    std::printf(
+        "%-10s %10s %10s %10s %10s %12s %10s\n", "bodies", "add", "move", "pairs", "pool", "brute force", "pairs");
+    bool passed = true;
+    for (size_t count : {size_t{1000}, size_t{10000}, size_t{100000}}) {
+        const float side = std::cbrt(static_cast<float>(count)) * 6.0f;
+        std::mt19937 random(9);
+        std::uniform_real_distribution<float> coordinate(0.0f, side);
+        std::uniform_real_distribution<float> size(1.0f, 4.0f);
+        std::uniform_real_distribution<float> speed(-0.2f, 0.2f);
+        std::vector<::BoundingBox> bodies(count);
+        std::vector<::Vector3> velocities(count);
+        for (size_t i = 0; i < count; i++) {
+            const ::Vector3 min{coordinate(random), coordinate(random), coordinate(random)};
+            bodies[i] = {min, {min.x + size(random), min.y + size(random), min.z + size(random)}};
+            velocities[i] = {speed(random), speed(random), speed(random)};
+        }
+
+        raylib::AABBTree tree(0.2f);
+        std::vector<raylib::AABBTree::Handle> handles(count);
+        const double add = elapsed([&] {
+            for (size_t i = 0; i < count; i++) {
+                handles[i] = tree.Add(bodies[i]);
+            }
+        });
+
+        double move = 0.0;
+        double pairs = 0.0;
+        double pooled = 0.0;
+        std::vector<raylib::AABBTree::Pair> found;
+        for (int frame = 0; frame < frames; frame++) {
+            move += elapsed([&] {
+                for (size_t i = 0; i < count; i++) {
+                    ::BoundingBox& body = bodies[i];
+                    const ::Vector3 v = velocities[i];
+                    body = {{body.min.x + v.x, body.min.y + v.y, body.min.z + v.z},
+                            {body.max.x + v.x, body.max.y + v.y, body.max.z + v.z}};
+                    tree.Move(handles[i], body, v);
+                }
+            });
+            pairs += elapsed([&] { found = tree.GetPairs(); });
+            std::vector<raylib::AABBTree::Pair> parallel;
+            pooled += elapsed([&] { parallel = tree.GetPairs(pool); });
+            passed = passed && parallel == found;
+        }
+
+        // Every pair against every other, only while that takes seconds rather than hours.
+        std::string brute = "-";
+        if (count <= 10000) {
+            std::vector<raylib::AABBTree::Pair> expected;
+            const double ms = elapsed([&] {
+                for (size_t i = 0; i < count; i++) {
+                    for (size_t j = i + 1; j < count; j++) {
+                        if (::CheckCollisionBoxes(bodies[i], bodies[j])) {
+                            expected.emplace_back(handles[i], handles[j]);
+                        }
+                    }
+                }
+            });
+            std::sort(found.begin(), found.end());
+            passed = passed && found == expected;
+            brute = std::to_string(ms).substr(0, std::to_string(ms).find('.') + 3);
+            Record("broadphase", "CheckCollisionBoxes " + std::to_string(count), ms, "ms");
+        }
+
+        std::printf(
+            "%-10zu %10.2f %10.2f %10.2f %10.2f %12s %10zu%s\n",
+            count,
+            add,
+            move / frames,
+            pairs / frames,
+            pooled / frames,
+            brute.c_str(),
+            found.size(),
+            passed ? "" : "  MISMATCH");
+        const std::string suffix = " " + std::to_string(count);
+        Record("broadphase", "AABBTree Add" + suffix, add, "ms");
+        Record("broadphase", "AABBTree Move" + suffix, move / frames, "ms");
+        Record("broadphase", "AABBTree GetPairs" + suffix, pairs / frames, "ms");
+        Record("broadphase", "AABBTree GetPairs pool" + suffix, pooled / frames, "ms");
+    }
+    return passed;
+}
+
+bool BenchCulling() {
+    // Bounds scattered through a cube around a camera at its center, so about a tenth of them are visible.
+    constexpr size_t count = 100000;
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    raylib::ThreadPool pool(hardware - 1);
+
+    std::mt19937 random(13);
+    std::uniform_real_distribution<float> coordinate(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(0.5f, 8.0f);
+    std::vector<::BoundingBox> boxes(count);
+    std::vector<raylib::culling::Sphere> spheres(count);
+    for (size_t i = 0; i < count; i++) {
+        const ::Vector3 center{coordinate(random), coordinate(random), coordinate(random)};
+        const ::Vector3 half{size(random), size(random), size(random)};
+        boxes[i] = {
+            {center.x - half.x, center.y - half.y, center.z - half.z},
+            {center.x + half.x, center.y + half.y, center.z + half.z}};
+        spheres[i] = {center, half.x};
+    }
+    const raylib::Camera3D camera({0, 0, 0}, {100, 20, 50}, {0, 1, 0}, 60);
+    const raylib::Frustum frustum = camera.GetFrustum(16.0 / 9.0);
+
+    // Best of a few runs, in milliseconds.
+    auto best = [](auto&& fn) {
+        double ms = 0.0;
+        for (int run = 0; run < 10; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            ms = run == 0 ? elapsed.count() : std::min(ms, elapsed.count());
+        }
+        return ms;
+    };
+
+    std::printf("\n%zu bounds against a camera frustum, ms per frame, %u threads for pool\n", count, hardware);
+    std::printf("%-10s %10s %10s %10s %8s %10s\n", "bounds", "scalar", "culling", "pool", "speedup", "visible");
+    bool passed = true;
+    auto bench = [&](const char* name, const auto& bounds, auto test) {
+        std::vector<int> expected;
+        std::vector<int> visible;
+        std::vector<int> parallel;
+        const double scalar = best([&] {
+            expected.clear();
+            for (size_t i = 0; i < bounds.size(); i++) {
+                if (test(bounds[i])) {
+                    expected.push_back(static_cast<int>(i));
+                }
+            }
+        });
+        const double batched = best([&] { raylib::culling::GetVisible(frustum, std::span(bounds), visible); });
+        const double pooled = best([&] { raylib::culling::GetVisible(frustum, std::span(bounds), parallel, pool); });
+        const bool same = visible == expected && parallel == expected;
+        passed = passed && same;
+
+        std::printf(
+            "%-10s %10.3f %10.3f %10.3f %8.2f %10zu%s\n",
+            name,
+            scalar,
+            batched,
+            pooled,
+            scalar / batched,
+            visible.size(),
+            same ? "" : "  MISMATCH");
+        Record("culling", std::string("Frustum::CheckCollision ") + name, scalar, "ms");
+        Record("culling", std::string("culling::GetVisible ") + name, batched, "ms");
+        Record("culling", std::string("culling::GetVisible pool ") + name, pooled, "ms");
+    };
+    bench("boxes", boxes, [&frustum](const ::BoundingBox& box) { return frustum.CheckCollision(box); });
+    bench("spheres", spheres, [&frustum](const raylib::culling::Sphere& sphere) {
+        return frustum.CheckCollision(sphere.center, sphere.radius);
+    });
+    return passed;
+}
+
+void BenchWave() {
+    // Ten seconds of a stereo 16 bit 440Hz sine.
+    const unsigned int frameCount = 441000;
+    auto* samples = static_cast<short*>(::MemAlloc(frameCount * 2 * sizeof(short)));
+    for (unsigned int frame = 0; frame < frameCount; frame++) {
+        const auto value = static_cast<short>(16000.0 * std::sin(2.0 * PI * 440.0 * frame / 44100.0));
+        samples[frame * 2] = value;
+        samples[frame * 2 + 1] = value;
+    }
+    const raylib::Wave source(frameCount, 44100, 16, 2, samples);
+
+    struct WaveOp {
+        const char* name;
+        int sampleRate;
+        int sampleSize;
+        int channels;
+    };
+    const std::vector<WaveOp> ops = {
+        {"16 bit to 32 bit", 44100, 32, 2},
+        {"16 bit to 8 bit", 44100, 8, 2},
+        {"stereo to mono", 44100, 16, 1},
+        {"44100Hz to 48000Hz", 48000, 16, 2},
+        {"44100Hz to 22050Hz", 22050, 16, 2},
+    };
+
+    std::printf("\nWave 10s 44100Hz 16 bit stereo, %s\n", raylib::simd::name);
+    std::printf("%-20s %12s %12s %8s\n", "conversion", "raylib ms", "kernels ms", "speedup");
+    for (const WaveOp& op : ops) {
+        raylib::Wave expected;
+        raylib::Wave result;
+        const double generic =
+            Time(source, [&op](raylib::Wave& w) { w.Format(op.sampleRate, op.sampleSize, op.channels); }, expected);
+        const double kernels =
+            Time(source, [&op](raylib::Wave& w) { w.Convert(op.sampleRate, op.sampleSize, op.channels); }, result);
+        std::printf("%-20s %12.2f %12.2f %8.2f\n", op.name, generic, kernels, generic / kernels);
+        Record("wave", op.name, generic, "ms");
+        Record("wave", std::string(op.name) + " kernels", kernels, "ms");
+    }
+}
+
+bool BenchParallelImage(int size) {
+    raylib::Image source(::GenImageGradientRadial(size, size, 0.2f, ORANGE, {20, 40, 200, 96}));
+
+    const float blur[9] = {1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f, 1 / 9.0f};
+    struct ImageOp {
+        const char* name;
+        std::function<void(raylib::Image&)> serial;
+        std::function<void(raylib::Image&, raylib::ThreadPool&)> parallel;
+    };
+    const std::vector<ImageOp> ops = {
+        {"ColorTint",
+         [](raylib::Image& i) { i.ColorTint(SKYBLUE); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.ColorTint(SKYBLUE, p); }},
+        {"ColorGrayscale",
+         [](raylib::Image& i) { i.ColorGrayscale(); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.ColorGrayscale(p); }},
+        {"ColorContrast",
+         [](raylib::Image& i) { i.ColorContrast(30); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.ColorContrast(30, p); }},
+        {"ColorBrightness",
+         [](raylib::Image& i) { i.ColorBrightness(40); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.ColorBrightness(40, p); }},
+        {"AlphaPremultiply",
+         [](raylib::Image& i) { i.AlphaPremultiply(); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.AlphaPremultiply(p); }},
+        {"KernelConvolution",
+         [&blur](raylib::Image& i) { i.KernelConvolution(blur, 9); },
+         [&blur](raylib::Image& i, raylib::ThreadPool& p) { i.KernelConvolution(blur, 9, p); }},
+        {"RotateCW",
+         [](raylib::Image& i) { i.RotateCW(); },
+         [](raylib::Image& i, raylib::ThreadPool& p) { i.RotateCW(p); }},
+    };
+
+    // 1, 2, 4, ... threads, up to the hardware thread count.
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threads = 1; threads < hardware; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware);
+
+    std::printf("\nImage %ix%i, %u hardware threads\n", size, size, hardware);
+    std::printf("%-20s %8s %12s %8s\n", "operation", "threads", "ms", "speedup");
+
+    bool passed = true;
+    for (const ImageOp& op : ops) {
+        raylib::Image expected;
+        const double serial = Time(source, op.serial, expected);
+        std::printf("%-20s %8s %12.2f %8.2f\n", op.name, "serial", serial, 1.0);
+        Record("parallel", std::string(op.name) + " serial", serial, "ms");
+
+        for (unsigned int threads : threadCounts) {
+            raylib::ThreadPool pool(threads - 1);
+            raylib::Image result;
+            const double parallel = Time(source, [&](raylib::Image& image) { op.parallel(image, pool); }, result);
+            const bool identical = Identical(expected, result);
+            passed = passed && identical;
+            std::printf(
+                "%-20s %8u %12.2f %8.2f%s\n",
+                op.name,
+                threads,
+                parallel,
+                serial / parallel,
+                identical ? "" : "  MISMATCH");
+            Record("parallel", std::string(op.name) + " " + std::to_string(threads) + " threads", parallel, "ms");
+        }
+    }
+
+    return passed;
+}
+
+bool BenchJobs() {
+    // A loop with enough work per index for the chunks to outweigh the scheduling.
+    constexpr size_t count = size_t{1} << 22;
+    constexpr size_t grain = 16384;
+    std::vector<float> output(count);
+    auto work = [&output](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const auto x = static_cast<float>(i);
+            output[i] = std::sqrt(x) * std::sin(x * 0.001f) + std::cos(x * 0.002f);
+        }
+    };
+    work(0, count);
+    const std::vector<float> expected = output;
+
+    const unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threads = 1; threads < hardware; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware);
+
+    auto best = [](auto&& fn) {
+        double result = 0.0;
+        for (int run = 0; run < 5; run++) {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            result = run == 0 ? elapsed.count() : std::min(result, elapsed.count());
+        }
+        return result;
+    };
+
+    std::printf("\nThreadPool, %u hardware threads\n", hardware);
+    std::printf("%-20s %8s %12s %8s\n", "workload", "threads", "ms", "speedup");
+
+    bool passed = true;
+    double loopBase = 0.0;
+    double graphBase = 0.0;
+    for (unsigned int threads : threadCounts) {
+        raylib::ThreadPool pool(threads - 1);
+
+        std::fill(output.begin(), output.end(), 0.0f);
+        const double loop = best([&] { pool.ParallelFor(0, count, grain, work); });
+        const bool identical = output == expected;
+        passed = passed && identical;
+
+        // 16 layers of 256 jobs, each layer waiting for the one before.
+        const double graph = best([&] {
+            std::vector<raylib::JobCounter> layers(16);
+            for (size_t layer = 0; layer < layers.size(); layer++) {
+                for (size_t job = 0; job < 256; job++) {
+                    const size_t begin = (layer * 256 + job) * (count / 4096);
+                    const size_t end = begin + count / 4096;
+                    auto task = [&work, begin, end] { work(begin, end); };
+                    if (layer == 0) {
+                        pool.Submit(task, layers[layer]);
+                    } else {
+                        pool.Submit(task, layers[layer - 1], layers[layer]);
+                    }
+                }
+            }
+            pool.Wait(layers.back());
+        });
+
+        // Scheduling overhead alone, in nanoseconds per job.
+        const double empty = best([&] {
+            raylib::JobCounter counter;
+            for (int job = 0; job < 10000; job++) {
+                pool.Submit([] {}, counter);
+            }
+            pool.Wait(counter);
+        }) * 1e6 / 10000;
+
+        if (threads == 1) {
+            loopBase = loop;
+            graphBase = graph;
+        }
+        std::printf("%-20s %8u %12.2f %8.2f%s\n", "ParallelFor", threads, loop, loopBase / loop,
+                    identical ? "" : "  MISMATCH");
+        std::printf("%-20s %8u %12.2f %8.2f\n", "job graph", threads, graph, graphBase / graph);
+        std::printf("%-20s %8u %12.2f %8s\n", "empty job (ns)", threads, empty, "");
+        const std::string suffix = " " + std::to_string(threads) + " threads";
+        Record("jobs", "ParallelFor" + suffix, loop, "ms");
+        Record("jobs", "job graph" + suffix, graph, "ms");
+        Record("jobs", "empty job" + suffix, empty, "ns");
+    }
+
+    return passed;
+}
+
+bool BenchPixelKernels() {
+    struct KernelOp {
+        const char* name;
+        std::function<void(raylib::Image&)> generic;
+        std::function<void(raylib::Image&)> simd;
+    };
+    const std::vector<KernelOp> ops = {
+        {"ColorTint",
+         [](raylib::Image& i) { ::ImageColorTint(&i, SKYBLUE); },
+         [](raylib::Image& i) { i.ColorTint(SKYBLUE); }},
+        {"ColorInvert",
+         [](raylib::Image& i) { ::ImageColorInvert(&i); },
+         [](raylib::Image& i) { i.ColorInvert(); }},
+        {"ColorReplace",
+         [](raylib::Image& i) { ::ImageColorReplace(&i, ORANGE, GREEN); },
+         [](raylib::Image& i) { i.ColorReplace(ORANGE, GREEN); }},
+        {"ColorBrightness",
+         [](raylib::Image& i) { ::ImageColorBrightness(&i, -40); },
+         [](raylib::Image& i) { i.ColorBrightness(-40); }},
+        {"AlphaPremultiply",
+         [](raylib::Image& i) { ::ImageAlphaPremultiply(&i); },
+         [](raylib::Image& i) { i.AlphaPremultiply(); }},
+        {"AlphaClear",
+         [](raylib::Image& i) { ::ImageAlphaClear(&i, BLANK, 0.5f); },
+         [](raylib::Image& i) { i.AlphaClear(BLANK, 0.5f); }},
+    };
+
+    std::printf("\nR8G8B8A8 kernels, %s\n", raylib::simd::name);
+    std::printf("%-20s %10s %12s %12s %8s\n", "operation", "size", "generic ms", "simd ms", "speedup");
+
+    bool passed = true;
+    const int sizes[2][2] = {{1920, 1080}, {3840, 2160}};
+    for (const auto& size : sizes) {
+        raylib::Image source(::GenImageGradientRadial(size[0], size[1], 0.2f, ORANGE, {20, 40, 200, 96}));
+        const std::string suffix = " " + std::to_string(size[0]) + "x" + std::to_string(size[1]);
+        for (const KernelOp& op : ops) {
+            raylib::Image expected;
+            raylib::Image result;
+            const double generic = Time(source, op.generic, expected);
+            const double simd = Time(source, op.simd, result);
+            const bool identical = Identical(expected, result);
+            passed = passed && identical;
+            std::printf(
+                "%-20s %5ix%-4i %12.2f %12.2f %8.2f%s\n",
+                op.name,
+                size[0],
+                size[1],
+                generic,
+                simd,
+                generic / simd,
+                identical ? "" : "  MISMATCH");
+            Record("pixels", op.name + suffix + " generic", generic, "ms");
+            Record("pixels", op.name + suffix + " simd", simd, "ms");
+        }
+    }
+
+    return passed;
+}
+
+bool BenchAssetArchive(int count) {
+    const std::string directory = "bench_assets/";
+    const std::string archiveName = "bench_assets.pak";
+    // Remove the images and the archive however the benchmark ends.
+    struct Cleanup {
+        const std::string& directory;
+        const std::string& archiveName;
+        ~Cleanup() {
+            std::error_code error;
+            std::filesystem::remove_all(directory, error);
+            std::filesystem::remove(archiveName, error);
+        }
+    } cleanup{directory, archiveName};
+    ::MakeDirectory(directory.c_str());
+    std::vector<std::string> files;
+    for (int i = 0; i < count; i++) {
+        raylib::Image image(::GenImageChecked(32, 32, 1 + i % 8, 1 + i % 5, ORANGE, {20, 40, 200, 96}));
+        files.push_back(directory + "image" + std::to_string(i) + ".png");
+        image.Export(files.back());
+    }
+    raylib::AssetArchive::Pack(archiveName, files, directory);
+
+    std::printf("\nAssetArchive, %i images\n", count);
+    std::printf("%-20s %12s %8s\n", "load", "ms", "speedup");
+
+    std::vector<raylib::Image> loose(files.size());
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < files.size(); i++) {
+        loose[i].Load(files[i]);
+    }
+    const std::chrono::duration<double, std::milli> looseTime = std::chrono::steady_clock::now() - start;
+    std::printf("%-20s %12.2f %8.2f\n", "loose files", looseTime.count(), 1.0);
+    Record("archive", "loose files", looseTime.count(), "ms");
+
+    std::vector<raylib::Image> packed(files.size());
+    start = std::chrono::steady_clock::now();
+    raylib::AssetArchive archive(archiveName);
+    for (size_t i = 0; i < files.size(); i++) {
+        packed[i] = archive.LoadImage("image" + std::to_string(i) + ".png");
+    }
+    const std::chrono::duration<double, std::milli> packedTime = std::chrono::steady_clock::now() - start;
+    Record("archive", "archive", packedTime.count(), "ms");
+
+    bool passed = true;
+    for (size_t i = 0; i < files.size(); i++) {
+        passed = passed && Identical(loose[i], packed[i]);
+    }
+    std::printf(
+        "%-20s %12.2f %8.2f%s\n",
+        "archive",
+        packedTime.count(),
+        looseTime.count() / packedTime.count(),
+        passed ? "" : "  MISMATCH");
+    return passed;
+}
+
+bool WriteCsv(const std::string& fileName) {
+    std::ofstream output(fileName);
+    output << "group,name,value,unit\n";
+    for (const Result& result : results) {
+        output << result.group << ',' << result.name << ',' << result.value << ',' << result.unit << '\n';
+    }
+    return static_cast<bool>(output);
+}
+
+/**
+ * Print the change of every result that is also in the baseline CSV file.
+ */
+bool CompareCsv(const std::string& fileName) {
+    std::ifstream input(fileName);
+    if (!input) {
+        return false;
+    }
+    std::map<std::string, double> baseline;
+    std::string line;
+    std::getline(input, line);
+    while (std::getline(input, line)) {
+        std::istringstream fields(line);
+        std::string group;
+        std::string name;
+        std::string value;
+        if (std::getline(fields, group, ',') && std::getline(fields, name, ',') && std::getline(fields, value, ',')) {
+            baseline[group + "," + name] = std::atof(value.c_str());
+        }
+    }
+
+    std::printf("\nCompared to %s\n", fileName.c_str());
+    std::printf("%-12s %-36s %12s %12s %8s\n", "group", "name", "baseline", "current", "change");
+    for (const Result& result : results) {
+        auto it = baseline.find(result.group + "," + result.name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            continue;
+        }
+        const double change = (result.value - it->second) / it->second * 100.0;
+        std::printf(
+            "%-12s %-36s %12.2f %12.2f %+7.1f%%%s\n",
+            result.group.c_str(),
+            result.name.c_str(),
+            it->second,
+            result.value,
+            change,
+            change > 10.0 ? "  SLOWER" : "");
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SetTraceLogLevel(LOG_WARNING);
+
+    int size = 4096;
+    std::string filter;
+    std::string csvFile;
+    std::string baselineFile;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csvFile = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            baselineFile = argv[++i];
+        } else {
+            size = std::atoi(argv[i]);
+        }
+    }
+    auto enabled = [&filter](const char* group) { return std::string(group).find(filter) != std::string::npos; };
+
+    bool passed = true;
+    const Inputs inputs;
+    if (enabled("math") || enabled("expr") || enabled("color") || enabled("collision") || enabled("text")) {
+        std::printf("%-12s %-36s %12s\n", "group", "name", "ns");
+    }
+    if (enabled("math")) {
+        BenchMath(inputs);
+    }
+    if (enabled("expr")) {
+        BenchExpression();
+    }
+    if (enabled("color")) {
+        BenchColor(inputs);
+    }
+    if (enabled("collision")) {
+        BenchCollision(inputs);
+        passed = BenchMeshBVH() && passed;
+        passed = BenchRayKernels() && passed;
+    }
+    if (enabled("text")) {
+        passed = BenchText() && passed;
+    }
+    if (enabled("image")) {
+        BenchImage();
+    }
+    if (enabled("sprites")) {
+        BenchSprites();
+    }
+    if (enabled("particles")) {
+        passed = BenchParticles() && passed;
+    }
+    if (enabled("broadphase")) {
+        passed = BenchSpatialHash() && passed;
+        passed = BenchAABBTree() && passed;
+    }
+    if (enabled("culling")) {
+        passed = BenchCulling() && passed;
+    }
+    if (enabled("wave")) {
+        BenchWave();
+    }
+    if (enabled("parallel")) {
+        passed = BenchParallelImage(size) && passed;
+    }
+    if (enabled("jobs")) {
+        passed = BenchJobs() && passed;
+    }
+    if (enabled("pixels")) {
+        passed = BenchPixelKernels() && passed;
+    }
+    if (enabled("archive")) {
+        passed = BenchAssetArchive(2000) && passed;
+    }
+
+    if (!csvFile.empty() && !WriteCsv(csvFile)) {
+        std::fprintf(stderr, "Failed to write %s\n", csvFile.c_str());
+        return 1;
+    }
+    if (!baselineFile.empty() && !CompareCsv(baselineFile)) {
+        std::fprintf(stderr, "Failed to read %s\n", baselineFile.c_str());
+        return 1;
+    }
+
+    return passed ? 0 : 1;
+}
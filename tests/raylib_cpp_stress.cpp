@@ -0,0 +1,170 @@
+#include "raylib-assert.h"
+#include "raylib-cpp.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Hammers raylib::ThreadPool, raylib::JobCounter and raylib::AudioRingBuffer from many threads at once. Build it
+// with -DRAYLIB_CPP_TSAN=ON to run it under ThreadSanitizer.
+int main() {
+    TraceLog(LOG_INFO, "---------------------");
+    TraceLog(LOG_INFO, "TEST: raylib-cpp stress test");
+
+    raylib::ThreadPool pool(std::max(3u, raylib::ThreadPool::DefaultWorkerCount()));
+
+    // Random job graphs: every job adds its input values, written by the jobs it depends on.
+    {
+        std::uint32_t seed = 12345;
+        auto random = [&seed](std::uint32_t range) {
+            seed = seed * 1664525u + 1013904223u;
+            return (seed >> 8) % range;
+        };
+
+        for (int round = 0; round < 200; round++) {
+            const std::size_t layers = 2 + random(6);
+            const std::size_t width = 1 + random(24);
+            std::vector<std::unique_ptr<raylib::JobCounter>> counters;
+            std::vector<std::vector<std::uint64_t>> values(layers, std::vector<std::uint64_t>(width, 0));
+
+            for (std::size_t layer = 0; layer < layers; layer++) {
+                counters.push_back(std::make_unique<raylib::JobCounter>());
+                for (std::size_t i = 0; i < width; i++) {
+                    auto job = [&values, layer, i, width] {
+                        std::uint64_t sum = 1;
+                        if (layer > 0) {
+                            for (std::size_t j = 0; j < width; j++) {
+                                sum += values[layer - 1][j];
+                            }
+                        }
+                        values[layer][i] = sum + i;
+                    };
+                    if (layer == 0) {
+                        pool.Submit(job, *counters[layer]);
+                    } else if (random(8) == 0) {
+                        pool.SubmitMainThread(job, *counters[layer - 1], *counters[layer]);
+                    } else {
+                        pool.Submit(job, *counters[layer - 1], *counters[layer]);
+                    }
+                }
+            }
+            pool.Wait(*counters.back());
+
+            // The same graph, serially.
+            std::vector<std::uint64_t> expected(width, 0);
+            for (std::size_t layer = 0; layer < layers; layer++) {
+                std::uint64_t previous = 0;
+                for (std::uint64_t value : expected) {
+                    previous += value;
+                }
+                for (std::size_t i = 0; i < width; i++) {
+                    expected[i] = 1 + previous + i;
+                }
+            }
+            Assert(values.back() == expected, "Job graph %i computed the wrong result", round);
+        }
+    }
+
+    // Jobs that spawn more jobs on the same counter, from the workers.
+    {
+        std::atomic<int> leaves{0};
+        raylib::JobCounter counter;
+        std::function<void(int)> spawn = [&](int depth) {
+            if (depth == 0) {
+                leaves.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            for (int i = 0; i < 4; i++) {
+                pool.Submit([&spawn, depth] { spawn(depth - 1); }, counter);
+            }
+        };
+        pool.Submit([&spawn] { spawn(6); }, counter);
+        pool.Wait(counter);
+        AssertEqual(leaves.load(), 4096);
+    }
+
+    // Counters that are destroyed as soon as they are done, while the last job may still be signalling.
+    {
+        for (int round = 0; round < 2000; round++) {
+            int value = 0;
+            {
+                raylib::JobCounter first, second;
+                pool.Submit([&value] { value++; }, first);
+                pool.Submit([&value] { value++; }, first, second);
+                pool.Wait(second);
+            }
+            AssertEqual(value, 2);
+        }
+    }
+
+    // Several threads submitting and waiting at the same time, with the main thread running its queue.
+    {
+        std::atomic<int> total{0};
+        std::atomic<int> mainTotal{0};
+        std::atomic<bool> submitting{true};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&] {
+                for (int round = 0; round < 100; round++) {
+                    raylib::JobCounter counter, after;
+                    pool.ParallelFor(0, 256, 16, [&total](std::size_t begin, std::size_t end) {
+                        total.fetch_add(static_cast<int>(end - begin), std::memory_order_relaxed);
+                    }, counter);
+                    pool.SubmitMainThread([&mainTotal] { mainTotal.fetch_add(1, std::memory_order_relaxed); },
+                                          counter, after);
+                    // Only the main thread runs main thread tasks, so this thread can't wait for `after`.
+                    pool.Wait(counter);
+                    while (!after.IsDone()) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        std::thread stop([&] {
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            submitting.store(false);
+        });
+        while (submitting.load() || pool.GetMainThreadTaskCount() > 0) {
+            pool.RunMainThreadTasks();
+        }
+        stop.join();
+        AssertEqual(total.load(), 4 * 100 * 256);
+        AssertEqual(mainTotal.load(), 4 * 100);
+    }
+
+    // An audio ring buffer with a producer and a consumer that both wrap around it many times, in uneven steps.
+    {
+        raylib::AudioRingBuffer ring(64, 32, 1);
+        constexpr std::uint32_t frameTotal = 200000;
+        std::thread consumer([&ring] {
+            std::uint32_t expected = 0;
+            std::uint32_t out[37];
+            while (expected < frameTotal) {
+                const unsigned int count = ring.Read(out, 1 + expected % 37);
+                for (unsigned int i = 0; i < count; i++) {
+                    AssertEqual(out[i], expected++);
+                }
+            }
+        });
+        std::uint32_t next = 0;
+        std::uint32_t chunk[53];
+        while (next < frameTotal) {
+            const auto count = static_cast<unsigned int>(std::min<std::uint32_t>(1 + next % 53, frameTotal - next));
+            for (unsigned int i = 0; i < count; i++) {
+                chunk[i] = next + i;
+            }
+            next += ring.Write(chunk, count);
+        }
+        consumer.join();
+        AssertEqual(ring.GetStats().read, static_cast<std::uint64_t>(frameTotal));
+    }
+
+    TraceLog(LOG_INFO, "TEST: raylib-cpp stress test Pass");
+    return 0;
+}
@@ -1,8 +1,132 @@
 #include "raylib-assert.h"
 #include "raylib-cpp.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+namespace {
+template<typename T>
+T Sorted(T values) {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+/**
+ * A broadphase next to a plain list of its proxies, to check its answers against brute force.
+ */
+template<typename Broadphase, typename Bounds>
+struct BroadphaseCheck {
+    using Handle = typename Broadphase::Handle;
+    using Pair = typename Broadphase::Pair;
+
+    Broadphase& broadphase;
+    const char* name;
+    /** The narrow phase the broadphase's pairs and box queries use */
+    bool (*overlaps)(Bounds, Bounds);
+    std::vector<Bounds> bounds{};
+    std::vector<Handle> handles{};
+    std::vector<bool> alive{};
+
+    void Add(const Bounds& proxy) {
+        bounds.push_back(proxy);
+        handles.push_back(broadphase.Add(proxy));
+        alive.push_back(true);
+    }
+
+    void Remove(std::size_t index) {
+        broadphase.Remove(handles[index]);
+        alive[index] = false;
+    }
+
+    /** The pairs of proxies still in the broadphase, by testing every two */
+    std::vector<Pair> ExpectedPairs() const {
+        std::vector<Pair> pairs;
+        for (std::size_t i = 0; i < bounds.size(); i++) {
+            for (std::size_t j = i + 1; j < bounds.size(); j++) {
+                if (alive[i] && alive[j] && overlaps(bounds[i], bounds[j])) {
+                    pairs.emplace_back(std::min(handles[i], handles[j]), std::max(handles[i], handles[j]));
+                }
+            }
+        }
+        return Sorted(pairs);
+    }
+
+    /** Whether a query found the proxies still in the broadphase that pass `test` */
+    template<typename F>
+    bool Matches(const std::vector<Handle>& found, F&& test) const {
+        std::vector<Handle> expected;
+        for (std::size_t i = 0; i < bounds.size(); i++) {
+            if (alive[i] && test(bounds[i])) {
+                expected.push_back(handles[i]);
+            }
+        }
+        return Sorted(found) == Sorted(expected);
+    }
+
+    bool PairsMatch() const { return Sorted(broadphase.GetPairs()) == ExpectedPairs(); }
+
+    /**
+     * Move the first `moving` proxies for a few frames, some a little and some a lot, then remove every seventh
+     * and add a few. `place(i, time)` gives the bounds of proxy `i`, and `move(handle, bounds)` moves one.
+     */
+    template<typename Place, typename Move>
+    void Churn(std::size_t moving, Place place, Move move) {
+        for (int frame = 1; frame <= 3; frame++) {
+            for (std::size_t i = 0; i < moving; i++) {
+                bounds[i] = place(static_cast<int>(i), static_cast<float>(frame) * (i % 3 == 0 ? 0.001f : 0.4f));
+                move(handles[i], bounds[i]);
+            }
+            Assert(PairsMatch(), "Expected %s pairs to match brute force after moving", name);
+        }
+
+        const Handle highest = *std::max_element(handles.begin(), handles.end());
+        std::size_t removed = 0;
+        for (std::size_t i = 0; i < moving; i += 7) {
+            Remove(i);
+            removed++;
+        }
+        Assert(!broadphase.IsValid(handles[0]), "Expected a removed %s handle to be invalid", name);
+        for (int i = 0; i < 20; i++) {
+            Add(place(i + 1000, 1.0f));
+        }
+        Assert(handles.back() <= highest, "Expected the %s to reuse removed handles", name);
+        AssertEqual(broadphase.GetCount(), bounds.size() - removed);
+        Assert(PairsMatch(), "Expected %s pairs to match brute force after removing", name);
+
+        // Chunks on a thread pool give the same pairs, in the same order.
+        raylib::ThreadPool pool(3);
+        Assert(broadphase.GetPairs(pool, 64) == broadphase.GetPairs(), "Expected the same %s pairs in parallel", name);
+
+        bool thrown = false;
+        try {
+            broadphase.Move(handles[0], bounds[0]);
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected a removed %s handle to throw", name);
+    }
+
+    void Clear() {
+        broadphase.Clear();
+        Assert(broadphase.IsEmpty() && broadphase.GetPairs().empty(), "Expected a cleared %s to be empty", name);
+    }
+};
+} // namespace
+
 int main(int argc, char* argv[]) {
     TraceLog(LOG_INFO, "---------------------");
     TraceLog(LOG_INFO, "TEST: raylib-cpp test");
@@ -56,6 +180,268 @@ int main(int argc, char* argv[]) {
         AssertEqual((int)newDirection.x, 57);
     }
 
+    // constexpr
+    {
+        constexpr raylib::Vector2 v2 = raylib::Vector2(10, 20) + raylib::Vector2(5, 5) * 2.0f;
+        static_assert(v2 == raylib::Vector2(20, 30));
+        static_assert(v2.DotProduct(raylib::Vector2(1, 2)) == 80.0f);
+        static_assert(raylib::Vector2(3, 4).LengthSqr() == 25.0f);
+
+        constexpr raylib::Vector3 v3 = raylib::Vector3(1, 0, 0).CrossProduct(raylib::Vector3(0, 1, 0));
+        static_assert(v3 == raylib::Vector3(0, 0, 1));
+        static_assert(raylib::Vector3(1, 2, 3).Lerp(raylib::Vector3(3, 4, 5), 0.5f) == raylib::Vector3(2, 3, 4));
+        static_assert(-raylib::Vector3(1, 2, 3) == raylib::Vector3(-1, -2, -3));
+
+        constexpr raylib::Vector4 q = raylib::Vector4::Identity() * raylib::Vector4(1, 2, 3, 4);
+        static_assert(q == raylib::Vector4(1, 2, 3, 4));
+
+        static_assert(raylib::Color(255, 0, 0, 255).ToInt() == static_cast<int>(0xFF0000FF));
+        static_assert(raylib::Color::Red().Alpha(0.0f).a == 0);
+        static_assert(raylib::Color::White().Tint(raylib::Color::Black()) == raylib::Color(0, 0, 0, 255));
+
+        constexpr raylib::Rectangle rect(0, 0, 10, 10);
+        static_assert(rect.CheckCollision(raylib::Rectangle(5, 5, 10, 10)));
+        static_assert(!rect.CheckCollision(raylib::Vector2(10, 5)));
+        static_assert(rect.GetSize() == raylib::Vector2(10, 10));
+
+        // constexpr results match raymath/raylib exactly at runtime.
+        raylib::Vector2 a2(1.5f, -2.25f);
+        raylib::Vector2 b2(0.3f, 7.1f);
+        AssertEqual(a2.Add(b2), raylib::Vector2(::Vector2Add(a2, b2)));
+        AssertEqual(a2.Lerp(b2, 0.3f), raylib::Vector2(::Vector2Lerp(a2, b2, 0.3f)));
+
+        raylib::Vector3 a3(1.5f, -2.25f, 0.7f);
+        raylib::Vector3 b3(0.3f, 7.1f, -4.2f);
+        raylib::Matrix transform = raylib::Matrix::Translate(1, 2, 3) * raylib::Matrix::RotateXYZ({0.5f, 1.0f, 1.5f});
+        AssertEqual(a3.CrossProduct(b3), raylib::Vector3(::Vector3CrossProduct(a3, b3)));
+        AssertEqual(a3.Transform(transform), raylib::Vector3(::Vector3Transform(a3, transform)));
+
+        raylib::Vector4 qa(0.1f, 0.2f, 0.3f, 0.9f);
+        raylib::Vector4 qb(-0.4f, 0.5f, 0.1f, 0.7f);
+        AssertEqual(qa.Multiply(qb), raylib::Vector4(::QuaternionMultiply(qa, qb)));
+
+        raylib::Color c1(200, 120, 40, 255);
+        raylib::Color c2(10, 250, 90, 128);
+        AssertEqual(c1.Lerp(c2, 0.35f), raylib::Color(::ColorLerp(c1, c2, 0.35f)));
+        AssertEqual(c1.Tint(c2), raylib::Color(::ColorTint(c1, c2)));
+        AssertEqual(c1.Fade(0.4f), raylib::Color(::Fade(c1, 0.4f)));
+
+        raylib::Rectangle r1(0.5f, 1.5f, 10.0f, 4.0f);
+        raylib::Rectangle r2(10.5f, 2.0f, 3.0f, 3.0f);
+        AssertEqual(r1.CheckCollision(r2), ::CheckCollisionRecs(r1, r2));
+    }
+
+    // BatchMath
+    {
+        std::vector<raylib::Vector2> a2;
+        std::vector<raylib::Vector2> b2;
+        std::vector<raylib::Vector3> a3;
+        std::vector<raylib::Vector3> b3;
+        for (int i = 0; i < 1003; i++) {
+            float f = static_cast<float>(i);
+            a2.emplace_back(f * 0.5f - 100.0f, 3.0f - f);
+            b2.emplace_back(f * 0.25f, f * -2.0f + 7.0f);
+            a3.emplace_back(f * 0.5f - 100.0f, 3.0f - f, f * 0.125f);
+            b3.emplace_back(f * 0.25f, f * -2.0f + 7.0f, 1.0f - f * 0.75f);
+        }
+        a2[10] = raylib::Vector2(0, 0);
+        a3[10] = raylib::Vector3(0, 0, 0);
+        raylib::Matrix transform = raylib::Matrix::Translate(1, 2, 3) * raylib::Matrix::RotateXYZ({0.5f, 1.0f, 1.5f});
+
+        std::vector<raylib::Vector2> out2(a2.size());
+        std::vector<raylib::Vector3> out3(a3.size());
+        raylib::batch::Add(a2, b2, out2);
+        raylib::batch::Add(a3, b3, out3);
+        for (size_t i = 0; i < a2.size(); i++) {
+            Assert(out2[i].Equals(a2[i].Add(b2[i])), "batch::Add(Vector2) mismatch at %i", static_cast<int>(i));
+            Assert(
+                out3[i].Distance(a3[i].Add(b3[i])) < 0.0001f,
+                "batch::Add(Vector3) mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        raylib::batch::Scale(a2, 3.5f, out2);
+        raylib::batch::Scale(a3, 3.5f, out3);
+        for (size_t i = 0; i < a2.size(); i++) {
+            Assert(out2[i].Equals(a2[i].Scale(3.5f)), "batch::Scale(Vector2) mismatch at %i", static_cast<int>(i));
+            Assert(
+                out3[i].Distance(a3[i].Scale(3.5f)) < 0.0001f,
+                "batch::Scale(Vector3) mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        raylib::batch::Normalize(a2, out2);
+        raylib::batch::Normalize(a3, out3);
+        for (size_t i = 0; i < a2.size(); i++) {
+            Assert(out2[i].Equals(a2[i].Normalize()), "batch::Normalize(Vector2) mismatch at %i", static_cast<int>(i));
+            Assert(
+                out3[i].Distance(a3[i].Normalize()) < 0.0001f,
+                "batch::Normalize(Vector3) mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        raylib::batch::Transform(a2, transform, out2);
+        raylib::batch::Transform(a3, transform, out3);
+        for (size_t i = 0; i < a2.size(); i++) {
+            Assert(
+                out2[i].Equals(a2[i].Transform(transform)),
+                "batch::Transform(Vector2) mismatch at %i",
+                static_cast<int>(i));
+            Assert(
+                out3[i].Distance(a3[i].Transform(transform)) < 0.001f,
+                "batch::Transform(Vector3) mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        raylib::batch::Lerp(a2, b2, 0.3f, out2);
+        raylib::batch::Lerp(a3, b3, 0.3f, out3);
+        for (size_t i = 0; i < a2.size(); i++) {
+            Assert(out2[i].Equals(a2[i].Lerp(b2[i], 0.3f)), "batch::Lerp(Vector2) mismatch at %i", static_cast<int>(i));
+            Assert(
+                out3[i].Distance(a3[i].Lerp(b3[i], 0.3f)) < 0.0001f,
+                "batch::Lerp(Vector3) mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        // Structure-of-arrays views, updated in place.
+        std::vector<float> x(a3.size());
+        std::vector<float> y(a3.size());
+        std::vector<float> z(a3.size());
+        for (size_t i = 0; i < a3.size(); i++) {
+            x[i] = a3[i].x;
+            y[i] = a3[i].y;
+            z[i] = a3[i].z;
+        }
+        raylib::Vector3SoA<> soa{x, y, z};
+        raylib::batch::Transform(soa, transform, soa);
+        raylib::batch::Normalize(soa, soa);
+        for (size_t i = 0; i < a3.size(); i++) {
+            raylib::Vector3 expected = a3[i].Transform(transform).Normalize();
+            Assert(
+                raylib::Vector3(x[i], y[i], z[i]).Distance(expected) < 0.0001f,
+                "batch SoA mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        // Mismatched sizes throw.
+        bool thrown = false;
+        try {
+            raylib::batch::Add(a2, b2, std::span<raylib::Vector2>(out2).first(10));
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected batch::Add() to throw on mismatched sizes");
+    }
+
+    // MatrixKernels
+    {
+        auto near = [](const ::Matrix& a, const ::Matrix& b, float epsilon) {
+            const float16 x = ::MatrixToFloatV(a);
+            const float16 y = ::MatrixToFloatV(b);
+            for (int i = 0; i < 16; i++) {
+                if (std::fabs(x.v[i] - y.v[i]) > epsilon * std::fmax(1.0f, std::fabs(y.v[i]))) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<::Matrix> left;
+        std::vector<::Matrix> right;
+        std::vector<raylib::Vector3> positions;
+        for (int i = 0; i < 100; i++) {
+            float f = static_cast<float>(i);
+            left.push_back(
+                raylib::Matrix::RotateXYZ({f * 0.1f, f * 0.2f, f * 0.3f}) *
+                raylib::Matrix::Scale(1.0f + f * 0.01f, 2.0f, 0.5f) * raylib::Matrix::Translate(f, -f, 2.0f));
+            right.push_back(raylib::Matrix::Perspective(0.5 + i * 0.01, 1.5, 0.1, 100.0) *
+                            raylib::Matrix::Translate(1.0f, f, 0.5f));
+            positions.emplace_back(f, f * 2.0f, -f);
+        }
+
+        for (size_t i = 0; i < left.size(); i++) {
+            raylib::Matrix matrix(left[i]);
+            Assert(
+                near(matrix * right[i], ::MatrixMultiply(left[i], right[i]), 1e-5f),
+                "Matrix multiply mismatch at %i",
+                static_cast<int>(i));
+            Assert(
+                near(matrix.Transpose(), ::MatrixTranspose(left[i]), 0.0f),
+                "Matrix transpose mismatch at %i",
+                static_cast<int>(i));
+            Assert(
+                near(matrix.Invert(), ::MatrixInvert(left[i]), 1e-4f),
+                "Matrix invert mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        std::vector<::Matrix> out(left.size());
+        raylib::batch::Multiply(left, right, out);
+        for (size_t i = 0; i < out.size(); i++) {
+            Assert(
+                near(out[i], ::MatrixMultiply(left[i], right[i]), 1e-5f),
+                "batch::Multiply() mismatch at %i",
+                static_cast<int>(i));
+        }
+        raylib::batch::Multiply(left, right[0], left);
+        raylib::batch::Translate(positions, right[1], out);
+        for (size_t i = 0; i < out.size(); i++) {
+            ::Matrix translate = ::MatrixTranslate(positions[i].x, positions[i].y, positions[i].z);
+            Assert(
+                near(out[i], ::MatrixMultiply(right[1], translate), 1e-5f),
+                "batch::Translate() mismatch at %i",
+                static_cast<int>(i));
+        }
+    }
+
+    // VectorExpression
+    {
+        namespace ex = raylib::expr;
+        raylib::Vector3 a(1, 2, 3);
+        raylib::Vector3 b(4, 5, 6);
+        raylib::Vector3 c(0.5f, 0.5f, 0.5f);
+        AssertEqual(ex::Evaluate(ex::Lazy(a) + ex::Lazy(b) * 2.0f - c), a + b * 2.0f - c);
+        static_assert(ex::Evaluate(-ex::Lazy(raylib::Vector2(1, 2)) * 3.0f / 2.0f) == raylib::Vector2(-1.5f, -3.0f));
+
+        std::vector<raylib::Vector3> positions;
+        std::vector<raylib::Vector3> velocities;
+        for (int i = 0; i < 1003; i++) {
+            float f = static_cast<float>(i);
+            positions.emplace_back(f * 0.5f - 100.0f, 3.0f - f, f * 0.125f);
+            velocities.emplace_back(f * 0.25f, f * -2.0f + 7.0f, 1.0f - f * 0.75f);
+        }
+
+        // Arrays and scalars only, on the SIMD path.
+        std::vector<raylib::Vector3> out(positions.size());
+        ex::Assign(out, ex::Lazy(positions) + ex::Lazy(velocities) * 0.016f - ex::Lazy(positions) / 4.0f);
+        for (size_t i = 0; i < out.size(); i++) {
+            raylib::Vector3 expected = positions[i] + velocities[i] * 0.016f - positions[i] / 4.0f;
+            Assert(out[i].Distance(expected) < 0.0001f, "expr::Assign() mismatch at %i", static_cast<int>(i));
+        }
+
+        // With a single vector operand, in place.
+        std::vector<raylib::Vector3> expected(positions.size());
+        for (size_t i = 0; i < positions.size(); i++) {
+            expected[i] = positions[i] * c + a;
+        }
+        ex::Assign(positions, ex::Lazy(positions) * c + a);
+        for (size_t i = 0; i < positions.size(); i++) {
+            Assert(
+                positions[i].Distance(expected[i]) < 0.0001f,
+                "expr::Assign() in place mismatch at %i",
+                static_cast<int>(i));
+        }
+
+        // Mismatched sizes throw.
+        bool thrown = false;
+        try {
+            ex::Assign(std::span<raylib::Vector3>(out).first(10), ex::Lazy(positions) + ex::Lazy(velocities));
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected expr::Assign() to throw on mismatched sizes");
+    }
+
     // Image
     {
         // Loading
@@ -68,6 +454,1189 @@ int main(int argc, char* argv[]) {
         AssertEqual(image.GetHeight(), 50);
     }
 
+    // PixelKernels
+    {
+        // An odd pixel count, so both the SIMD and the scalar tail paths run.
+        raylib::Image source(::GenImageGradientRadial(97, 13, 0.3f, RED, {0, 0, 255, 0}));
+        auto* colors = static_cast<::Color*>(source.data);
+        colors[5] = {0, 0, 0, 0};
+        colors[6] = {10, 20, 30, 255};
+        colors[7] = {200, 121, 10, 255};
+        colors[1000] = {200, 121, 10, 255};
+
+        // The R8G8B8A8 fast paths must give the same bytes as raylib's generic functions.
+        auto check = [&source](const char* name, auto fastOp, auto raylibOp) {
+            raylib::Image fast(source);
+            ::Image generic = source.Copy();
+            fastOp(fast);
+            raylibOp(&generic);
+            Assert(std::memcmp(fast.data, generic.data, static_cast<size_t>(fast.GetPixelDataSize())) == 0,
+                   "%s differs from raylib's result", name);
+            ::UnloadImage(generic);
+        };
+        check("ColorTint", [](raylib::Image& i) { i.ColorTint({200, 100, 50, 128}); },
+              [](::Image* i) { ::ImageColorTint(i, {200, 100, 50, 128}); });
+        check("ColorInvert", [](raylib::Image& i) { i.ColorInvert(); }, [](::Image* i) { ::ImageColorInvert(i); });
+        check("ColorReplace", [](raylib::Image& i) { i.ColorReplace({200, 121, 10, 255}, GREEN); },
+              [](::Image* i) { ::ImageColorReplace(i, {200, 121, 10, 255}, GREEN); });
+        check("ColorBrightness", [](raylib::Image& i) { i.ColorBrightness(70); },
+              [](::Image* i) { ::ImageColorBrightness(i, 70); });
+        check("ColorBrightness", [](raylib::Image& i) { i.ColorBrightness(-70); },
+              [](::Image* i) { ::ImageColorBrightness(i, -70); });
+        check("ColorBrightness", [](raylib::Image& i) { i.ColorBrightness(-300); },
+              [](::Image* i) { ::ImageColorBrightness(i, -300); });
+        check("AlphaPremultiply", [](raylib::Image& i) { i.AlphaPremultiply(); },
+              [](::Image* i) { ::ImageAlphaPremultiply(i); });
+        check("AlphaClear", [](raylib::Image& i) { i.AlphaClear(BLANK, 0.4f); },
+              [](::Image* i) { ::ImageAlphaClear(i, BLANK, 0.4f); });
+    }
+
+    // ThreadPool
+    {
+        raylib::ThreadPool pool(3);
+
+        // A diamond: two jobs after the first, and a main thread job after both.
+        std::vector<int> order;
+        std::mutex orderMutex;
+        auto log = [&](int step) {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(step);
+        };
+        raylib::JobCounter first, middle, last;
+        pool.Submit([&] { log(1); }, first);
+        pool.Submit([&] { log(2); }, first, middle);
+        pool.Submit([&] { log(2); }, first, middle);
+        pool.SubmitMainThread([&] { log(3); }, middle, last);
+        pool.Wait(last);
+        Assert(first.IsDone() && middle.IsDone() && last.IsDone());
+        AssertEqual(order.size(), 4);
+        Assert(order[0] == 1 && order[1] == 2 && order[2] == 2 && order[3] == 3, "Jobs ran out of dependency order");
+
+        // Main thread tasks only run on request.
+        bool ran = false;
+        pool.SubmitMainThread([&] { ran = pool.IsMainThread(); });
+        AssertEqual(pool.GetMainThreadTaskCount(), 1);
+        AssertEqual(pool.RunMainThreadTasks(), 1);
+        Assert(ran, "Main thread task ran on another thread");
+        AssertEqual(pool.RunMainThreadTasks(), 0);
+
+        // A non-blocking loop as a dependency, reusing a counter.
+        std::vector<int> values(1000, 0);
+        pool.ParallelFor(0, values.size(), 64, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                values[i] = static_cast<int>(i);
+            }
+        }, first);
+        long long sum = 0;
+        pool.Submit([&] {
+            for (int value : values) {
+                sum += value;
+            }
+        }, first, last);
+        pool.Wait(last);
+        AssertEqual(sum, 999 * 1000 / 2);
+
+        // Collected results come in the order of the range, after what the vector held already.
+        std::vector<int> odd{-1};
+        pool.ParallelCollect(0, 1000, 37, odd, [](std::size_t begin, std::size_t end, std::vector<int>& out) {
+            for (std::size_t i = begin | 1; i < end; i += 2) {
+                out.push_back(static_cast<int>(i));
+            }
+        });
+        AssertEqual(odd.size(), 501);
+        Assert(std::is_sorted(odd.begin(), odd.end()) && odd[1] == 1, "Expected the results in order");
+
+        // Jobs without workers run on the waiting thread.
+        raylib::ThreadPool serial(0);
+        raylib::JobCounter done;
+        int count = 0;
+        for (int i = 0; i < 10; i++) {
+            serial.Submit([&] { count++; }, done);
+        }
+        AssertEqual(done.GetCount(), 10);
+        serial.Wait(done);
+        AssertEqual(count, 10);
+
+        // Destroying a pool without workers still runs what was queued.
+        {
+            raylib::ThreadPool dropped(0);
+            dropped.Submit([&] { count++; });
+        }
+        AssertEqual(count, 11);
+    }
+
+    // ParallelImage
+    {
+        raylib::ThreadPool pool(3);
+        raylib::Image source(::GenImageGradientRadial(301, 257, 0.3f, RED, {0, 0, 255, 0}));
+        float blur3[9];
+        for (float& weight : blur3) {
+            weight = 1 / 9.0f;
+        }
+        float blur5[25];
+        for (float& weight : blur5) {
+            weight = 1 / 25.0f;
+        }
+
+        // The parallel paths must give byte-identical output to the serial ones.
+        auto check = [&source](const char* name, auto serialOp, auto parallelOp) {
+            raylib::Image serial(source);
+            raylib::Image threaded(source);
+            serialOp(serial);
+            parallelOp(threaded);
+            Assert(serial.width == threaded.width && serial.height == threaded.height &&
+                       serial.format == threaded.format &&
+                       std::memcmp(serial.data, threaded.data, static_cast<size_t>(serial.GetPixelDataSize())) == 0,
+                   "Parallel %s differs from the serial result", name);
+        };
+        check("ColorTint", [](raylib::Image& i) { i.ColorTint(SKYBLUE); },
+              [&](raylib::Image& i) { i.ColorTint(SKYBLUE, pool); });
+        check("ColorInvert", [](raylib::Image& i) { i.ColorInvert(); }, [&](raylib::Image& i) { i.ColorInvert(pool); });
+        check("ColorGrayscale", [](raylib::Image& i) { i.ColorGrayscale(); },
+              [&](raylib::Image& i) { i.ColorGrayscale(pool); });
+        check("ColorContrast", [](raylib::Image& i) { i.ColorContrast(40); },
+              [&](raylib::Image& i) { i.ColorContrast(40, pool); });
+        check("ColorBrightness", [](raylib::Image& i) { i.ColorBrightness(-30); },
+              [&](raylib::Image& i) { i.ColorBrightness(-30, pool); });
+        check("ColorReplace", [](raylib::Image& i) { i.ColorReplace(RED, GREEN); },
+              [&](raylib::Image& i) { i.ColorReplace(RED, GREEN, pool); });
+        check("AlphaClear", [](raylib::Image& i) { i.AlphaClear(BLACK, 0.5f); },
+              [&](raylib::Image& i) { i.AlphaClear(BLACK, 0.5f, pool); });
+        check("AlphaPremultiply", [](raylib::Image& i) { i.AlphaPremultiply(); },
+              [&](raylib::Image& i) { i.AlphaPremultiply(pool); });
+        check("Format", [](raylib::Image& i) { i.Format(PIXELFORMAT_UNCOMPRESSED_R5G6B5); },
+              [&](raylib::Image& i) { i.Format(PIXELFORMAT_UNCOMPRESSED_R5G6B5, pool); });
+        check("KernelConvolution", [&](raylib::Image& i) { i.KernelConvolution(blur3, 9); },
+              [&](raylib::Image& i) { i.KernelConvolution(blur3, 9, pool); });
+        check("KernelConvolution", [&](raylib::Image& i) { i.KernelConvolution(blur5, 25); },
+              [&](raylib::Image& i) { i.KernelConvolution(blur5, 25, pool); });
+        check("FlipVertical", [](raylib::Image& i) { i.FlipVertical(); },
+              [&](raylib::Image& i) { i.FlipVertical(pool); });
+        check("FlipHorizontal", [](raylib::Image& i) { i.FlipHorizontal(); },
+              [&](raylib::Image& i) { i.FlipHorizontal(pool); });
+        check("RotateCW", [](raylib::Image& i) { i.RotateCW(); }, [&](raylib::Image& i) { i.RotateCW(pool); });
+        check("RotateCCW", [](raylib::Image& i) { i.RotateCCW(); }, [&](raylib::Image& i) { i.RotateCCW(pool); });
+
+        // Whole images as tasks.
+        std::vector<raylib::Image> images;
+        for (int i = 0; i < 5; i++) {
+            images.emplace_back(source);
+        }
+        raylib::parallel::ForEach(images, [](raylib::Image& image) { image.Resize(64, 32); }, pool);
+        for (const auto& image : images) {
+            AssertEqual(image.width, 64);
+            AssertEqual(image.height, 32);
+        }
+
+        // Exceptions thrown by tasks reach the caller.
+        bool thrown = false;
+        try {
+            pool.ParallelFor(0, 100, 1, [](size_t first, size_t) {
+                if (first == 42) {
+                    throw raylib::RaylibException("Task failed");
+                }
+            });
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected ThreadPool::ParallelFor() to rethrow task exceptions");
+    }
+
+    // ImageView
+    {
+        raylib::Image source(::GenImageGradientRadial(64, 32, 0.3f, RED, {0, 0, 255, 0}));
+        const ::Rectangle region{8, 4, 16, 8};
+        raylib::Image image(source);
+        raylib::ImageView view = image.GetView(region);
+        AssertEqual(view.GetWidth(), 16);
+        AssertEqual(view.GetHeight(), 8);
+        AssertEqual(view.GetStride(), 64 * 4);
+        Assert(view.GetData() == static_cast<unsigned char*>(image.data) + (4 * 64 + 8) * 4,
+               "Expected the view to point into the image pixels");
+        Assert(!view.IsContiguous(), "Expected a sub-region view not to be contiguous");
+        AssertEqual(image.GetView(::Rectangle{60, 30, 10, 10}).GetWidth(), 4);
+        static_assert(!std::is_constructible_v<raylib::ImageView, const ::Image&>, "Views write through to the image");
+
+        // Operations on a view only touch the region, and match the same operation on a copy of it.
+        raylib::Image piece(source.FromImage(region));
+        piece.ColorInvert().ColorBrightness(-40);
+        view.ColorInvert().ColorBrightness(-40);
+        auto regionMatches = [&region](const raylib::Image& result, const raylib::Image& original,
+                                       const raylib::Image& expected) {
+            for (int y = 0; y < result.height; y++) {
+                for (int x = 0; x < result.width; x++) {
+                    const auto px = static_cast<float>(x);
+                    const auto py = static_cast<float>(y);
+                    const bool inside = px >= region.x && px < region.x + region.width && py >= region.y &&
+                                        py < region.y + region.height;
+                    const ::Color* pixel = static_cast<const ::Color*>(result.data) + y * result.width + x;
+                    const ::Color* want = inside ? static_cast<const ::Color*>(expected.data) +
+                                                       (y - static_cast<int>(region.y)) * expected.width +
+                                                       (x - static_cast<int>(region.x))
+                                                 : static_cast<const ::Color*>(original.data) + y * result.width + x;
+                    if (std::memcmp(pixel, want, sizeof(::Color)) != 0) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        Assert(regionMatches(image, source, piece), "Expected the view operation to match the cropped result");
+
+        raylib::Image copied(view.ToImage());
+        Assert(std::memcmp(copied.data, piece.data, static_cast<size_t>(piece.GetPixelDataSize())) == 0,
+               "Expected ImageView::ToImage() to copy the viewed pixels");
+
+        // Typed pixel iteration honors the stride.
+        int count = 0;
+        view.ForEachPixel<::Color>([&count](int x, int y, ::Color& pixel) {
+            count += x >= 0 && x < 16 && y >= 0 && y < 8 ? 1 : 0;
+            pixel = GREEN;
+        });
+        AssertEqual(count, 16 * 8);
+        raylib::Image green(::GenImageColor(16, 8, GREEN));
+        Assert(regionMatches(image, source, green), "Expected ForEachPixel() to visit the region only");
+
+        bool thrown = false;
+        try {
+            (void)view.GetRow<unsigned char>(0);
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected GetRow() to reject a pixel type of the wrong size");
+
+        // Raw memory in an unknown format has no pixel size to check the stride against.
+        thrown = false;
+        try {
+            raylib::ImageView unknown(source.data, 4, 4, 16, 0);
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected an ImageView of an unknown format to throw");
+
+        // Drawing into a view is clipped to the region.
+        raylib::Image canvas(source);
+        canvas.GetView(region).DrawRectangle(-5, -5, 100, 100, GREEN);
+        Assert(regionMatches(canvas, source, green), "Expected ImageView::DrawRectangle() to clip to the region");
+
+        // Drawing from a view reads the pixels in place.
+        raylib::Image fromView(source);
+        raylib::Image fromCopy(source);
+        fromView.Draw(source.GetView(region), ::Vector2{8, 4});
+        fromCopy.Draw(raylib::Image(source.FromImage(region)), {0, 0, 16, 8}, region);
+        Assert(std::memcmp(fromView.data, fromCopy.data, static_cast<size_t>(fromView.GetPixelDataSize())) == 0,
+               "Expected drawing a view to match drawing a copy of it");
+    }
+
+    // SpriteBatch
+    {
+        const ::Texture2D bunny{1, 32, 32, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        const ::Texture2D tiles{2, 64, 16, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        raylib::SpriteBatch batch(raylib::SpriteBatch::Mode::Record);
+
+        // Sprites in order share one run, and keep their vertices.
+        batch.Begin();
+        batch.Draw(bunny, ::Vector2{10, 20}, RED);
+        batch.Draw(bunny, ::Vector2{30, 40}, ::Color{10, 20, 30, 40});
+        batch.End();
+        AssertEqual(batch.GetSpriteCount(), 2);
+        AssertEqual(batch.GetBatches().size(), 1);
+        AssertEqual(batch.GetVertices().size(), 8);
+        const raylib::SpriteBatch::Vertex& corner = batch.GetVertices()[2];
+        Assert(corner.x == 42 && corner.y == 52 && corner.u == 1 && corner.v == 1, "Expected the bottom-right corner");
+        AssertEqual(batch.GetVertices()[4].color.b, 30);
+
+        // Layers first, then textures, then the order of drawing.
+        batch.Begin();
+        batch.Draw(bunny, ::Vector2{0, 0}, WHITE, 1);
+        batch.Draw(tiles, ::Rectangle{16, 0, -16, 16}, ::Vector2{0, 0}, WHITE, 0);
+        batch.Draw(bunny, ::Vector2{1, 0}, WHITE, 0);
+        batch.Draw(tiles, ::Rectangle{0, 0, 16, 16}, ::Vector2{5, 0}, WHITE, 0);
+        batch.Draw(bunny, ::Vector2{2, 0}, WHITE, -3);
+        batch.End();
+        const std::span<const raylib::SpriteBatch::Batch> batches = batch.GetBatches();
+        AssertEqual(batches.size(), 4);
+        Assert(batches[0].layer == -3 && batches[0].textureId == 1 && batches[0].count == 1, "Expected layer -3 first");
+        Assert(batches[1].layer == 0 && batches[1].textureId == 1 && batches[1].first == 1, "Expected the bunny next");
+        Assert(batches[2].layer == 0 && batches[2].textureId == 2 && batches[2].count == 2, "Expected both tiles next");
+        Assert(batches[3].layer == 1 && batches[3].first == 4, "Expected layer 1 last");
+        const std::span<const raylib::SpriteBatch::Vertex> vertices = batch.GetVertices();
+        Assert(vertices[0].x == 2 && vertices[4].x == 1 && vertices[16].x == 0, "Expected the sprites sorted");
+
+        // The flipped tile comes first, with its horizontal texture coordinates swapped.
+        Assert(vertices[8].u == 0.5f && vertices[8].x == 0 && vertices[10].u == 0.25f, "Expected a flipped tile");
+        Assert(vertices[12].x == 5 && vertices[12].u == 0 && vertices[14].u == 0.25f, "Expected the second tile");
+
+        // Rotation around the origin.
+        batch.Begin();
+        batch.Draw(bunny, ::Rectangle{0, 0, 32, 32}, ::Rectangle{100, 100, 32, 32}, ::Vector2{16, 16}, 90.0f);
+        batch.End();
+        const raylib::SpriteBatch::Vertex& rotated = batch.GetVertices()[0];
+        Assert(std::fabs(rotated.x - 116) < 0.001f && std::fabs(rotated.y - 84) < 0.001f,
+               "Expected the top-left corner rotated to the top-right");
+
+        // Negative destination sizes count as positive, and unloaded textures are skipped by every overload.
+        batch.Begin();
+        batch.Draw(bunny, ::Rectangle{0, 0, 32, 32}, ::Rectangle{10, 10, -20, -30}, ::Vector2{0, 0}, 0.0f);
+        const ::Texture2D unloaded{0, 32, 32, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        const std::vector<::Vector2> positions{{0, 0}, {1, 1}};
+        const std::vector<::Color> tints{WHITE, RED};
+        batch.Draw(unloaded, ::Vector2{0, 0});
+        batch.Draw(unloaded, positions, tints);
+        batch.Draw(unloaded, ::Rectangle{0, 0, 32, 32}, ::Vector2{0, 0});
+        batch.End();
+        AssertEqual(batch.GetSpriteCount(), 1);
+        const raylib::SpriteBatch::Vertex& opposite = batch.GetVertices()[2];
+        Assert(opposite.x == 30 && opposite.y == 40, "Expected a positive destination size");
+    }
+
+    // Particles
+    {
+        raylib::Particles particles;
+        for (int i = 0; i < 5; i++) {
+            particles.Add({static_cast<float>(i), 0}, {1, 2}, ::Color{static_cast<unsigned char>(i), 0, 0, 255});
+        }
+        particles.Remove(1);
+        AssertEqual(particles.GetCount(), 4);
+        AssertEqual(particles.GetPositions()[1].x, 4);
+        AssertEqual(particles.GetColors()[1].r, 4);
+        AssertEqual(particles.RemoveIf([&](size_t i) { return particles.GetColors()[i].r % 2 == 0; }), 3);
+        AssertEqual(particles.GetCount(), 1);
+        AssertEqual(particles.GetColors()[0].r, 3);
+
+        // Updates over whole SIMD blocks and the remainder match a scalar loop.
+        particles.Clear();
+        std::vector<::Vector2> positions, velocities;
+        for (int i = 0; i < 1003; i++) {
+            const ::Vector2 position{static_cast<float>(i % 37) * 3 - 10, static_cast<float>(i % 23) * 5 - 10};
+            const ::Vector2 velocity{static_cast<float>(i % 7) - 3, static_cast<float>(i % 5) - 2};
+            particles.Add(position, velocity);
+            positions.push_back(position);
+            velocities.push_back(velocity);
+        }
+        const ::Rectangle bounds{0, 0, 100, 100};
+        raylib::Particles threaded(particles);
+        raylib::ThreadPool pool(3);
+        for (int step = 0; step < 10; step++) {
+            particles.Update(0.5f, bounds);
+            threaded.Update(0.5f, bounds, pool, 64);
+            for (size_t i = 0; i < positions.size(); i++) {
+                positions[i].x += velocities[i].x * 0.5f;
+                positions[i].y += velocities[i].y * 0.5f;
+                if ((positions[i].x < 0 && velocities[i].x < 0) || (positions[i].x > 100 && velocities[i].x > 0)) {
+                    velocities[i].x = -velocities[i].x;
+                }
+                if ((positions[i].y < 0 && velocities[i].y < 0) || (positions[i].y > 100 && velocities[i].y > 0)) {
+                    velocities[i].y = -velocities[i].y;
+                }
+            }
+        }
+        bool matches = true;
+        for (size_t i = 0; i < positions.size(); i++) {
+            matches = matches && particles.GetPositions()[i].x == positions[i].x &&
+                      particles.GetPositions()[i].y == positions[i].y &&
+                      particles.GetVelocities()[i].x == velocities[i].x &&
+                      particles.GetVelocities()[i].y == velocities[i].y &&
+                      threaded.GetPositions()[i].x == positions[i].x && threaded.GetPositions()[i].y == positions[i].y;
+        }
+        Assert(matches, "Expected Particles::Update() to match the scalar update");
+
+        // Particles feed a sprite batch directly.
+        const ::Texture2D texture{1, 8, 8, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        raylib::SpriteBatch batch(raylib::SpriteBatch::Mode::Record);
+        batch.Begin();
+        particles.Draw(batch, texture);
+        batch.End();
+        AssertEqual(batch.GetSpriteCount(), particles.GetCount());
+        AssertEqual(batch.GetVertices()[4 * 10 + 2].x, particles.GetPositions()[10].x + 8);
+    }
+
+    // MeshBVH
+    {
+        // A bumpy indexed heightfield, so rays hit it at every angle.
+        constexpr int side = 24;
+        std::vector<float> vertices;
+        std::vector<unsigned short> indices;
+        for (int z = 0; z < side; z++) {
+            for (int x = 0; x < side; x++) {
+                vertices.push_back(static_cast<float>(x));
+                vertices.push_back(std::sin(static_cast<float>(x) * 0.7f) * std::cos(static_cast<float>(z) * 0.4f) * 3);
+                vertices.push_back(static_cast<float>(z));
+            }
+        }
+        for (int z = 0; z + 1 < side; z++) {
+            for (int x = 0; x + 1 < side; x++) {
+                const auto corner = static_cast<unsigned short>(z * side + x);
+                for (int offset : {0, side, 1, 1, side, side + 1}) {
+                    indices.push_back(static_cast<unsigned short>(corner + offset));
+                }
+            }
+        }
+        ::Mesh mesh{};
+        mesh.vertexCount = side * side;
+        mesh.triangleCount = static_cast<int>(indices.size() / 3);
+        mesh.vertices = vertices.data();
+        mesh.indices = indices.data();
+
+        const raylib::Matrix transform =
+            raylib::Matrix::Scale(1, 2, 0.5f) * raylib::Matrix::RotateXYZ({0.3f, 1.1f, -0.4f}) *
+            raylib::Matrix::Translate(5, -2, 7);
+        const raylib::MeshBVH bvh(mesh);
+        const raylib::MeshBVH moved(mesh, transform);
+        AssertEqual(bvh.GetTriangleCount(), mesh.triangleCount);
+        Assert(bvh.GetNodeCount() > 1 && bvh.GetDepth() < raylib::MeshBVH::MaxDepth, "Expected the mesh to be split");
+        AssertEqual(bvh.GetBoundingBox().max.x, static_cast<float>(side - 1));
+
+        auto similar = [](float a, float b) { return std::abs(a - b) <= 1e-4f * (1 + std::abs(b)); };
+        bool matches = true;
+        bool movedMatches = true;
+        bool anyMatches = true;
+        int hits = 0;
+        for (int i = 0; i < 500; i++) {
+            const auto f = static_cast<float>(i);
+            const raylib::Ray ray(
+                {std::sin(f * 0.37f) * 10 + 12, 15 + std::cos(f * 0.11f) * 10, std::cos(f * 0.23f) * 10 + 12},
+                {std::sin(f * 0.71f) * 0.5f, -1 + std::cos(f * 0.53f) * 0.3f, std::cos(f * 0.29f) * 0.5f});
+
+            // The same closest hit as the brute-force test of every triangle.
+            const ::RayCollision expected = ::GetRayCollisionMesh(ray, mesh, raylib::Matrix::Identity());
+            const raylib::RayCollision hit = ray.GetCollision(bvh);
+            matches = matches && hit.hit == expected.hit && similar(hit.distance, expected.distance) &&
+                      similar(hit.point.x, expected.point.x) && similar(hit.point.z, expected.point.z) &&
+                      similar(hit.normal.y, expected.normal.y);
+            hits += expected.hit ? 1 : 0;
+
+            const int triangle = bvh.GetTriangle(ray);
+            if (triangle >= 0) {
+                const auto vertex = [&](int corner) {
+                    const size_t index = indices[static_cast<size_t>(triangle * 3 + corner)];
+                    return ::Vector3{vertices[index * 3], vertices[index * 3 + 1], vertices[index * 3 + 2]};
+                };
+                matches = matches && similar(ray.GetCollision(vertex(0), vertex(1), vertex(2)).distance, hit.distance);
+            }
+            matches = matches && (triangle >= 0) == expected.hit;
+
+            // Built with the transform, or moving the ray by its inverse.
+            const ::RayCollision expectedMoved = ::GetRayCollisionMesh(ray, mesh, transform);
+            const raylib::RayCollision builtMoved = moved.GetCollision(ray);
+            const raylib::RayCollision rayMoved = ray.GetCollision(bvh, transform);
+            movedMatches = movedMatches && builtMoved.hit == expectedMoved.hit &&
+                           similar(builtMoved.distance, expectedMoved.distance) && rayMoved.hit == expectedMoved.hit &&
+                           similar(rayMoved.distance, expectedMoved.distance) &&
+                           similar(rayMoved.normal.x, expectedMoved.normal.x) &&
+                           similar(rayMoved.point.y, expectedMoved.point.y);
+
+            // Any hit within a distance is a real hit, and there is one exactly when the closest one is that near.
+            const float limit = 20;
+            const raylib::RayCollision any = bvh.GetAnyCollision(ray, limit);
+            anyMatches = anyMatches && any.hit == (expected.hit && expected.distance < limit) &&
+                         (!any.hit || any.distance >= expected.distance) &&
+                         bvh.CheckCollision(ray) == expected.hit;
+        }
+        Assert(hits > 250, "Expected most rays to hit the heightfield");
+        Assert(matches, "Expected MeshBVH hits to match GetRayCollisionMesh()");
+        Assert(movedMatches, "Expected transformed MeshBVH hits to match GetRayCollisionMesh()");
+        Assert(anyMatches, "Expected MeshBVH any-hit queries to agree with the closest hits");
+
+        // Stacked copies of one triangle can't be split apart, and the first one wins ties like in raylib.
+        std::vector<float> stacked;
+        for (int i = 0; i < 40; i++) {
+            stacked.insert(stacked.end(), {0, 0, 0, 1, 0, 0, 0, 0, 1});
+        }
+        ::Mesh unindexed{};
+        unindexed.vertexCount = 120;
+        unindexed.triangleCount = 40;
+        unindexed.vertices = stacked.data();
+        const raylib::MeshBVH stackedBvh(unindexed);
+        const raylib::Ray down({0.2f, 1, 0.2f}, {0, -1, 0});
+        AssertEqual(stackedBvh.GetTriangle(down), 0);
+        AssertEqual(stackedBvh.GetCollision(down).distance, 1.0f);
+        Assert(!stackedBvh.GetCollision(down, 0.5f).hit, "Expected no hit past the maximum distance");
+
+        const raylib::MeshBVH empty{::Mesh{}};
+        Assert(empty.IsEmpty() && !empty.GetCollision(down).hit, "Expected an empty mesh never to be hit");
+    }
+
+    // RayKernels
+    {
+        // Rays from a sphere of points around the origin, with a few starting inside the primitives.
+        std::vector<::Ray> rays;
+        std::vector<::BoundingBox> boxes;
+        std::vector<raylib::rays::Sphere> spheres;
+        std::vector<raylib::rays::Triangle> triangles;
+        for (int i = 0; i < 203; i++) {
+            const auto f = static_cast<float>(i);
+            const ::Vector3 position{std::sin(f * 0.7f) * 12, std::cos(f * 1.3f) * 12, std::sin(f * 0.31f) * 12};
+            const ::Vector3 target{std::sin(f * 0.19f) * 3, std::cos(f * 0.43f) * 3, std::cos(f * 0.97f) * 3};
+            rays.push_back({position, {target.x - position.x, target.y - position.y, target.z - position.z}});
+            boxes.push_back(
+                {{target.x - 1, target.y - 2, target.z - 1.5f}, {target.x + 2, target.y + 1, target.z + 1}});
+            spheres.push_back({{target.x + std::sin(f) * 2, target.y, target.z}, 1.5f + std::cos(f * 2.1f)});
+            triangles.push_back(
+                {{target.x - 3, target.y - 2, target.z},
+                 {target.x + 2, target.y - 1, target.z + 1},
+                 {target.x + std::sin(f) * 2, target.y + 3, target.z - 1}});
+        }
+        for (int i = 0; i < 203; i += 10) {
+            rays[static_cast<size_t>(i)].position = spheres[static_cast<size_t>(i)].center;
+        }
+        auto same = [](const ::RayCollision& a, const ::RayCollision& b) {
+            auto similar = [](float x, float y) { return std::abs(x - y) <= 1e-5f * (1 + std::abs(y)); };
+            if (!b.hit) {
+                return !a.hit;
+            }
+            return a.hit && similar(a.distance, b.distance) && similar(a.point.x, b.point.x) &&
+                   similar(a.point.y, b.point.y) && similar(a.point.z, b.point.z) &&
+                   similar(a.normal.x, b.normal.x) && similar(a.normal.y, b.normal.y) &&
+                   similar(a.normal.z, b.normal.z);
+        };
+        auto sphereCollision = [](const ::Ray& ray, const raylib::rays::Sphere& sphere) {
+            return ::GetRayCollisionSphere(ray, sphere.center, sphere.radius);
+        };
+        auto triangleCollision = [](const ::Ray& ray, const raylib::rays::Triangle& triangle) {
+            return ::GetRayCollisionTriangle(ray, triangle.p1, triangle.p2, triangle.p3);
+        };
+
+        // Each ray against the primitive at its index gives raylib's results.
+        std::vector<::RayCollision> out(rays.size());
+        bool matches = true;
+        int hits = 0;
+        raylib::rays::GetCollisions(rays, boxes, out);
+        for (size_t i = 0; i < rays.size(); i++) {
+            matches = matches && same(out[i], ::GetRayCollisionBox(rays[i], boxes[i]));
+            hits += out[i].hit ? 1 : 0;
+        }
+        raylib::rays::GetCollisions(rays, spheres, out);
+        for (size_t i = 0; i < rays.size(); i++) {
+            matches = matches && same(out[i], sphereCollision(rays[i], spheres[i]));
+            hits += out[i].hit ? 1 : 0;
+        }
+        raylib::rays::GetCollisions(rays, triangles, out);
+        for (size_t i = 0; i < rays.size(); i++) {
+            matches = matches && same(out[i], triangleCollision(rays[i], triangles[i]));
+            hits += out[i].hit ? 1 : 0;
+        }
+        Assert(matches, "Expected ray batches to match raylib's collisions");
+        Assert(hits > 300, "Expected most rays to hit their primitive");
+
+        // Rays parallel to a slab that start on one of its planes give 0 * inf = NaN, which raylib's fmin() skips.
+        std::vector<::Ray> edgeRays;
+        for (std::size_t axis = 0; axis < 3; axis++) {
+            for (float plane : {0.0f, 2.0f}) {
+                for (float direction : {-1.0f, 1.0f}) {
+                    float position[3] = {1.0f, 1.0f, 1.0f};
+                    float heading[3] = {0.0f, 0.0f, 0.0f};
+                    position[axis] = plane;
+                    position[(axis + 1) % 3] = -5.0f * direction;
+                    heading[(axis + 1) % 3] = direction;
+                    edgeRays.push_back(
+                        {{position[0], position[1], position[2]}, {heading[0], heading[1], heading[2]}});
+                }
+            }
+        }
+        const std::vector<::BoundingBox> edgeBoxes(edgeRays.size(), {{0, 0, 0}, {2, 2, 2}});
+        std::vector<::RayCollision> edgeOut(edgeRays.size());
+        raylib::rays::GetCollisions(edgeRays, edgeBoxes, edgeOut);
+        bool edgesMatch = true;
+        for (size_t i = 0; i < edgeRays.size(); i++) {
+            edgesMatch = edgesMatch && same(edgeOut[i], ::GetRayCollisionBox(edgeRays[i], edgeBoxes[i]));
+        }
+        Assert(edgesMatch, "Expected rays along a box's faces to match raylib");
+
+        // The closest hit in front of each ray, against a loop over raylib's tests.
+        std::vector<int> indices(rays.size());
+        auto closest = [&](auto& primitives, auto collision) {
+            raylib::rays::GetClosestCollisions(rays, std::span(std::as_const(primitives)), out, indices, 20.0f);
+            bool found = true;
+            for (size_t i = 0; i < rays.size(); i++) {
+                ::RayCollision expected{};
+                int expectedIndex = -1;
+                for (size_t j = 0; j < primitives.size(); j++) {
+                    const ::RayCollision hit = collision(rays[i], primitives[j]);
+                    if (hit.hit && hit.distance >= 0 && hit.distance < (expected.hit ? expected.distance : 20.0f)) {
+                        expected = hit;
+                        expectedIndex = static_cast<int>(j);
+                    }
+                }
+                found = found && same(out[i], expected) && indices[i] == expectedIndex;
+            }
+            return found;
+        };
+        Assert(closest(boxes, ::GetRayCollisionBox), "Expected the closest box to match raylib");
+        Assert(closest(spheres, sphereCollision), "Expected the closest sphere to match raylib");
+        Assert(closest(triangles, triangleCollision), "Expected the closest triangle to match raylib");
+
+        // Any hit is within the distance, and is found exactly when there is a closest one.
+        std::vector<int> any(rays.size());
+        raylib::rays::GetAnyCollisions(rays, triangles, any, 0.5f);
+        raylib::rays::GetClosestCollisions(rays, triangles, {}, indices, 0.5f);
+        bool anyMatches = true;
+        for (size_t i = 0; i < rays.size(); i++) {
+            anyMatches = anyMatches && (any[i] < 0) == (indices[i] < 0);
+            if (any[i] >= 0) {
+                const ::RayCollision hit = triangleCollision(rays[i], triangles[static_cast<size_t>(any[i])]);
+                anyMatches = anyMatches && hit.hit && hit.distance < 0.5f;
+            }
+        }
+        Assert(anyMatches, "Expected any-hit queries to agree with the closest hits");
+
+        // Chunks on a thread pool give the same results.
+        raylib::ThreadPool pool(3);
+        std::vector<::RayCollision> serial(rays.size());
+        std::vector<int> parallelIndices(rays.size());
+        raylib::rays::GetClosestCollisions(rays, spheres, serial, indices);
+        raylib::rays::GetClosestCollisions(rays, spheres, out, parallelIndices, raylib::rays::noLimit, pool, 16);
+        bool pooled = indices == parallelIndices;
+        raylib::rays::GetCollisions(rays, boxes, serial);
+        raylib::rays::GetCollisions(rays, boxes, out, pool, 16);
+        for (size_t i = 0; i < rays.size(); i++) {
+            pooled = pooled && same(out[i], serial[i]);
+        }
+        Assert(pooled, "Expected ray batches on a thread pool to match the serial ones");
+
+        bool thrown = false;
+        try {
+            raylib::rays::GetCollisions(rays, std::span(std::as_const(boxes)).first(10), out);
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected mismatched ray batch sizes to throw");
+    }
+
+    // SpatialHash
+    {
+        // Rectangles of mixed sizes around the origin, with a few spanning more than SpatialHash::MaxCells cells.
+        raylib::SpatialHash hash(10.0f);
+        BroadphaseCheck<raylib::SpatialHash, ::Rectangle> check{hash, "spatial hash", ::CheckCollisionRecs};
+        auto place = [](int i, float time) {
+            const auto f = static_cast<float>(i);
+            const float size = i % 50 == 0 ? 120.0f : 4.0f + 12.0f * std::abs(std::sin(f * 0.77f));
+            return ::Rectangle{
+                std::sin(f * 0.37f + time) * 150 - size / 2,
+                std::cos(f * 0.91f + time * 0.5f) * 150 - size / 2,
+                size,
+                size * (0.5f + std::abs(std::cos(f)))};
+        };
+        for (int i = 0; i < 300; i++) {
+            check.Add(place(i, 0.0f));
+        }
+        // Two rectangles that only touch, and a copy of the first one, which does overlap it.
+        check.Add({400, 400, 10, 10});
+        check.Add({410, 400, 10, 10});
+        check.Add({400, 400, 10, 10});
+
+        auto queriesMatch = [&] {
+            bool match = true;
+            for (int i = 0; i < 40; i++) {
+                const auto f = static_cast<float>(i);
+                const ::Rectangle region{std::sin(f) * 160, std::cos(f * 1.7f) * 160, 5.0f + f * 2, 30.0f - f / 2};
+                const ::Vector2 point{std::cos(f * 2.3f) * 150, std::sin(f * 0.6f) * 150};
+                const float radius = 2.0f + f;
+                match = match && check.Matches(hash.Query(region), [&](const ::Rectangle& rect) {
+                    return ::CheckCollisionRecs(rect, region);
+                });
+                match = match && check.Matches(hash.Query(point), [&](const ::Rectangle& rect) {
+                    return ::CheckCollisionPointRec(point, rect);
+                });
+                match = match && check.Matches(hash.Query(point, radius), [&](const ::Rectangle& rect) {
+                    return ::CheckCollisionCircleRec(point, radius, rect);
+                });
+            }
+            // A region covering more cells than there are buckets scans every proxy instead.
+            const ::Rectangle world{-1e5f, -1e5f, 2e5f, 2e5f};
+            return match && check.Matches(hash.Query(world), [&](const ::Rectangle& rect) {
+                return ::CheckCollisionRecs(rect, world);
+            });
+        };
+
+        Assert(check.ExpectedPairs().size() > 100, "Expected the spatial hash test rectangles to overlap");
+        Assert(check.PairsMatch(), "Expected spatial hash pairs to match brute force");
+        Assert(queriesMatch(), "Expected spatial hash queries to match brute force");
+        AssertEqual(hash.GetCount(), check.bounds.size());
+
+        check.Churn(300, place, [&hash](raylib::SpatialHash::Handle handle, const ::Rectangle& rect) {
+            hash.Move(handle, rect);
+        });
+        Assert(queriesMatch(), "Expected spatial hash queries to match brute force after moving");
+        AssertEqual(hash.Get(check.handles[1]), check.bounds[1]);
+        check.Clear();
+    }
+
+    // AABBTree
+    {
+        // Boxes of mixed sizes around the origin, moving a little or a lot between updates.
+        raylib::AABBTree tree(0.5f);
+        BroadphaseCheck<raylib::AABBTree, ::BoundingBox> check{tree, "AABB tree", ::CheckCollisionBoxes};
+        auto place = [](int i, float time) {
+            const auto f = static_cast<float>(i);
+            const ::Vector3 center{
+                std::sin(f * 0.37f + time) * 40,
+                std::cos(f * 0.91f + time * 0.5f) * 20,
+                std::sin(f * 0.53f - time) * 40};
+            const ::Vector3 half{
+                1.0f + 3.0f * std::abs(std::sin(f * 0.77f)),
+                1.0f + 2.0f * std::abs(std::cos(f)),
+                i % 40 == 0 ? 20.0f : 1.0f + std::abs(std::sin(f * 1.3f))};
+            return ::BoundingBox{
+                {center.x - half.x, center.y - half.y, center.z - half.z},
+                {center.x + half.x, center.y + half.y, center.z + half.z}};
+        };
+        for (int i = 0; i < 400; i++) {
+            check.Add(place(i, 0.0f));
+        }
+
+        const ::Matrix view = ::MatrixLookAt({0, 10, 60}, {10, 0, 0}, {0, 1, 0});
+        const raylib::Frustum frustum(::MatrixMultiply(view, ::MatrixPerspective(45 * DEG2RAD, 1.5, 0.1, 80)));
+        size_t rayHits = 0;
+        auto queriesMatch = [&] {
+            bool match = true;
+            for (int i = 0; i < 40; i++) {
+                const auto f = static_cast<float>(i);
+                const ::Vector3 center{std::cos(f * 2.3f) * 40, std::sin(f * 0.6f) * 20, std::sin(f * 1.1f) * 40};
+                const ::BoundingBox region{center, {center.x + f, center.y + 3, center.z + 10 - f / 4}};
+                const float radius = 1.0f + f / 2;
+                match = match && check.Matches(tree.Query(region), [&](const ::BoundingBox& box) {
+                    return ::CheckCollisionBoxes(box, region);
+                });
+                match = match && check.Matches(tree.Query(center, radius), [&](const ::BoundingBox& box) {
+                    return ::CheckCollisionBoxSphere(box, center, radius);
+                });
+
+                // Rays from outside and from inside the boxes, where the closest hit is the nearest of them all.
+                const ::Ray ray{
+                    i % 4 == 0 ? check.bounds[static_cast<size_t>(i) * 3].min : ::Vector3{center.x, 30, center.z},
+                    {std::sin(f), -1.0f + std::cos(f * 0.3f) * 0.5f, std::cos(f * 1.7f)}};
+                const float maxDistance = i % 2 == 0 ? 60.0f : std::numeric_limits<float>::infinity();
+                auto reaches = [&](const ::BoundingBox& box) {
+                    const ::RayCollision hit = ::GetRayCollisionBox(ray, box);
+                    return hit.hit && hit.distance >= 0 && hit.distance <= maxDistance;
+                };
+                std::vector<raylib::AABBTree::Handle> found;
+                tree.Query(ray, maxDistance, [&found](raylib::AABBTree::Handle handle, const ::RayCollision&) {
+                    found.push_back(handle);
+                });
+                match = match && check.Matches(found, reaches);
+
+                float expected = std::numeric_limits<float>::infinity();
+                for (size_t j = 0; j < check.bounds.size(); j++) {
+                    if (check.alive[j] && reaches(check.bounds[j])) {
+                        expected = std::min(expected, ::GetRayCollisionBox(ray, check.bounds[j]).distance);
+                        rayHits++;
+                    }
+                }
+                const raylib::AABBTree::RayHit closest = tree.GetCollision(ray, maxDistance);
+                const bool missed = closest.handle == raylib::AABBTree::Invalid;
+                match = match && (missed ? std::isinf(expected) : closest.collision.distance == expected);
+            }
+            return match && check.Matches(tree.Query(frustum), [&](const ::BoundingBox& box) {
+                return frustum.CheckCollision(box);
+            });
+        };
+
+        Assert(check.ExpectedPairs().size() > 100, "Expected the AABB tree test boxes to overlap");
+        Assert(check.PairsMatch(), "Expected AABB tree pairs to match brute force");
+        Assert(queriesMatch(), "Expected AABB tree queries to match brute force");
+        Assert(rayHits > 20, "Expected the AABB tree test rays to hit");
+
+        // Small moves keep the fat boxes.
+        int reinserted = 0;
+        check.Churn(400, place, [&](raylib::AABBTree::Handle handle, const ::BoundingBox& box) {
+            reinserted += tree.Move(handle, box) ? 1 : 0;
+        });
+        Assert(reinserted > 0 && reinserted < 1200, "Expected small moves to keep their fat boxes");
+        Assert(queriesMatch(), "Expected AABB tree queries to match brute force after moving");
+        Assert(tree.GetHeight() < 20, "Expected the AABB tree to stay balanced");
+
+        // Rebuilding keeps the handles, and gives the same answers.
+        tree.Rebuild();
+        Assert(check.PairsMatch(), "Expected AABB tree pairs to match brute force after rebuilding");
+        Assert(queriesMatch(), "Expected AABB tree queries to match brute force after rebuilding");
+        AssertEqual(tree.Get(check.handles[1]).min.x, check.bounds[1].min.x);
+
+        // Boxes added in order along a line, the worst case for a tree without rotations.
+        check.Clear();
+        for (int i = 0; i < 1000; i++) {
+            const auto x = static_cast<float>(i) * 3;
+            tree.Add({{x, 0, 0}, {x + 1, 1, 1}});
+        }
+        Assert(tree.GetHeight() < 25, "Expected the AABB tree to stay balanced");
+
+        // The frustum sees what the camera looks at, and not what is behind it or past the far plane.
+        Assert(frustum.CheckCollision(::Vector3{10, 0, 0}), "Expected the frustum to contain the camera target");
+        Assert(!frustum.CheckCollision(::Vector3{0, 10, 70}), "Expected the frustum to miss points behind it");
+        Assert(!frustum.CheckCollision(::Vector3{-20, -30, -40}, 2.0f), "Expected the frustum to miss far spheres");
+        Assert(frustum.Contains({{9, -1, -1}, {11, 1, 1}}), "Expected the frustum to contain a box at the target");
+    }
+
+    // CullingKernels
+    {
+        // Boxes and spheres scattered around the camera, some behind it, past the far plane or across the planes.
+        std::vector<::BoundingBox> boxes;
+        std::vector<raylib::culling::Sphere> spheres;
+        for (int i = 0; i < 1003; i++) {
+            const auto f = static_cast<float>(i);
+            const ::Vector3 center{std::sin(f * 0.7f) * 90, std::cos(f * 1.3f) * 40, std::sin(f * 0.31f) * 90};
+            const float size = 1 + std::abs(std::cos(f * 2.1f)) * 6;
+            boxes.push_back(
+                {{center.x - size, center.y - size * 0.5f, center.z - size},
+                 {center.x + size, center.y + size * 0.5f, center.z + size}});
+            spheres.push_back({center, size});
+        }
+
+        // The camera's frustum comes from the same matrices BeginMode() uses.
+        const raylib::Camera3D camera({0, 10, 60}, {10, 0, 0}, {0, 1, 0}, 45);
+        const raylib::Frustum frustum = camera.GetFrustum(1.5, 0.1, 80);
+        const raylib::Frustum expected(
+            ::MatrixMultiply(::MatrixLookAt({0, 10, 60}, {10, 0, 0}, {0, 1, 0}),
+                             ::MatrixPerspective(45 * DEG2RAD, 1.5, 0.1, 80)));
+        bool samePlanes = true;
+        for (size_t i = 0; i < 6; i++) {
+            const ::Vector4 a = frustum.GetPlanes()[i];
+            const ::Vector4 b = expected.GetPlanes()[i];
+            samePlanes = samePlanes && a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+        }
+        Assert(samePlanes, "Expected the camera's frustum to use its view and projection matrices");
+
+        // Each batch gives the indices a loop over the scalar tests would.
+        auto expectedVisible = [](const raylib::Frustum& f, const auto& bounds, auto test) {
+            std::vector<int> indices;
+            for (size_t i = 0; i < bounds.size(); i++) {
+                if (test(f, bounds[i])) {
+                    indices.push_back(static_cast<int>(i));
+                }
+            }
+            return indices;
+        };
+        auto boxTest = [](const raylib::Frustum& f, const ::BoundingBox& box) { return f.CheckCollision(box); };
+        auto sphereTest = [](const raylib::Frustum& f, const raylib::culling::Sphere& sphere) {
+            return f.CheckCollision(sphere.center, sphere.radius);
+        };
+        raylib::ThreadPool pool(3);
+        std::vector<int> visible{7};
+        std::vector<int> parallel;
+        raylib::culling::GetVisible(frustum, boxes, visible);
+        AssertEqual(visible, expectedVisible(frustum, boxes, boxTest));
+        Assert(visible.size() > 20 && visible.size() < 900, "Expected the frustum to cull some of the boxes");
+        raylib::culling::GetVisible(frustum, boxes, parallel, pool, 64);
+        AssertEqual(parallel, visible);
+        raylib::culling::GetVisible(frustum, spheres, visible);
+        AssertEqual(visible, expectedVisible(frustum, spheres, sphereTest));
+        Assert(visible.size() > 20 && visible.size() < 900, "Expected the frustum to cull some of the spheres");
+        raylib::culling::GetVisible(frustum, spheres, parallel, pool, 64);
+        AssertEqual(parallel, visible);
+
+        // An orthographic camera sees a box around its axis, fovy units tall.
+        const raylib::Camera3D ortho({0, 0, 50}, {0, 0, 0}, {0, 1, 0}, 20, CAMERA_ORTHOGRAPHIC);
+        const raylib::Frustum sides = ortho.GetFrustum(2.0);
+        Assert(sides.CheckCollision(::Vector3{19, 9, 0}), "Expected an orthographic frustum to reach its sides");
+        Assert(!sides.CheckCollision(::Vector3{21, 0, 0}), "Expected an orthographic frustum to end at its sides");
+        Assert(!sides.CheckCollision(::Vector3{0, 11, 0}), "Expected an orthographic frustum to end at its top");
+        raylib::culling::GetVisible(sides, boxes, visible);
+        AssertEqual(visible, expectedVisible(sides, boxes, boxTest));
+        raylib::culling::GetVisible(sides, spheres, visible, pool, 64);
+        AssertEqual(visible, expectedVisible(sides, spheres, sphereTest));
+
+        // Fewer bounds than a register, and none at all.
+        raylib::culling::GetVisible(frustum, std::span(boxes).first(3), visible);
+        AssertEqual(visible, expectedVisible(frustum, std::span(boxes).first(3), boxTest));
+        raylib::culling::GetVisible(frustum, std::span<const ::BoundingBox>(), visible, pool);
+        Assert(visible.empty(), "Expected no visible indices without bounds");
+    }
+
+    // TextLayout
+    {
+        // A font with made up glyphs: 'A', 'B', '?', ' ', U+00E9, U+1F600 and a second 'A'.
+        const int values[] = {'A', 'B', '?', ' ', 0xE9, 0x1F600, 'A'};
+        const int advances[] = {9, 0, 7, 4, 9, 12, 3};
+        ::GlyphInfo glyphs[7]{};
+        ::Rectangle recs[7]{};
+        for (int i = 0; i < 7; i++) {
+            glyphs[i].value = values[i];
+            glyphs[i].advanceX = advances[i];
+            glyphs[i].offsetY = i % 2;
+            recs[i] = {static_cast<float>(i * 10), 0, 8, 10};
+        }
+        const ::Font font{10, 7, 1, {1, 70, 10, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA}, recs, glyphs};
+
+        // The same glyphs as the linear search, including the first duplicate and the '?' fallback.
+        const raylib::GlyphLookup lookup(font);
+        const int codepoints[] = {0, 'A', 'B', 'C', '?', ' ', 0xE9, 0xFF, 0x1F600, 0x1F601, -5};
+        for (int codepoint : codepoints) {
+            AssertEqual(lookup.GetIndex(codepoint), ::GetGlyphIndex(font, codepoint));
+        }
+        AssertEqual(lookup.GetIndex('A'), 0);
+        AssertEqual(lookup.GetIndex('C'), 2);
+
+        // Measured like MeasureTextEx(), with the glyphs placed like DrawTextEx().
+        for (const char* text : {"AB", "A B\nB", "\xC3\xA9\xF0\x9F\x98\x80?", "AAA\n\nB\n", "C"}) {
+            const raylib::TextLayout layout = raylib::TextLayout::Build(font, lookup, text, 20, 1.5f);
+            const ::Vector2 expected = ::MeasureTextEx(font, text, 20, 1.5f);
+            Assert(layout.size.x == expected.x && layout.size.y == expected.y, "Expected the size of \"%s\"", text);
+        }
+        const raylib::TextLayout layout = raylib::TextLayout::Build(font, lookup, "A B\nB", 20, 1);
+        AssertEqual(layout.glyphs.size(), 3);
+        const ::Rectangle& second = layout.glyphs[1].dest;
+        Assert(second.x == 19 + 9 - 2 && second.y == 2 - 2, "Expected B after the advances of A and the space");
+        const ::Rectangle& b = layout.glyphs[2].dest;
+        Assert(b.x == -2 && b.y == 22 + 2 - 2 && b.width == 20 && b.height == 24, "Expected B on the second line");
+        const ::Rectangle& source = layout.glyphs[2].source;
+        Assert(source.x == 9 && source.y == -1 && source.width == 10, "Expected the padded glyph in the atlas");
+
+        // Layouts are cached, and the least recently used one is evicted past the budget.
+        raylib::TextLayoutCache cache;
+        const raylib::TextLayout* first = &cache.Get(font, "AB", 20, 1);
+        Assert(first == &cache.Get(font, "AB", 20, 1), "Expected the cached layout");
+        cache.Get(font, "AB", 30, 1);
+        cache.Get(font, "BA", 20, 1);
+        AssertEqual(cache.GetCount(), 3);
+        AssertEqual(cache.GetHits(), 1);
+        AssertEqual(cache.GetMisses(), 3);
+        cache.Get(font, "AB", 20, 1);
+        cache.SetBudget(cache.GetMemoryUsage() - 1);
+        AssertEqual(cache.GetCount(), 2);
+        cache.Get(font, "AB", 30, 1);
+        AssertEqual(cache.GetMisses(), 4);
+        Assert(cache.GetMemoryUsage() <= cache.GetBudget(), "Expected the cache within its budget");
+
+        const raylib::Text text(font, "A B", 20, 1);
+        const ::Vector2 size = text.MeasureEx(cache);
+        Assert(size.x == text.MeasureEx().x && size.y == 20, "Expected the size of the text");
+        cache.Forget(font);
+        AssertEqual(cache.GetCount(), 0);
+
+        // Glyphs go into a sprite batch with the font texture.
+        raylib::SpriteBatch batch(raylib::SpriteBatch::Mode::Record);
+        batch.Begin();
+        layout.Draw(batch, {100, 50}, RED);
+        batch.End();
+        AssertEqual(batch.GetSpriteCount(), 3);
+        AssertEqual(batch.GetBatches()[0].textureId, 1);
+        AssertEqual(batch.GetVertices()[8].x, 98);
+    }
+
+    // SkylinePacker
+    {
+        raylib::SkylinePacker packer(64, 64);
+        std::vector<::Rectangle> packed;
+        ::Rectangle rec;
+        for (int i = 0; packer.Pack(5 + i % 7, 6 + i % 5, rec); i++) {
+            Assert(rec.x >= 0 && rec.y >= 0 && rec.x + rec.width <= 64 && rec.y + rec.height <= 64, "Expected inside");
+            for (const ::Rectangle& other : packed) {
+                Assert(!CheckCollisionRecs(rec, other), "Expected packed rectangles not to overlap");
+            }
+            packed.push_back(rec);
+        }
+        Assert(packed.size() > 40 && packer.GetOccupancy() > 0.7f, "Expected the area to be mostly used");
+        Assert(!packer.Pack(65, 1, rec), "Expected no room for a rectangle wider than the area");
+        packer.Reset();
+        Assert(packer.Pack(64, 64, rec) && rec.x == 0 && rec.y == 0, "Expected the whole area after a reset");
+    }
+
+    // DynamicFont
+    {
+        // Glyphs are boxes as wide as their codepoint's last digit, filled with the codepoint's low byte.
+        int rasterized = 0;
+        raylib::DynamicFont font(
+            [&rasterized](int codepoint, raylib::DynamicFont::Bitmap& bitmap) {
+                if (codepoint == 'x') {
+                    return false;
+                }
+                rasterized++;
+                bitmap.width = 4 + codepoint % 10;
+                bitmap.height = 12;
+                bitmap.offsetY = 2;
+                bitmap.advanceX = bitmap.width + 1;
+                bitmap.alpha.assign(static_cast<size_t>(bitmap.width * bitmap.height),
+                                    static_cast<unsigned char>(codepoint));
+                return true;
+            },
+            12,
+            32,
+            2);
+
+        // Rasterized and packed the first time, with the pixels in the page.
+        const raylib::DynamicFont::Glyph* a = font.GetGlyph('A');
+        Assert(a != nullptr && a->page == 0 && a->rec.width == 9 && a->advanceX == 10, "Expected the glyph for A");
+        const std::span<const unsigned char> pixels = font.GetPagePixels(0);
+        const size_t corner = (static_cast<size_t>(a->rec.y) * 32 + static_cast<size_t>(a->rec.x)) * 2;
+        Assert(pixels[corner] == 255 && pixels[corner + 1] == 'A' && pixels[1] == 0, "Expected A in the page");
+        AssertEqual(font.GetGlyph('A'), a);
+        AssertEqual(rasterized, 1);
+
+        // Missing codepoints get '?', and are only tried once.
+        AssertEqual(font.GetGlyph('x'), font.GetGlyph('?'));
+        font.GetGlyph('x');
+        AssertEqual(rasterized, 2);
+
+        // Measured like MeasureTextEx().
+        const ::Vector2 size = font.MeasureText("AB\nA", 24, 1);
+        Assert(size.x == (10 + 11) * 2 + 1 && size.y == 24 + 26, "Expected the size of the text");
+
+        // When both pages are full, the least recently used one is cleared for new glyphs of the same size.
+        font.NextFrame();
+        for (int codepoint = 0x4E00; a->page >= 0; codepoint += 10) {
+            font.GetGlyph(codepoint);
+            font.NextFrame();
+        }
+        AssertEqual(font.GetPageCount(), 2);
+        const int before = rasterized;
+        Assert(font.GetGlyph('A')->page >= 0 && rasterized == before + 1, "Expected A rasterized again");
+
+        // Pages that haven't been used for a while are freed.
+        for (int i = 0; i < 10; i++) {
+            font.NextFrame();
+        }
+        font.GetGlyph('A');
+        AssertEqual(font.EvictCold(5), 1);
+        Assert(font.GetPagePixels(0).empty() != font.GetPagePixels(1).empty(), "Expected one page freed");
+    }
+
+    // Allocator
+    {
+        AssertEqual(raylib::PoolAllocator::GetBlockSize(1), 256);
+        AssertEqual(raylib::PoolAllocator::GetBlockSize(257), 320);
+        AssertEqual(raylib::PoolAllocator::GetBlockSize(1000), 1024);
+        AssertEqual(raylib::PoolAllocator::GetBlockSize(1025), 1280);
+
+        raylib::PoolAllocator pool;
+        raylib::SetBufferAllocator(&pool);
+        {
+            raylib::Image image(64, 32, RED);
+            raylib::Image copy(image);
+            AssertEqual(pool.GetStats().allocationCount, 2);
+            AssertEqual(pool.GetStats().bytesInUse, 2 * 64 * 32 * 4);
+            Assert(std::memcmp(image.data, copy.data, static_cast<size_t>(image.GetPixelDataSize())) == 0,
+                   "Expected the pooled copy to match the image");
+        }
+        raylib::AllocatorStats stats = pool.GetStats();
+        AssertEqual(stats.bytesInUse, 0);
+        AssertEqual(stats.highWaterMark, 2 * 64 * 32 * 4);
+        AssertEqual(stats.bytesCached, 2 * 64 * 32 * 4);
+
+        // Released blocks are reused.
+        {
+            raylib::Image image(64, 32, BLUE);
+            AssertEqual(pool.GetStats().reusedAllocations, 1);
+
+            // Buffers replaced by raylib are dropped from the pool.
+            image.Format(PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+            AssertEqual(pool.GetStats().allocationCount, 0);
+        }
+
+        {
+            raylib::Mesh mesh(4, 2, true);
+            Assert(mesh.vertices != nullptr && mesh.indices != nullptr, "Expected mesh arrays to be allocated");
+            AssertEqual(pool.GetStats().allocationCount, 4);
+        }
+        AssertEqual(pool.GetStats().allocationCount, 0);
+
+        // A mesh that can't get all of its arrays gives back the ones it got.
+        {
+            struct FailingAllocator : raylib::Allocator {
+                raylib::PoolAllocator& pool;
+                int remaining;
+                FailingAllocator(raylib::PoolAllocator& pool, int remaining) : pool(pool), remaining(remaining) {}
+                void* Allocate(std::size_t size) override { return remaining-- > 0 ? pool.Allocate(size) : nullptr; }
+                bool Release(void* data) override { return pool.Release(data); }
+                void Forget(void* data) override { pool.Forget(data); }
+                [[nodiscard]] raylib::AllocatorStats GetStats() const override { return pool.GetStats(); }
+            } failing(pool, 2);
+            raylib::SetBufferAllocator(&failing);
+            bool thrown = false;
+            try {
+                raylib::Mesh mesh(4, 2, true);
+            } catch (raylib::RaylibException&) {
+                thrown = true;
+            }
+            raylib::SetBufferAllocator(&pool);
+            Assert(thrown, "Expected a failed mesh allocation to throw");
+            AssertEqual(pool.GetStats().allocationCount, 0);
+        }
+
+        // Raw structs handed to the caller get freed by raylib, so they never come from the pool.
+        {
+            raylib::Image image(8, 8, RED);
+            ::Image copy = image.Copy();
+            ::Image color = raylib::Image::Color(8, 8, BLUE);
+            ::Image view = image.GetView().ToImage();
+            raylib::MeshUnmanaged mesh(4, 2, true);
+            AssertEqual(pool.GetStats().allocationCount, 1);
+            ::UnloadImage(copy);
+            ::UnloadImage(color);
+            ::UnloadImage(view);
+            ::MemFree(mesh.vertices);
+            ::MemFree(mesh.texcoords);
+            ::MemFree(mesh.normals);
+            ::MemFree(mesh.indices);
+        }
+
+        raylib::SetBufferAllocator(nullptr);
+        pool.Trim();
+        AssertEqual(pool.GetStats().bytesCached, 0);
+    }
+
+    // AssetLoader
+    {
+        raylib::ThreadPool pool(2);
+        raylib::AssetLoader loader(pool);
+
+        std::future<int> value = loader.Load([] { return 42; });
+        AssertEqual(value.get(), 42);
+
+        std::future<int> failed = loader.Load([]() -> int { throw raylib::RaylibException("Decode failed"); });
+        bool thrown = false;
+        try {
+            failed.get();
+        } catch (raylib::RaylibException&) {
+            thrown = true;
+        }
+        Assert(thrown, "Expected the future to rethrow the decode exception");
+
+        // Uploads run on the thread calling Update(), with the decoded value.
+        std::thread::id uploadThread;
+        std::future<size_t> uploaded = loader.Load(
+            [] { return std::vector<int>{1, 2, 3}; },
+            [&uploadThread](std::vector<int> decoded) {
+                uploadThread = std::this_thread::get_id();
+                return decoded.size();
+            });
+        while (uploaded.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            loader.Update();
+            std::this_thread::yield();
+        }
+        AssertEqual(uploaded.get(), 3);
+        Assert(uploadThread == std::this_thread::get_id(), "Expected the upload to run on the main thread");
+    }
+
+    // AssetLoader priorities and budget
+    {
+        // Without workers, Update() runs the decode steps, highest priority first.
+        raylib::ThreadPool pool(0);
+        raylib::AssetLoader loader(pool);
+        std::vector<int> order;
+        for (int priority : {0, 5, 1, 5}) {
+            (void)loader.Load([&order, priority] { order.push_back(priority); }, priority);
+        }
+        AssertEqual(loader.GetDecodeCount(), 4);
+        while (loader.GetDecodeCount() > 0) {
+            loader.Update(1.0f);
+        }
+        Assert(order == std::vector<int>({5, 5, 1, 0}), "Expected decodes to run in priority order");
+
+        // A spent budget still runs one upload per Update().
+        std::vector<std::future<void>> uploads;
+        for (int i = 0; i < 3; i++) {
+            uploads.push_back(loader.Load(
+                [] { return 0; },
+                [](int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }));
+        }
+        loader.Wait();
+        AssertEqual(loader.GetUploadCount(), 3);
+        AssertEqual(loader.Update(0.001f), 1);
+        AssertEqual(loader.GetUploadCount(), 2);
+        AssertEqual(loader.Update(1.0f), 2);
+    }
+
     // Keyboard
     { AssertNot(raylib::Keyboard::IsKeyPressed(KEY_MINUS)); }
 
@@ -105,6 +1674,342 @@ int main(int argc, char* argv[]) {
         AssertEqual(output[1], "How");
     }
 
+    // AudioRingBuffer
+    {
+        // Rounded up to a power of two, with overruns dropping what doesn't fit.
+        raylib::AudioRingBuffer ring(6, 16, 2, 100);
+        AssertEqual(ring.GetCapacity(), 8);
+        AssertEqual(ring.GetFrameSize(), 4);
+        short frames[24];
+        for (short i = 0; i < 24; i++) {
+            frames[i] = i;
+        }
+        AssertEqual(ring.Write(frames, 5), 5);
+        AssertEqual(ring.Write(frames + 10, 7), 3);
+        Assert(ring.GetReadable() == 8 && ring.GetLatency() == 0.08f, "Expected a full ring");
+
+        // Underruns are filled with silence, and reads wrap around the end.
+        short out[24];
+        AssertEqual(ring.Read(out, 6), 6);
+        AssertEqual(ring.Write(frames, 4), 4);
+        AssertEqual(ring.Read(out, 12), 6);
+        Assert(out[0] == 12 && out[3] == 15 && out[4] == 0 && out[11] == 7, "Expected the frames in order");
+        Assert(out[12] == 0 && out[23] == 0, "Expected silence after the buffered frames");
+        raylib::AudioRingBuffer::Stats stats = ring.GetStats();
+        Assert(stats.written == 12 && stats.read == 12 && stats.overruns == 1 && stats.overrunFrames == 4,
+               "Expected the producer counters");
+        Assert(stats.underruns == 1 && stats.underrunFrames == 6 && stats.minBuffered == 6 && stats.maxBuffered == 8,
+               "Expected the consumer counters");
+
+        raylib::AudioRingBuffer bytes(4, 8, 1);
+        unsigned char silence[4] = {1, 2, 3, 4};
+        bytes.Read(silence, 4);
+        Assert(silence[0] == 128 && silence[3] == 128, "Expected unsigned 8 bit silence");
+
+        // A fake audio thread reads periods of 64 frames while this thread writes a counter in uneven chunks.
+        raylib::AudioRingBuffer stream(256, 16, 2, 48000);
+        std::atomic<bool> producing{true};
+        std::atomic<bool> ordered{true};
+        std::thread consumer([&] {
+            short period[128];
+            short expected = 0;
+            while (producing.load() || stream.GetReadable() > 0) {
+                const unsigned int count = stream.Read(period, 64);
+                for (unsigned int i = 0; i < count; i++) {
+                    if (period[i * 2] != expected || period[i * 2 + 1] != static_cast<short>(-expected)) {
+                        ordered.store(false);
+                    }
+                    expected = static_cast<short>(expected + 1);
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        });
+        short chunk[2 * 37];
+        short next = 0;
+        for (int i = 0; i < 2000; i++) {
+            const unsigned int count = 1 + static_cast<unsigned int>(i % 37);
+            for (unsigned int frame = 0; frame < count; frame++) {
+                chunk[frame * 2] = static_cast<short>(next + static_cast<short>(frame));
+                chunk[frame * 2 + 1] = static_cast<short>(-chunk[frame * 2]);
+            }
+            // Only advance past what fit, so the consumer sees an unbroken counter.
+            next = static_cast<short>(next + static_cast<short>(stream.Write(chunk, count)));
+            std::this_thread::yield();
+        }
+        producing.store(false);
+        consumer.join();
+        Assert(ordered.load(), "Expected the frames in the order they were written");
+        stats = stream.GetStats();
+        Assert(stats.read == stats.written && stats.maxBuffered <= 256, "Expected every written frame read");
+
+        // Streams with callables each take a callback slot, and give it back when unloaded.
+        {
+            std::vector<raylib::AudioStream> streams(RAYLIB_CPP_AUDIO_CALLBACK_SLOTS);
+            for (raylib::AudioStream& audio : streams) {
+                audio.SetCallback([&ring](void* data, unsigned int frameCount) { ring.Read(data, frameCount); });
+            }
+            raylib::AudioStream extra;
+            int calls = 0;
+            bool threw = false;
+            try {
+                extra.SetCallback([&calls](void*, unsigned int) { calls++; });
+            } catch (raylib::RaylibException&) {
+                threw = true;
+            }
+            Assert(threw, "Expected no free callback slot");
+            // Callables without state go to raylib as they are, without a slot.
+            extra.SetCallback([](void*, unsigned int) {});
+            streams.back().ClearCallback();
+            extra.SetCallback([&calls](void*, unsigned int) { calls++; });
+        }
+        int calls = 0;
+        raylib::AudioStream audio;
+        audio.SetCallback([&calls](void*, unsigned int) { calls++; });
+    }
+
+    // MusicStreamer
+    {
+        // A wave decoder copies the wave's frames, and stops at its end.
+        auto wave = std::make_shared<const raylib::Wave>(path + "/resources/audio/coin.wav");
+        raylib::MusicStreamer::Decoder decoder = raylib::MusicStreamer::WaveDecoder(wave);
+        const std::size_t frameSize = wave->sampleSize / 8 * wave->channels;
+        std::vector<unsigned char> frames(256 * frameSize);
+        AssertEqual(decoder(frames.data(), 256, 100), 256u);
+        const auto* samples = static_cast<const unsigned char*>(wave->data);
+        Assert(
+            std::memcmp(frames.data(), samples + 100 * frameSize, frames.size()) == 0,
+            "Expected the wave's frames");
+        AssertEqual(decoder(frames.data(), 256, wave->frameCount - 10), 10u);
+        AssertEqual(decoder(frames.data(), 256, wave->frameCount), 0u);
+
+        // Streams need an audio device, which is miniaudio's null device on machines without sound.
+        InitAudioDevice();
+        if (IsAudioDeviceReady()) {
+            auto waitFor = [](auto condition) {
+                const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                while (!condition() && std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                }
+                return condition();
+            };
+
+            // A counter, which the worker decodes no further than the prefetch depth ahead.
+            std::atomic<int> calls{0};
+            std::atomic<unsigned int> lastPosition{0};
+            auto counter = [&calls, &lastPosition](void* out, unsigned int frameCount, unsigned int position) {
+                calls++;
+                lastPosition.store(position);
+                auto* samples = static_cast<short*>(out);
+                for (unsigned int i = 0; i < frameCount; i++) {
+                    samples[i] = static_cast<short>(position + i);
+                }
+                return frameCount;
+            };
+            {
+                raylib::MusicStreamer music(counter, 22050, 16, 1, 1024, 3);
+                Assert(waitFor([&music] { return music.GetQueued() == 3; }), "Expected the buffers prefetched");
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                AssertEqual(calls.load(), 3);
+                AssertEqual(lastPosition.load(), 2048u);
+
+                music.Play();
+                for (int frame = 0; frame < 20; frame++) {
+                    music.Update();
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+                raylib::MusicStreamer::Stats stats = music.GetStats();
+                Assert(stats.played >= 3 && stats.decoded <= stats.played + 3, "Expected decoded buffers played");
+
+                music.Seek(2.0f);
+                Assert(
+                    waitFor([&lastPosition] { return lastPosition.load() == 44100 + 2048; }),
+                    "Expected decoding to start over at the seek position");
+                music.Stop();
+            }
+
+            // A decoder slower than the music runs dry.
+            {
+                raylib::MusicStreamer music(
+                    [](void* out, unsigned int frameCount, unsigned int) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                        std::memset(out, 0, frameCount * sizeof(short));
+                        return frameCount;
+                    },
+                    22050,
+                    16,
+                    1,
+                    1024,
+                    2);
+                music.Play();
+                for (int frame = 0; frame < 30; frame++) {
+                    music.Update();
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+                raylib::MusicStreamer::Stats stats = music.GetStats();
+                Assert(stats.underruns > 0 && stats.maxDecodeTime >= 0.09f, "Expected underruns");
+            }
+
+            // A short file plays to its end, and stops.
+            {
+                raylib::MusicStreamer music(path + "/resources/audio/coin.wav", 1024, 2);
+                Assert(waitFor([&music] { return music.GetQueued() == 2; }), "Expected the buffers prefetched");
+                music.Play();
+                Assert(
+                    waitFor([&music] { return !music.Update().IsPlaying(); }),
+                    "Expected the music to stop at its end");
+                AssertEqual(music.GetStats().underruns, 0u);
+            }
+            CloseAudioDevice();
+        }
+    }
+
+    // SampleKernels
+    {
+        // Signal to noise ratio in decibels, against a reference.
+        auto snr = [](std::span<const float> signal, std::span<const float> reference) {
+            double power = 0;
+            double noise = 0;
+            for (std::size_t i = 0; i < reference.size(); i++) {
+                power += static_cast<double>(reference[i]) * reference[i];
+                const double error = static_cast<double>(signal[i]) - reference[i];
+                noise += error * error;
+            }
+            return 10.0 * std::log10(power / std::max(noise, 1e-30));
+        };
+        auto sine = [](std::size_t frames, double frequency, double rate, unsigned int channels = 1) {
+            std::vector<float> result(frames * channels);
+            for (std::size_t i = 0; i < result.size(); i++) {
+                const double time = static_cast<double>(i / channels) / rate;
+                const double shift = static_cast<double>(i % channels) * 0.5;
+                result[i] = static_cast<float>(0.5 * std::sin(2.0 * PI * frequency * time + shift));
+            }
+            return result;
+        };
+
+        // Every 16-bit and 8-bit value survives a round trip through floats. Odd counts run the scalar tails too.
+        std::vector<std::int16_t> shorts(65539);
+        for (std::size_t i = 0; i < shorts.size(); i++) {
+            shorts[i] = static_cast<std::int16_t>(static_cast<int>(i % 65536) - 32768);
+        }
+        std::vector<float> floats(shorts.size());
+        std::vector<std::int16_t> shortsBack(shorts.size());
+        raylib::samples::Int16ToFloat(shorts, floats);
+        raylib::samples::FloatToInt16(floats, shortsBack);
+        Assert(shorts == shortsBack, "Expected 16-bit samples back");
+        AssertEqual(floats[0], -1.0f);
+        std::vector<std::uint8_t> bytes(259);
+        for (std::size_t i = 0; i < bytes.size(); i++) {
+            bytes[i] = static_cast<std::uint8_t>(i % 256);
+        }
+        std::vector<std::uint8_t> bytesBack(bytes.size());
+        raylib::samples::Uint8ToFloat(bytes, floats);
+        AssertEqual(floats[128], 0.0f);
+        raylib::samples::FloatToUint8(std::span<const float>(floats).first(bytes.size()), bytesBack);
+        Assert(bytes == bytesBack, "Expected 8-bit samples back");
+        raylib::samples::Uint8ToInt16(bytes, shortsBack);
+        AssertEqual(shortsBack[0], -32768);
+        raylib::samples::Int16ToUint8(std::span<const std::int16_t>(shortsBack).first(bytes.size()), bytesBack);
+        Assert(bytes == bytesBack, "Expected 8-bit samples back through 16-bit samples");
+
+        // Out of range floats clamp, and both paths round the same way.
+        const float edges[] = {-2.0f, 1.5f, 0.999999f, -0.25f, 0.5f / 32768, 1.5f / 32768, 2.5f / 32768, -1.0f, 0.0f};
+        std::int16_t edgeShorts[9];
+        std::uint8_t edgeBytes[9];
+        raylib::samples::FloatToInt16(edges, edgeShorts);
+        raylib::samples::FloatToUint8(edges, edgeBytes);
+        for (std::size_t i = 0; i < 9; i++) {
+            const float scaled = std::min(std::max(edges[i] * 32768.0f, -32768.0f), 32767.0f);
+            AssertEqual(edgeShorts[i], static_cast<std::int16_t>(std::lrint(scaled)));
+            const float biased = std::min(std::max(edges[i] * 128.0f + 128.0f, 0.0f), 255.0f);
+            AssertEqual(edgeBytes[i], static_cast<std::uint8_t>(std::lrint(biased)));
+        }
+
+        // Quantizing a sine loses about 6 decibels per bit.
+        const std::vector<float> tone = sine(4097, 440.0, 44100.0);
+        std::vector<float> quantized(tone.size());
+        raylib::samples::FloatToInt16(tone, shortsBack);
+        raylib::samples::Int16ToFloat(std::span<const std::int16_t>(shortsBack).first(tone.size()), quantized);
+        Assert(snr(quantized, tone) > 85.0, "Expected 16-bit samples to be accurate");
+        raylib::samples::FloatToUint8(tone, bytesBack);
+        bytesBack.resize(tone.size());
+        raylib::samples::FloatToUint8(tone, bytesBack);
+        raylib::samples::Uint8ToFloat(bytesBack, quantized);
+        Assert(snr(quantized, tone) > 37.0, "Expected 8-bit samples to be accurate");
+
+        // Stereo to mono averages, mono to stereo copies.
+        const std::vector<float> stereo = sine(1001, 440.0, 44100.0, 2);
+        std::vector<float> mono(1001);
+        raylib::samples::MixChannels(stereo, 2, mono, 1);
+        Assert(std::abs(mono[1000] - (stereo[2000] + stereo[2001]) / 2) < 1e-6f, "Expected channels averaged");
+        std::vector<float> copied(2002);
+        raylib::samples::MixChannels(mono, 1, copied, 2);
+        Assert(copied[1998] == mono[999] && copied[1999] == mono[999], "Expected the channel copied");
+
+        // Resampled sines match sines generated at the new rate, away from the edges.
+        auto checkResample = [&](unsigned int from, unsigned int to, double frequency, double minimum) {
+            const std::vector<float> input = sine(from / 4, frequency, from, 2);
+            const raylib::samples::Resampler resampler(from, to);
+            std::vector<float> output(resampler.GetOutputFrames(from / 4) * 2);
+            AssertEqual(resampler.Process(input, output, 2), output.size() / 2);
+            const std::vector<float> expected = sine(output.size() / 2, frequency, to, 2);
+            const std::size_t margin = resampler.GetLength() * 2 * to / from + 2;
+            const std::span<const float> middle(output.data() + margin, output.size() - margin * 2);
+            const double ratio = snr(middle, std::span<const float>(expected.data() + margin, middle.size()));
+            Assert(ratio > minimum, "Expected %u Hz to %u Hz to be accurate, got %f dB", from, to, ratio);
+        };
+        checkResample(44100, 48000, 1000.0, 80.0);
+        checkResample(48000, 44100, 1000.0, 80.0);
+        checkResample(44100, 22050, 3000.0, 80.0);
+        checkResample(22050, 44100, 5000.0, 80.0);
+        // Too many phases for the table, so the phases are interpolated.
+        checkResample(44100, 48001, 1000.0, 80.0);
+
+        // Downsampling removes what is above the new Nyquist frequency.
+        const std::vector<float> high = sine(11025, 15000.0, 44100.0);
+        const raylib::samples::Resampler halve(44100, 22050);
+        std::vector<float> halved(halve.GetOutputFrames(high.size()));
+        halve.Process(high, halved);
+        double energy = 0;
+        for (std::size_t i = 100; i + 100 < halved.size(); i++) {
+            energy += static_cast<double>(halved[i]) * halved[i];
+        }
+        // The sine's power is 0.125 per frame.
+        const double attenuation = 10.0 * std::log10(energy / static_cast<double>(halved.size() - 200) / 0.125);
+        Assert(attenuation < -80.0, "Expected the tone filtered out, got %f dB", attenuation);
+
+        // Wave::Convert() goes through the kernels.
+        auto* data = static_cast<std::int16_t*>(::MemAlloc(4410 * 2 * sizeof(std::int16_t)));
+        const std::vector<float> source = sine(4410, 1000.0, 44100.0, 2);
+        raylib::samples::FloatToInt16(source, {data, source.size()});
+        raylib::Wave wave(4410, 44100, 16, 2, data);
+        raylib::Wave bytesWave(wave);
+        bytesWave.Convert(44100, 8, 2);
+        Assert(bytesWave.sampleSize == 8 && bytesWave.frameCount == 4410, "Expected an 8-bit wave");
+        std::vector<std::uint8_t> expectedBytes(source.size());
+        raylib::samples::Int16ToUint8({data, source.size()}, expectedBytes);
+        Assert(std::memcmp(bytesWave.data, expectedBytes.data(), expectedBytes.size()) == 0, "Expected the kernels");
+
+        wave.Convert(48000, 32, 1);
+        Assert(wave.sampleRate == 48000 && wave.sampleSize == 32 && wave.channels == 1, "Expected the new format");
+        AssertEqual(wave.frameCount, 4800u);
+        std::vector<float> converted(wave.frameCount);
+        wave.LoadSamples(converted);
+        std::vector<float> reference(4800);
+        const std::vector<float> expectedStereo = sine(4800, 1000.0, 48000.0, 2);
+        raylib::samples::MixChannels(expectedStereo, 2, reference, 1);
+        const std::span<const float> convertedMiddle = std::span<const float>(converted).subspan(100, 4600);
+        const std::span<const float> referenceMiddle = std::span<const float>(reference).subspan(100, 4600);
+        Assert(snr(convertedMiddle, referenceMiddle) > 80.0, "Expected the converted wave to be accurate");
+
+        bool threw = false;
+        try {
+            wave.LoadSamples(std::span<float>(converted).first(100));
+        } catch (raylib::RaylibException&) {
+            threw = true;
+        }
+        Assert(threw, "Expected a span of the wrong size to throw");
+    }
+
     // Wave
     {
         raylib::Wave wave(path + "/resources/weird.wav");
@@ -127,6 +2032,76 @@ int main(int argc, char* argv[]) {
     {
         raylib::FileData file(path + "/resources/weird.wav");
         Assert(file.GetBytesRead() > 0, "Expected file to be loaded correctly");
+
+        // Mapped files have the same contents.
+        raylib::FileData mapped(path + "/resources/weird.wav", raylib::FileData::Access::Sequential);
+        AssertEqual(mapped.GetBytesRead(), file.GetBytesRead());
+        AssertEqual(mapped.GetSize(), file.GetSize());
+        Assert(std::memcmp(mapped.GetData(), file.GetData(), file.GetSize()) == 0,
+               "Expected the mapped file to match the loaded file");
+        mapped.Advise(raylib::FileData::Access::Random);
+
+        raylib::FileData moved(std::move(mapped));
+        Assert(mapped.GetData() == nullptr && moved.GetSize() == file.GetSize(), "Expected the mapping to move");
+        moved.Unload();
+        AssertEqual(moved.GetBytesRead(), 0);
+    }
+
+    // AssetArchive
+    {
+        const std::string archiveFile = path + "/resources/test.pak";
+        raylib::AssetArchive::Pack(
+            archiveFile,
+            {path + "/resources/weird.wav", path + "/resources/lorem.txt", path + "/resources/feynman.png"},
+            path + "/resources");
+
+        raylib::AssetArchive archive(archiveFile);
+        AssertEqual(archive.GetEntryCount(), 3);
+        AssertEqual(archive.GetEntryName(0), "feynman.png");
+        Assert(archive.Contains("lorem.txt"), "Expected the archive to contain lorem.txt");
+        Assert(!archive.Contains("missing.txt"), "Expected the archive not to contain missing.txt");
+
+        // Entries match the loose files, and are aligned to 16 bytes.
+        for (const char* name : {"weird.wav", "lorem.txt", "feynman.png"}) {
+            raylib::FileData file(path + "/resources/" + name);
+            std::span<const unsigned char> entry = archive.GetEntry(name);
+            AssertEqual(entry.size(), file.GetSize());
+            Assert(std::memcmp(entry.data(), file.GetData(), file.GetSize()) == 0, "Expected entry to match the file");
+            AssertEqual(reinterpret_cast<std::uintptr_t>(entry.data()) % 16, 0);
+        }
+
+        raylib::Image image = archive.LoadImage("feynman.png");
+        raylib::Image loose(path + "/resources/feynman.png");
+        AssertEqual(image.width, loose.width);
+        AssertEqual(image.height, loose.height);
+
+        bool passed = false;
+        try {
+            (void)archive.GetEntry("missing.txt");
+        } catch (raylib::RaylibException&) {
+            passed = true;
+        }
+        Assert(passed, "Expected a RaylibException for a missing entry");
+
+        // A file that isn't an archive leaves the archive as it was.
+        for (raylib::AssetArchive* target : {&archive, static_cast<raylib::AssetArchive*>(nullptr)}) {
+            raylib::AssetArchive empty;
+            raylib::AssetArchive& loaded = target != nullptr ? *target : empty;
+            const bool wasValid = loaded.IsValid();
+            bool thrown = false;
+            try {
+                loaded.Load(path + "/resources/lorem.txt");
+            } catch (raylib::RaylibException&) {
+                thrown = true;
+            }
+            Assert(thrown, "Expected a RaylibException for an invalid archive");
+            AssertEqual(loaded.IsValid(), wasValid);
+            AssertEqual(loaded.GetEntryCount(), wasValid ? 3 : 0);
+        }
+        Assert(archive.Contains("lorem.txt"), "Expected the archive to stay open");
+
+        archive.Unload();
+        std::remove(archiveFile.c_str());
     }
 
     // Load FileText
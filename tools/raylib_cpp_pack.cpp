@@ -0,0 +1,40 @@
+/**
+ * raylib_cpp_pack: Packs the files of a directory into a raylib::AssetArchive.
+ *
+ * Usage: raylib_cpp_pack <archive> <directory> [filter]
+ *
+ * Entry names are the file paths relative to the directory, like "textures/player.png". The optional filter is a
+ * list of extensions, like ".png;.wav", as taken by LoadDirectoryFilesEx().
+ */
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "raylib-cpp.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: %s <archive> <directory> [filter]\n", argv[0]);
+        return 1;
+    }
+    const std::string archiveFileName = argv[1];
+    std::string directory = argv[2];
+    if (!directory.empty() && directory.back() != '/' && directory.back() != '\\') {
+        directory += '/';
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    ::FilePathList list = LoadDirectoryFilesEx(directory.c_str(), argc > 3 ? argv[3] : nullptr, true);
+    std::vector<std::string> files(list.paths, list.paths + list.count);
+    UnloadDirectoryFiles(list);
+
+    try {
+        raylib::AssetArchive::Pack(archiveFileName, files, directory);
+        raylib::AssetArchive archive(archiveFileName);
+        std::printf("Packed %zu files into %s\n", archive.GetEntryCount(), archiveFileName.c_str());
+    } catch (const raylib::RaylibException& error) {
+        std::fprintf(stderr, "%s\n", error.what());
+        return 1;
+    }
+    return 0;
+}